@@ -15,6 +15,32 @@ MODEL_PATH = BASE_DIR / "models" / "best.pt"
 API_HOST = os.getenv("API_HOST", "0.0.0.0")
 API_PORT = int(os.getenv("API_PORT", "8000"))
 
+# TLS (set both paths to serve HTTPS to the gate firmware)
+API_SSL_CERTFILE = os.getenv("API_SSL_CERTFILE")
+API_SSL_KEYFILE = os.getenv("API_SSL_KEYFILE")
+API_KEEPALIVE_S = int(os.getenv("API_KEEPALIVE_S", "75"))
+
+# UDP decision protocol (enabled when the key is set)
+UDP_DECISION_KEY = os.getenv("UDP_DECISION_KEY")
+UDP_DECISION_PORT = int(os.getenv("UDP_DECISION_PORT", "8001"))
+
+# MQTT decision bridge (enabled when the broker is set)
+MQTT_BROKER = os.getenv("MQTT_BROKER")
+MQTT_PORT = int(os.getenv("MQTT_PORT", "1883"))
+MQTT_USERNAME = os.getenv("MQTT_USERNAME")
+MQTT_PASSWORD = os.getenv("MQTT_PASSWORD")
+
+# Denylist of stolen or banned vehicles (one plate per line). The shard
+# count must match the firmware's Config::DENYLIST_SHARDS.
+DENYLIST_PATH = os.getenv("DENYLIST_PATH", str(BASE_DIR / "data" / "denylist.txt"))
+DENYLIST_SHARDS = int(os.getenv("DENYLIST_SHARDS", "192"))
+
+# Access schedules per allowlist profile (JSON, see src/api/schedule.py)
+SCHEDULE_PATH = os.getenv("SCHEDULE_PATH", str(BASE_DIR / "data" / "schedule.json"))
+
+# Fixed plate answered without camera or model (transport benchmarks)
+LPR_STUB_PLATE = os.getenv("LPR_STUB_PLATE", "")
+
 # Camera configuration
 CAMERA_ID = int(os.getenv("CAMERA_ID", "0"))
 CAMERA_WIDTH = int(os.getenv("CAMERA_WIDTH", "1280"))
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <time.h>
+
+#include "Config.h"
+#include "ScheduleImage.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ACCESS SCHEDULE
+// ═══════════════════════════════════════════════════════════════════════════
+// Time windows per allowlist profile (ScheduleImage.h), checked on the
+// device so time-based rules need no server round trip. The schedule is
+// synced by DenylistSync, kept in NVS so it survives a reboot without
+// network, and held in RAM (under 2 KB) for the checks. The clock is set
+// by SNTP whenever WiFi is up and keeps running offline.
+//
+// Like the allowlist, a missing schedule or an unset clock leaves the
+// decision to the server alone rather than locking every scheduled plate
+// out.
+
+class AccessSchedule {
+public:
+  static void begin() {
+    configTzTime(Config::SCHEDULE_TIMEZONE, Config::SCHEDULE_NTP_SERVER);
+
+    Preferences preferences;
+    if (!preferences.begin("schedule", true)) {
+      return;
+    }
+    const size_t length = preferences.getBytes("image", image_, sizeof(image_));
+    preferences.end();
+    if (length > 0 && !load(length)) {
+      Serial.println("[Schedule] Stored schedule invalid, ignored");
+    }
+  }
+
+  static bool ready() {
+    return loaded_;
+  }
+
+  // 0 when no schedule is loaded, matching the manifest's "none"
+  static uint32_t generation() {
+    return loaded_ ? evaluator_.generation() : 0;
+  }
+
+  // Validates, stores and activates a schedule fetched from the server
+  static bool apply(const uint8_t* data, size_t length) {
+    if (length > sizeof(image_) || !ScheduleImage::valid(data, length)) {
+      return false;
+    }
+    memcpy(image_, data, length);
+    load(length);
+
+    Preferences preferences;
+    if (preferences.begin("schedule", false)) {
+      preferences.putBytes("image", image_, length);
+      preferences.end();
+    }
+    return true;
+  }
+
+  // The server no longer has a schedule
+  static void clear() {
+    loaded_ = false;
+    Preferences preferences;
+    if (preferences.begin("schedule", false)) {
+      preferences.remove("image");
+      preferences.end();
+    }
+  }
+
+  static bool permits(uint8_t profile) {
+    if (profile == 0 || !loaded_) {
+      return true;
+    }
+    tm local;
+    if (!localTime(local)) {
+      return true;
+    }
+    return evaluator_.permits(profile,
+                              ScheduleImage::dayNumber(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday),
+                              static_cast<uint8_t>(local.tm_wday), local.tm_hour * 60 + local.tm_min);
+  }
+
+  static void printStatus(Print& out) {
+    tm local;
+    char now[24] = "clock not set";
+    if (localTime(local)) {
+      strftime(now, sizeof(now), "%a %Y-%m-%d %H:%M", &local);
+    }
+    if (!loaded_) {
+      out.printf("[Schedule] No schedule, %s\n", now);
+      return;
+    }
+    ScheduleImage::Header header;
+    memcpy(&header, image_, sizeof(header));
+    out.printf("[Schedule] %u profiles, %u overrides, generation %u, %s\n", static_cast<unsigned>(header.profileCount),
+               static_cast<unsigned>(header.overrideCount), static_cast<unsigned>(header.generation), now);
+  }
+
+private:
+  // Earlier times mean SNTP has not set the clock since power-up
+  static constexpr time_t MIN_VALID_TIME = 1700000000;
+
+  alignas(4) static inline uint8_t image_[ScheduleImage::MAX_BYTES];
+  static inline ScheduleImage::Evaluator evaluator_;
+  static inline bool loaded_ = false;
+
+  static bool load(size_t length) {
+    loaded_ = ScheduleImage::valid(image_, length);
+    if (loaded_) {
+      evaluator_.attach(image_);
+      Serial.printf("[Schedule] %u profiles, generation %u\n", static_cast<unsigned>(evaluator_.profileCount()),
+                    static_cast<unsigned>(evaluator_.generation()));
+    }
+    return loaded_;
+  }
+
+  static bool localTime(tm& local) {
+    const time_t now = time(nullptr);
+    return now >= MIN_VALID_TIME && localtime_r(&now, &local) != nullptr;
+  }
+};
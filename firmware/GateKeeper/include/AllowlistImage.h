@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ALLOWLIST IMAGE FORMAT
+// ═══════════════════════════════════════════════════════════════════════════
+// The allowlist partition holds one image: a 32-byte header followed by the
+// lookup structure named by `layout`. Images are built off-device by
+// tools/allowlist_image.py and searched in place through a flash mapping,
+// so no entry is ever copied to RAM. All fields are little-endian, which is
+// the native order of both the ESP32 and the host.
+//
+// Layout 1 (Eytzinger): the sorted PlateIds are stored in BFS order of an
+// implicit binary search tree, with the children of node k (1-based) at 2k
+// and 2k+1. The first levels are shared by every search and stay in the
+// flash cache; a lookup touches log2(n) entries along one root-to-leaf path,
+// with no branch misprediction on the comparison. Any prefix of the array
+// is itself a valid tree, which the benchmarks use to measure smaller lists
+// from one image.
+//
+// Layout 2 (PerfectHash): a minimal perfect hash with 16-bit fingerprints,
+// about 20 bits per plate and a constant number of reads per lookup, at a
+// 2^-16 false-positive rate. See PerfectHash.h.
+//
+// An image may be followed by a profile table: one byte per entry, indexed
+// by the entry's position (Eytzinger) or slot (PerfectHash), naming its
+// access schedule (ScheduleImage.h). Profile 0, and every entry of an image
+// without the table, is unrestricted.
+//
+// Pure C++, shared by the firmware and tools/bench/allowlist_bench.
+
+enum class AllowlistLayout : uint16_t { Eytzinger = 1, PerfectHash = 2 };
+
+struct AllowlistHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t layout;
+  uint32_t count;
+  uint32_t dataBytes;
+  uint32_t dataCrc;     // CRC-32 (zlib) of the dataBytes after the header
+  uint32_t generation;  // Set by the builder, logged on load
+  uint32_t profileBytes;  // 0, or count: the profile table after the data
+  uint32_t profileCrc;    // CRC-32 (zlib) of the profile table
+};
+
+static_assert(sizeof(AllowlistHeader) == 32, "Header layout is shared with tools/allowlist_image.py");
+
+namespace AllowlistImage {
+  constexpr uint32_t MAGIC = 0x4C414B47;  // "GKAL"
+  constexpr uint16_t VERSION = 1;
+
+  // Nibble-table CRC-32, same result as zlib.crc32()
+  inline uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc = 0) {
+    static constexpr uint32_t TABLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    crc = ~crc;
+    for (size_t i = 0; i < length; ++i) {
+      crc = TABLE[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+      crc = TABLE[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
+  }
+}
+
+namespace Eytzinger {
+  // Lays out sorted[0..n) in BFS order into out[0..n).
+  template <typename T>
+  size_t build(const T* sorted, T* out, size_t n, size_t next = 0, size_t node = 1) {
+    if (node <= n) {
+      next = build(sorted, out, n, next, 2 * node);
+      out[node - 1] = sorted[next++];
+      next = build(sorted, out, n, next, 2 * node + 1);
+    }
+    return next;
+  }
+
+  // Descends to a leaf, going right while the node is smaller than the key.
+  // The last left turn is the lower bound; shifting off the trailing right
+  // turns (ones) and that left turn (a zero) recovers it.
+  // Returns the key's index in keys[], or n if it is absent.
+  inline uint32_t find(const uint64_t* keys, uint32_t n, uint64_t key) {
+    uint32_t node = 1;
+    while (node <= n) {
+      node = 2 * node + (keys[node - 1] < key ? 1 : 0);
+    }
+    node >>= __builtin_ffs(~node);
+    return node != 0 && keys[node - 1] == key ? node - 1 : n;
+  }
+
+  inline bool contains(const uint64_t* keys, uint32_t n, uint64_t key) {
+    return find(keys, n, key) != n;
+  }
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CONFIGURATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace Config {
+  // QEMU Emulation (env:qemu; see include/QemuHarness.h)
+#ifdef GATEKEEPER_QEMU
+  constexpr bool QEMU_BUILD = true;
+#else
+  constexpr bool QEMU_BUILD = false;
+#endif
+  constexpr uint32_t QEMU_TUNNEL_BAUD = 921600;
+  constexpr int QEMU_TUNNEL_RX_PIN = 16;
+  constexpr int QEMU_TUNNEL_TX_PIN = 17;
+  constexpr unsigned long QEMU_TUNNEL_CONNECT_TIMEOUT_MS = 3000;
+
+  // WiFi Credentials
+  constexpr char WIFI_SSID[] = "TP-Link_4736";
+  constexpr char WIFI_PASSWORD[] = "QuakQuak@1238";
+  constexpr unsigned long WIFI_TIMEOUT_MS = 20000;
+
+  // Webhook Configuration
+  constexpr char WEBHOOK_URL[] = "http://192.168.10.213:8000/lpr";
+  constexpr unsigned long HTTP_TIMEOUT_MS = 60000;
+  constexpr size_t HTTP_BODY_BUFFER_SIZE = 256;
+
+  // Lane tuning defaults; `profile` keeps per-site values in NVS over them
+  // (include/SiteProfile.h, chosen with tools/sim/sweep_sim)
+  constexpr uint8_t DECISION_RETRIES = 0;    // Requests repeated after one gets no answer
+  constexpr unsigned long HOLD_OPEN_MS = 0;  // Close delay after the vehicle leaves
+  constexpr size_t PLATE_MAX_LENGTH = 16;
+  constexpr unsigned long CONNECTION_WARMUP_INTERVAL_MS = 5000;
+  constexpr unsigned long CONNECTION_WARMUP_MAX_INTERVAL_MS = 60000;  // Backed off to while the server is down
+  constexpr unsigned long SERVER_CONNECT_TIMEOUT_MS = 10000;          // Lookup, TCP connect and TLS handshake
+
+  // TLS (used when WEBHOOK_URL starts with https://)
+  constexpr bool WEBHOOK_USE_TLS = WEBHOOK_URL[4] == 's';
+  constexpr char WEBHOOK_CA_CERT[] = "";  // PEM; empty skips server verification
+  constexpr unsigned long TLS_WRITE_TIMEOUT_MS = 2000;  // Peer not reading
+
+  // Server Discovery (mDNS; the WEBHOOK_URL host is used until one is found)
+  constexpr bool DISCOVERY_ENABLED = !QEMU_BUILD;  // No multicast through the QEMU tunnel
+  constexpr char DISCOVERY_SERVICE[] = "_gatekeeper-lpr";
+  constexpr char DISCOVERY_PROTOCOL[] = "_tcp";
+  constexpr uint32_t DISCOVERY_QUERY_TIMEOUT_MS = 2000;
+  constexpr uint32_t DISCOVERY_MIN_TTL_S = 30;
+  constexpr uint32_t DISCOVERY_MAX_TTL_S = 3600;
+  constexpr uint32_t DISCOVERY_RETRY_MS = 10000;
+
+  // UDP decision protocol (optional; server is the WEBHOOK_URL host)
+  constexpr bool UDP_DECISION_ENABLED = false;
+  constexpr uint16_t UDP_DECISION_PORT = 8001;
+  constexpr char UDP_DECISION_KEY[] = "change-me-gatekeeper-key";  // Must match the server
+  constexpr unsigned long UDP_RTO_MS = 40;
+  constexpr unsigned long UDP_RTO_MAX_MS = 320;
+  constexpr unsigned long UDP_PENDING_RETRY_MS = 500;
+
+  // Decision Transport (MQTT topics are gatekeeper/<GATE_ID>/...)
+  enum class DecisionTransportKind { Webhook, Mqtt };
+  constexpr DecisionTransportKind DECISION_TRANSPORT = DecisionTransportKind::Webhook;
+  constexpr char GATE_ID[] = "gate1";
+
+  // MQTT (persistent session, QoS 1 triggers)
+  constexpr char MQTT_BROKER_HOST[] = "192.168.10.213";
+  constexpr uint16_t MQTT_BROKER_PORT = 1883;
+  constexpr char MQTT_USERNAME[] = "";
+  constexpr char MQTT_PASSWORD[] = "";
+  constexpr uint16_t MQTT_KEEPALIVE_S = 30;
+  constexpr unsigned long MQTT_CONNECT_TIMEOUT_MS = 3000;
+  constexpr unsigned long MQTT_RECONNECT_MS = 5000;
+  constexpr unsigned long MQTT_RESEND_MS = 2000;  // PUBACK wait before a DUP resend
+  constexpr size_t MQTT_OUTBOUND_QUEUE = 8;       // Power of two
+
+  // Allowlist (flash partition image from tools/allowlist_image.py)
+  constexpr char ALLOWLIST_PARTITION_LABEL[] = "allowlist";
+  constexpr uint8_t ALLOWLIST_PARTITION_SUBTYPE = 0x40;  // Custom data subtype, see partitions.csv
+  constexpr bool ALLOWLIST_ENFORCED = false;  // Server accepts also need a local allowlist hit
+
+  // Denylist (filter shards synced from the WEBHOOK_URL server, see partitions.csv)
+  constexpr char DENYLIST_PARTITION_LABEL[] = "denylist";
+  constexpr uint8_t DENYLIST_PARTITION_SUBTYPE = 0x41;
+  constexpr uint32_t DENYLIST_SHARDS = 192;  // 4 KB each; must match the server's DENYLIST_SHARDS
+  constexpr unsigned long DENYLIST_SYNC_INTERVAL_MS = 300000;
+  constexpr unsigned long DENYLIST_REQUEST_TIMEOUT_MS = 3000;
+
+  // Access schedules (profiles from the allowlist image, windows synced with the denylist)
+  constexpr bool SCHEDULE_ENFORCED = true;  // Scheduled plates are denied outside their windows
+  constexpr char SCHEDULE_TIMEZONE[] = "ICT-7";  // POSIX TZ of the gate's local time
+  constexpr char SCHEDULE_NTP_SERVER[] = "pool.ntp.org";
+
+  // Field Trace (`trace start` records sensor edges and decisions, see include/FieldTrace.h)
+  constexpr bool TRACE_ENABLED = true;  // Edge ISR hook and console command
+  constexpr char TRACE_PARTITION_LABEL[] = "trace";
+  constexpr uint8_t TRACE_PARTITION_SUBTYPE = 0x42;
+  constexpr size_t TRACE_QUEUE = 256;  // Power of two
+  constexpr unsigned long TRACE_FLUSH_MS = 1000;
+
+  // Hardware Pins
+  constexpr int LM393_SENSOR_PIN = 4;
+  constexpr int SERVO_CONTROL_PIN = 5;
+  constexpr int ULTRASONIC_TRIG_PIN = 18;
+  constexpr int ULTRASONIC_ECHO_PIN = 19;
+  constexpr int LOOP_DETECTOR_PIN = 25;
+  constexpr int CAMERA_MOTION_PIN = 26;
+  constexpr int OLED_SDA_PIN = 21;
+  constexpr int OLED_SCL_PIN = 22;
+  constexpr int RELAY_PIN = 27;  // Relay variant only
+
+  // Servo Settings
+  constexpr int SERVO_MIN_PULSE_US = 500;
+  constexpr int SERVO_MAX_PULSE_US = 2400;
+  constexpr int SERVO_CLOSED_ANGLE = 0;
+  constexpr int SERVO_OPEN_ANGLE = 90;
+  constexpr unsigned long SERVO_TRAVEL_MS = 500;  // Full swing; no position feedback
+
+  // Relay Settings (relay variant: a barrier controller's open input)
+  constexpr bool RELAY_ACTIVE_HIGH = true;
+  constexpr unsigned long RELAY_SETTLE_MS = 20;  // Contact bounce; the controller times the barrier
+
+  // OLED Display Settings
+  constexpr int OLED_WIDTH = 128;
+  constexpr int OLED_HEIGHT = 64;
+  constexpr int OLED_RESET_PIN = -1;
+  constexpr uint8_t OLED_I2C_ADDRESS = 0x3C;
+  constexpr uint32_t OLED_I2C_CLOCK_HZ = 400000;  // 1000000 (fast-mode plus) if `oled bench` passes
+  constexpr uint16_t OLED_I2C_TIMEOUT_MS = 50;      // Per transfer; a full frame is about 24 ms at 400 kHz
+  constexpr uint32_t OLED_ANIMATION_FPS = 10;  // Cap for the "checking" spinner
+
+  // Presence Sources (LM393 is always fitted, the rest are per site)
+  constexpr bool ULTRASONIC_ENABLED = false;
+  constexpr bool LOOP_DETECTOR_ENABLED = false;
+  constexpr bool CAMERA_MOTION_ENABLED = false;
+  constexpr uint8_t LM393_CONFIDENCE = 40;
+  constexpr uint8_t ULTRASONIC_CONFIDENCE = 70;
+  constexpr uint8_t LOOP_DETECTOR_CONFIDENCE = 90;
+  constexpr uint8_t CAMERA_MOTION_CONFIDENCE = 30;
+  constexpr unsigned int ULTRASONIC_PRESENCE_CM = 150;
+  constexpr unsigned long ULTRASONIC_ECHO_TIMEOUT_US = 25000;
+  constexpr unsigned long ULTRASONIC_INTERVAL_MS = 60;
+  constexpr unsigned long CAMERA_MOTION_HOLD_MS = 1500;
+
+  // Presence Fusion (k-of-n voting over sources asserted within the window)
+  constexpr uint8_t FUSION_MIN_VOTES = 1;
+  constexpr uint16_t FUSION_MIN_CONFIDENCE = 40;
+  constexpr unsigned long FUSION_ALIGN_WINDOW_MS = 750;
+
+  // Debounce (compare strategies per site with tools/sim/debounce_sim)
+  enum class DebounceMode { RestartWindow, Integrator, Asymmetric, Majority };
+  constexpr DebounceMode DEBOUNCE_MODE = DebounceMode::RestartWindow;
+  constexpr unsigned long DEBOUNCE_DELAY_MS = 50;
+  constexpr uint8_t DEBOUNCE_INTEGRATOR_SAMPLES = 4;
+  constexpr unsigned long DEBOUNCE_ASSERT_MS = 10;
+  constexpr unsigned long DEBOUNCE_DEASSERT_MS = 250;
+  constexpr uint8_t DEBOUNCE_MAJORITY_SAMPLES = 5;
+
+  // Timing
+  constexpr unsigned long LOOP_DELAY_MS = 10;
+  constexpr int SERIAL_BAUD_RATE = 115200;
+  constexpr unsigned long METRICS_REPORT_INTERVAL_MS = 60000;
+  constexpr uint32_t STACK_WARNING_BYTES = 512;
+
+  // Watchdog (a task stalled this long resets the chip; the barrier then
+  // goes to GATE_SAFE_STATE, Open where a vehicle must never be trapped)
+  enum class GateSafeState { Closed, Open };
+  constexpr GateSafeState GATE_SAFE_STATE = GateSafeState::Closed;
+  constexpr uint32_t WATCHDOG_TIMEOUT_S = 15;
+
+  // Sampling Profiler (8 bytes per sample, timers PROFILER_TIMER_BASE + core)
+  constexpr uint32_t PROFILER_MAX_SAMPLES = 1024;
+  constexpr uint32_t PROFILER_DEFAULT_HZ = 1000;
+  constexpr uint32_t PROFILER_MAX_HZ = 5000;
+  constexpr uint8_t PROFILER_TIMER_BASE = 2;
+}
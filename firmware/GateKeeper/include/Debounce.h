@@ -0,0 +1,199 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DEBOUNCE STRATEGIES
+// ═══════════════════════════════════════════════════════════════════════════
+// Pure logic fed with (raw level, time) samples so the host harness in
+// tools/sim/debounce_sim can replay logic-analyzer captures through exactly
+// the code the sensor runs. Pick one per site with Config::DEBOUNCE_MODE.
+
+class DebounceStrategy {
+public:
+  virtual ~DebounceStrategy() = default;
+
+  virtual void reset(int value, unsigned long nowMs) {
+    stable_ = value;
+    (void)nowMs;
+  }
+
+  // Feeds one raw sample. Returns true when the stable value changed.
+  virtual bool update(int raw, unsigned long nowMs) = 0;
+
+  int stableValue() const {
+    return stable_;
+  }
+
+protected:
+  int stable_ = -1;
+
+  bool commit(int value) {
+    if (value == stable_) {
+      return false;
+    }
+    stable_ = value;
+    return true;
+  }
+};
+
+// Original behaviour: the raw level must hold for a full window, and any edge
+// restarts the window. Adds the whole window to every detection.
+class RestartWindowDebounce : public DebounceStrategy {
+public:
+  explicit RestartWindowDebounce(unsigned long windowMs) : windowMs_(windowMs) {}
+
+  void reset(int value, unsigned long nowMs) override {
+    DebounceStrategy::reset(value, nowMs);
+    raw_ = value;
+    lastEdgeMs_ = nowMs;
+  }
+
+  bool update(int raw, unsigned long nowMs) override {
+    if (raw != raw_) {
+      raw_ = raw;
+      lastEdgeMs_ = nowMs;
+    }
+
+    if ((nowMs - lastEdgeMs_) >= windowMs_) {
+      return commit(raw_);
+    }
+    return false;
+  }
+
+  void setWindow(unsigned long windowMs) {
+    windowMs_ = windowMs;
+  }
+
+private:
+  unsigned long windowMs_;
+  int raw_ = -1;
+  unsigned long lastEdgeMs_ = 0;
+};
+
+// Counts up on high samples and down on low ones, switching at the rails.
+// Isolated noise only dents the count instead of restarting a timer, so
+// sustained chatter cannot hold the output off indefinitely.
+class CounterIntegratorDebounce : public DebounceStrategy {
+public:
+  explicit CounterIntegratorDebounce(uint8_t samples) : max_(samples > 0 ? samples : 1) {}
+
+  void reset(int value, unsigned long nowMs) override {
+    DebounceStrategy::reset(value, nowMs);
+    count_ = value ? max_ : 0;
+  }
+
+  bool update(int raw, unsigned long nowMs) override {
+    (void)nowMs;
+    if (raw && count_ < max_) {
+      ++count_;
+    } else if (!raw && count_ > 0) {
+      --count_;
+    }
+
+    if (count_ == 0) {
+      return commit(0);
+    }
+    if (count_ == max_) {
+      return commit(1);
+    }
+    return false;
+  }
+
+private:
+  uint8_t max_;
+  uint8_t count_ = 0;
+};
+
+// Separate windows per direction: a short assert window for fast detection
+// and a long deassert window so a vehicle gap does not reopen the cycle.
+class AsymmetricDebounce : public DebounceStrategy {
+public:
+  AsymmetricDebounce(unsigned long assertMs, unsigned long deassertMs)
+      : assertMs_(assertMs), deassertMs_(deassertMs) {}
+
+  void setActiveLevel(int level) {
+    activeLevel_ = level;
+  }
+
+  void reset(int value, unsigned long nowMs) override {
+    DebounceStrategy::reset(value, nowMs);
+    raw_ = value;
+    lastEdgeMs_ = nowMs;
+  }
+
+  bool update(int raw, unsigned long nowMs) override {
+    if (raw != raw_) {
+      raw_ = raw;
+      lastEdgeMs_ = nowMs;
+    }
+
+    const unsigned long windowMs = (raw_ == activeLevel_) ? assertMs_ : deassertMs_;
+    if ((nowMs - lastEdgeMs_) >= windowMs) {
+      return commit(raw_);
+    }
+    return false;
+  }
+
+private:
+  unsigned long assertMs_;
+  unsigned long deassertMs_;
+  int activeLevel_ = 0;
+  int raw_ = -1;
+  unsigned long lastEdgeMs_ = 0;
+};
+
+// Output follows the majority of the last N samples (N odd, at most 31).
+class MajorityDebounce : public DebounceStrategy {
+public:
+  explicit MajorityDebounce(uint8_t samples)
+      : samples_(samples < 1 ? 1 : (samples > 31 ? 31 : samples | 1)) {}
+
+  void reset(int value, unsigned long nowMs) override {
+    DebounceStrategy::reset(value, nowMs);
+    history_ = value ? ((1UL << samples_) - 1) : 0;
+  }
+
+  bool update(int raw, unsigned long nowMs) override {
+    (void)nowMs;
+    history_ = ((history_ << 1) | (raw ? 1 : 0)) & ((1UL << samples_) - 1);
+    return commit(__builtin_popcountl(history_) > samples_ / 2 ? 1 : 0);
+  }
+
+private:
+  uint8_t samples_;
+  unsigned long history_ = 0;
+};
+
+// One instance of every strategy, configured from Config, so a sensor can
+// switch strategy without heap allocation.
+class DebounceStrategies {
+public:
+  DebounceStrategy& select(Config::DebounceMode mode, int activeLevel) {
+    switch (mode) {
+      case Config::DebounceMode::Integrator:
+        return integrator_;
+      case Config::DebounceMode::Asymmetric:
+        asymmetric_.setActiveLevel(activeLevel);
+        return asymmetric_;
+      case Config::DebounceMode::Majority:
+        return majority_;
+      case Config::DebounceMode::RestartWindow:
+      default:
+        return restartWindow_;
+    }
+  }
+
+  // Site profile override of DEBOUNCE_DELAY_MS
+  void setRestartWindow(unsigned long windowMs) {
+    restartWindow_.setWindow(windowMs);
+  }
+
+private:
+  RestartWindowDebounce restartWindow_{Config::DEBOUNCE_DELAY_MS};
+  CounterIntegratorDebounce integrator_{Config::DEBOUNCE_INTEGRATOR_SAMPLES};
+  AsymmetricDebounce asymmetric_{Config::DEBOUNCE_ASSERT_MS, Config::DEBOUNCE_DEASSERT_MS};
+  MajorityDebounce majority_{Config::DEBOUNCE_MAJORITY_SAMPLES};
+};
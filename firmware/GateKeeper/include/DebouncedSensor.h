@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "Config.h"
+#include "Debounce.h"
+#include "FastGpio.h"
+#include "FieldTrace.h"
+#include "SiteProfile.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SENSOR READER WITH DEBOUNCING
+// ═══════════════════════════════════════════════════════════════════════════
+// Templated on the pin so sampling is a direct register read, and so every
+// pin gets its own IRAM edge ISR and counters without a lookup table.
+
+template <int Pin>
+class DebouncedSensor {
+public:
+  void initialize(int mode = INPUT, int activeLevel = LOW,
+                  Config::DebounceMode debounce = Config::DEBOUNCE_MODE) {
+    pinMode(Pin, mode);
+
+    // Initialize debounced state
+    strategies_.setRestartWindow(SiteProfile::debounceMs());
+    strategy_ = &strategies_.select(debounce, activeLevel);
+    strategy_->reset(FastGpio<Pin>::read(), millis());
+    attachInterrupt(digitalPinToInterrupt(Pin), onEdge, CHANGE);
+  }
+
+  bool hasChanged() {
+    if (strategy_->update(FastGpio<Pin>::read(), millis())) {
+      Serial.printf("[Sensor] GPIO %d state changed: %d\n", Pin, getStableValue());
+      return true;
+    }
+
+    return false;
+  }
+
+  int getStableValue() const {
+    return strategy_->stableValue();
+  }
+
+  // Raw edges seen by the ISR, including bounces the debouncer filtered out.
+  static uint32_t rawEdgeCount() {
+    return rawEdges_;
+  }
+
+  static uint32_t lastRawEdgeUs() {
+    return lastRawEdgeUs_;
+  }
+
+private:
+  DebounceStrategies strategies_;
+  DebounceStrategy* strategy_ = nullptr;
+
+  static volatile uint32_t rawEdges_;
+  static volatile uint32_t lastRawEdgeUs_;
+
+  static void IRAM_ATTR onEdge() {
+    rawEdges_ = rawEdges_ + 1;
+    lastRawEdgeUs_ = micros();
+    if (Config::TRACE_ENABLED) {
+      FieldTrace::recordEdge(Pin, FastGpio<Pin>::read());
+    }
+  }
+};
+
+template <int Pin>
+volatile uint32_t DebouncedSensor<Pin>::rawEdges_ = 0;
+
+template <int Pin>
+volatile uint32_t DebouncedSensor<Pin>::lastRawEdgeUs_ = 0;
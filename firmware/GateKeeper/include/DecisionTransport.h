@@ -0,0 +1,124 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FixedString.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DECISION TRANSPORT INTERFACE
+// ═══════════════════════════════════════════════════════════════════════════
+// How the gate asks the recognition server for a decision. WebhookClient
+// (HTTP or UDP) and MqttDecisionTransport implement it; GateKeeperApp only
+// sees this interface and picks one with Config::DECISION_TRANSPORT.
+
+// Server-initiated requests, delivered by transports that can receive them.
+enum class RemoteCommand : uint8_t { OpenGate, CloseGate, InvalidateAllowlist };
+
+// Failed: no answer (not sent, failed or timed out). The flow may retry;
+// otherwise it is handled like Denied.
+enum class DecisionState : uint8_t { Pending, Accepted, Denied, Failed };
+
+class DecisionTransport {
+public:
+  virtual ~DecisionTransport() = default;
+
+  virtual const char* name() const = 0;
+  virtual void initialize() = 0;
+
+  // Connects now if the link is down, e.g. right after Wi-Fi comes up.
+  virtual void warmUp() = 0;
+
+  // Called every loop iteration to keep the link ready between vehicles.
+  virtual void maintain(unsigned long nowMs) = 0;
+
+  // Trigger-to-decision exchange, split so the recognition flow can wait
+  // without blocking the loop. startDecision() sends the trigger, or only
+  // starts connecting when there is no open connection; then
+  // pollDecision() is called until it stops returning Pending, which it
+  // does within SiteProfile::timeoutMs(). plateOut is only written with the result.
+  virtual void startDecision(unsigned long nowMs) = 0;
+  virtual DecisionState pollDecision(unsigned long nowMs, PlateText& plateOut) = 0;
+
+  virtual bool nextCommand(RemoteCommand& command) {
+    (void)command;
+    return false;
+  }
+
+  // Reports a probable denylist hit for the server to confirm. Returns once
+  // the alert is sent or queued; the server's verdict is not awaited.
+  virtual bool sendAlert(const char* plate) = 0;
+};
+
+// Minimal field lookup for the server's small, flat JSON objects, e.g.
+// {"id": 7, "plate": "51A12345", "status": true}.
+namespace DecisionJson {
+  inline const char* skipWhitespace(const char* text) {
+    while (*text != '\0') {
+      const char ch = *text;
+      if (ch != ' ' && ch != '\n' && ch != '\r' && ch != '\t') {
+        return text;
+      }
+      ++text;
+    }
+    return nullptr;
+  }
+
+  inline const char* findValue(const char* payload, const char* key) {
+    const char* keyStart = strstr(payload, key);
+    if (keyStart == nullptr) {
+      return nullptr;
+    }
+
+    const char* colon = strchr(keyStart, ':');
+    if (colon == nullptr) {
+      return nullptr;
+    }
+
+    return skipWhitespace(colon + 1);
+  }
+
+  inline bool parseStatusField(const char* payload, bool& status) {
+    const char* value = findValue(payload, "\"status\"");
+    if (value == nullptr) {
+      return false;
+    }
+
+    if (strncmp(value, "true", 4) == 0) {
+      status = true;
+      return true;
+    }
+
+    if (strncmp(value, "false", 5) == 0) {
+      status = false;
+      return true;
+    }
+
+    return false;
+  }
+
+  inline bool parsePlateField(const char* payload, PlateText& plate) {
+    const char* value = findValue(payload, "\"plate\"");
+    if (value == nullptr || *value != '"') {
+      return false;
+    }
+
+    const char* endQuote = strchr(value + 1, '"');
+    if (endQuote == nullptr) {
+      return false;
+    }
+
+    plate.assign(value + 1, endQuote - value - 1);
+    return true;
+  }
+
+  inline bool parseIdField(const char* payload, uint32_t& id) {
+    const char* value = findValue(payload, "\"id\"");
+    if (value == nullptr || *value < '0' || *value > '9') {
+      return false;
+    }
+    id = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+    return true;
+  }
+}
@@ -0,0 +1,359 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_partition.h>
+
+#include "AccessSchedule.h"
+#include "Config.h"
+#include "DenylistImage.h"
+#include "LeanHttpClient.h"
+#include "Metrics.h"
+#include "PlateId.h"
+#include "ServerDiscovery.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DENYLIST (stolen or banned vehicles)
+// ═══════════════════════════════════════════════════════════════════════════
+// Flagged plates are kept as sharded binary fuse filters in the "denylist"
+// partition, one shard per 4 KB sector (DenylistImage.h). The partition is
+// mapped once and probed in place: three byte reads per plate and 24 bytes
+// of RAM for the shard-valid bits, whatever the list size.
+//
+// A hit is only probable (1/256 false positives), so the device never acts
+// on it alone: it raises an alert and the server confirms it against the
+// exact list before anyone is notified. Shards with a bad CRC (e.g. after a
+// power cut mid-write) count as empty until the next sync rewrites them.
+
+class Denylist {
+public:
+  static constexpr uint32_t MAX_SHARDS = Config::DENYLIST_SHARDS;
+
+  static bool begin() {
+    if (handle_ != 0) {
+      return true;
+    }
+
+    partition_ = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, static_cast<esp_partition_subtype_t>(Config::DENYLIST_PARTITION_SUBTYPE),
+        Config::DENYLIST_PARTITION_LABEL);
+    if (partition_ == nullptr) {
+      Serial.println("[Denylist] No denylist partition");
+      return false;
+    }
+    shardCount_ = partition_->size / DenylistImage::SHARD_BYTES;
+    if (shardCount_ > MAX_SHARDS) {
+      shardCount_ = MAX_SHARDS;
+    }
+
+    const void* mapped = nullptr;
+    if (esp_partition_mmap(partition_, 0, shardCount_ * DenylistImage::SHARD_BYTES, SPI_FLASH_MMAP_DATA, &mapped,
+                           &handle_) != ESP_OK) {
+      Serial.println("[Denylist] Unable to map partition");
+      handle_ = 0;
+      return false;
+    }
+    base_ = static_cast<const uint8_t*>(mapped);
+
+    for (uint32_t shard = 0; shard < shardCount_; ++shard) {
+      setValid(shard, DenylistImage::shardValid(shardAt(shard), DenylistImage::SHARD_BYTES));
+    }
+    updateKeyCount();
+    Serial.printf("[Denylist] %u plates in %u shards\n", static_cast<unsigned>(keys_),
+                  static_cast<unsigned>(shardCount_));
+    return true;
+  }
+
+  static bool ready() {
+    return base_ != nullptr;
+  }
+
+  static uint32_t shardCount() {
+    return shardCount_;
+  }
+
+  // 0 for an empty or invalid shard, matching the manifest's "empty"
+  static uint32_t shardGeneration(uint32_t shard) {
+    return isValid(shard) ? header(shard).generation : 0;
+  }
+
+  // True for every listed plate and 1 in 256 others.
+  static bool mightContain(uint64_t plateId) {
+    if (plateId == PlateId::INVALID || !ready()) {
+      return false;
+    }
+    const uint32_t shard = DenylistImage::shardOf(plateId, shardCount_);
+    return isValid(shard) && DenylistImage::contains(shardAt(shard), plateId);
+  }
+
+  static bool mightContain(const char* plate) {
+    return mightContain(PlateId::pack(plate, Config::PLATE_MAX_LENGTH));
+  }
+
+  // Replaces one shard. An empty shard (generation 0) is just erased.
+  static bool writeShard(uint32_t shard, const uint8_t* data, size_t length) {
+    if (!ready() || shard >= shardCount_ || length > DenylistImage::SHARD_BYTES) {
+      return false;
+    }
+    const bool empty = length == 0;
+    if (!empty && !DenylistImage::shardValid(data, length)) {
+      return false;
+    }
+
+    // The sector is invalid from the erase until the write completes
+    setValid(shard, false);
+    const size_t offset = shard * DenylistImage::SHARD_BYTES;
+    if (esp_partition_erase_range(partition_, offset, DenylistImage::SHARD_BYTES) != ESP_OK ||
+        (!empty && esp_partition_write(partition_, offset, data, length) != ESP_OK)) {
+      Serial.printf("[Denylist] Flash write of shard %u failed\n", static_cast<unsigned>(shard));
+      updateKeyCount();
+      return false;
+    }
+
+    // The flash driver flushes the cache for the written range, so the
+    // mapping already shows the new bytes
+    setValid(shard, !empty && DenylistImage::shardValid(shardAt(shard), DenylistImage::SHARD_BYTES));
+    updateKeyCount();
+    return empty || isValid(shard);
+  }
+
+  // Flash used per plate and the expected false-positive rate
+  static void printStats(Print& out) {
+    uint32_t bytes = 0;
+    uint32_t shards = 0;
+    for (uint32_t shard = 0; shard < shardCount_; ++shard) {
+      if (isValid(shard) && header(shard).keys != 0) {
+        bytes += sizeof(DenylistImage::ShardHeader) + DenylistImage::params(header(shard)).arrayLength();
+        ++shards;
+      }
+    }
+    out.printf("[Denylist] %u plates, %u/%u shards, %u bytes flash (%.2f bits/plate), %u bytes RAM, fpr %.3f%%\n",
+               static_cast<unsigned>(keys_), static_cast<unsigned>(shards), static_cast<unsigned>(shardCount_),
+               static_cast<unsigned>(bytes), keys_ != 0 ? bytes * 8.0f / keys_ : 0.0f,
+               static_cast<unsigned>(sizeof(valid_)), 100.0f / 256);
+  }
+
+  // Times lookups of random plates and measures the false-positive rate.
+  static void bench(Print& out) {
+    if (!ready()) {
+      out.println("[Denylist] Not mapped");
+      return;
+    }
+    static constexpr uint32_t LOOKUPS = 20000;
+    uint32_t state = esp_random() | 1;
+    uint32_t hits = 0;
+    const uint32_t startUs = micros();
+    for (uint32_t i = 0; i < LOOKUPS; ++i) {
+      const uint64_t high = xorshift(state);
+      hits += mightContain((high << 32) | xorshift(state)) ? 1 : 0;
+    }
+    const uint32_t elapsedUs = micros() - startUs;
+    out.printf("[Denylist] lookup=%.0f ns, %u/%u random plates matched (fpr %.3f%%)\n",
+               elapsedUs * 1000.0f / LOOKUPS, static_cast<unsigned>(hits), static_cast<unsigned>(LOOKUPS),
+               hits * 100.0f / LOOKUPS);
+  }
+
+private:
+  static inline const esp_partition_t* partition_ = nullptr;
+  static inline spi_flash_mmap_handle_t handle_ = 0;
+  static inline const uint8_t* base_ = nullptr;
+  static inline uint32_t shardCount_ = 0;
+  static inline uint32_t keys_ = 0;
+  static inline uint32_t valid_[(MAX_SHARDS + 31) / 32] = {};
+
+  static uint32_t xorshift(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  static const uint8_t* shardAt(uint32_t shard) {
+    return base_ + shard * DenylistImage::SHARD_BYTES;
+  }
+
+  static const DenylistImage::ShardHeader& header(uint32_t shard) {
+    return *reinterpret_cast<const DenylistImage::ShardHeader*>(shardAt(shard));
+  }
+
+  static bool isValid(uint32_t shard) {
+    return shard < shardCount_ && (valid_[shard / 32] >> (shard % 32)) & 1;
+  }
+
+  static void setValid(uint32_t shard, bool valid) {
+    if (valid) {
+      valid_[shard / 32] |= 1u << (shard % 32);
+    } else {
+      valid_[shard / 32] &= ~(1u << (shard % 32));
+    }
+  }
+
+  static void updateKeyCount() {
+    keys_ = 0;
+    for (uint32_t shard = 0; shard < shardCount_; ++shard) {
+      keys_ += isValid(shard) ? header(shard).keys : 0;
+    }
+    Metrics::set(Metric::DenylistPlates, keys_);
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DENYLIST SYNC
+// ═══════════════════════════════════════════════════════════════════════════
+// Pulls shards from the recognition server (src/api/denylist.py) between
+// vehicles:
+//   GET /denylist/manifest     every DENYLIST_SYNC_INTERVAL_MS
+//   GET /denylist/shard/<i>    for each shard whose generation differs
+//   GET /schedule              when the manifest's schedule generation differs
+// One request per maintain() call, so the loop never stalls for more than
+// one 4 KB transfer plus a sector erase. A national list change typically
+// touches a few shards; only those are downloaded and rewritten.
+
+template <typename Transport>
+class DenylistSync {
+public:
+  void configure(const char* serverUrl) {
+    if (!http_.configure(serverUrl)) {
+      Serial.printf("[Denylist] Invalid server URL %s\n", serverUrl);
+    }
+  }
+
+  Transport& transport() {
+    return http_.transport();
+  }
+
+  const char* host() const {
+    return http_.host();
+  }
+
+  // Starts a sync at the next maintain() call
+  void requestSync() {
+    syncRequested_ = true;
+  }
+
+  void maintain(unsigned long nowMs) {
+    if (!Denylist::ready() || WiFi.status() != WL_CONNECTED) {
+      return;
+    }
+    if (Config::DISCOVERY_ENABLED) {
+      applyDiscoveredEndpoint();
+    }
+
+    if (schedulePending_) {
+      syncSchedule();
+    } else if (nextShard_ < Denylist::shardCount()) {
+      syncNextShard();
+    } else if (syncRequested_ || (nowMs - lastSyncMs_) >= Config::DENYLIST_SYNC_INTERVAL_MS) {
+      syncRequested_ = false;
+      lastSyncMs_ = nowMs;
+      fetchManifest();
+    }
+  }
+
+private:
+  LeanHttpClient<Transport> http_;
+  uint32_t target_[Denylist::MAX_SHARDS] = {};
+  uint32_t nextShard_ = Denylist::MAX_SHARDS;  // MAX_SHARDS: no sync running
+  uint32_t updated_ = 0;
+  uint32_t scheduleTarget_ = 0;
+  bool schedulePending_ = false;
+  unsigned long lastSyncMs_ = 0;
+  bool syncRequested_ = true;
+  uint32_t discoveryGeneration_ = 0;
+
+  // One shard plus the terminator LeanHttpClient appends. Aligned because
+  // the shard header is read in place.
+  alignas(8) static inline char body_[DenylistImage::SHARD_BYTES + 1];
+  static_assert(ScheduleImage::MAX_BYTES < sizeof(body_), "A schedule must fit the shard buffer");
+
+  void fetchManifest() {
+    http_.setPath("/denylist/manifest");
+    const int code = http_.get(body_, sizeof(body_), Config::DENYLIST_REQUEST_TIMEOUT_MS);
+    const size_t length = http_.bodyLength();
+
+    DenylistImage::ManifestHeader header = {};
+    if (length >= sizeof(header)) {
+      memcpy(&header, body_, sizeof(header));
+    }
+    if (code != 200 || header.magic != DenylistImage::MANIFEST_MAGIC ||
+        header.shardCount != Denylist::shardCount() || length != sizeof(header) + header.shardCount * 4) {
+      Serial.printf("[Denylist] Manifest fetch failed (%d)\n", code);
+      Metrics::add(Metric::DenylistSyncFailures);
+      return;
+    }
+    memcpy(target_, body_ + sizeof(header), header.shardCount * 4);
+    scheduleTarget_ = header.scheduleGeneration;
+    schedulePending_ = scheduleTarget_ != AccessSchedule::generation();
+    nextShard_ = 0;
+    updated_ = 0;
+  }
+
+  void syncNextShard() {
+    while (nextShard_ < Denylist::shardCount() && Denylist::shardGeneration(nextShard_) == target_[nextShard_]) {
+      ++nextShard_;
+    }
+    if (nextShard_ == Denylist::shardCount()) {
+      if (updated_ > 0) {
+        Serial.printf("[Denylist] Sync done, %u shards updated\n", static_cast<unsigned>(updated_));
+        Denylist::printStats(Serial);
+      }
+      return;
+    }
+
+    const uint32_t shard = nextShard_++;
+    bool written = false;
+    if (target_[shard] == 0) {
+      written = Denylist::writeShard(shard, nullptr, 0);
+    } else {
+      char path[32];
+      snprintf(path, sizeof(path), "/denylist/shard/%u", static_cast<unsigned>(shard));
+      http_.setPath(path);
+      const int code = http_.get(body_, sizeof(body_), Config::DENYLIST_REQUEST_TIMEOUT_MS);
+      const uint8_t* data = reinterpret_cast<const uint8_t*>(body_);
+      // A shard that changed again since the manifest is picked up next sync
+      written = code == 200 && http_.bodyLength() >= sizeof(DenylistImage::ShardHeader) &&
+                reinterpret_cast<const DenylistImage::ShardHeader*>(data)->generation == target_[shard] &&
+                Denylist::writeShard(shard, data, http_.bodyLength());
+    }
+
+    if (written) {
+      ++updated_;
+      Metrics::add(Metric::DenylistShardsSynced);
+    } else {
+      Serial.printf("[Denylist] Shard %u sync failed\n", static_cast<unsigned>(shard));
+      Metrics::add(Metric::DenylistSyncFailures);
+    }
+  }
+
+  void syncSchedule() {
+    // Whatever the outcome, a retry waits for the next manifest
+    schedulePending_ = false;
+    if (scheduleTarget_ == 0) {
+      AccessSchedule::clear();
+      Serial.println("[Schedule] Removed by the server");
+      return;
+    }
+
+    http_.setPath("/schedule");
+    const int code = http_.get(body_, sizeof(body_), Config::DENYLIST_REQUEST_TIMEOUT_MS);
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(body_);
+    if (code == 200 && http_.bodyLength() >= sizeof(ScheduleImage::Header) &&
+        reinterpret_cast<const ScheduleImage::Header*>(data)->generation == scheduleTarget_ &&
+        AccessSchedule::apply(data, http_.bodyLength())) {
+      Metrics::add(Metric::ScheduleSyncs);
+    } else {
+      Serial.printf("[Schedule] Fetch failed (%d)\n", code);
+      Metrics::add(Metric::DenylistSyncFailures);
+    }
+  }
+
+  void applyDiscoveredEndpoint() {
+    const uint32_t generation = ServerDiscovery::generation();
+    ServerDiscovery::Endpoint endpoint;
+    if (generation == discoveryGeneration_ || !ServerDiscovery::endpoint(endpoint)) {
+      return;
+    }
+    discoveryGeneration_ = generation;
+    http_.setEndpoint(IPAddress(endpoint.address), endpoint.port);
+  }
+};
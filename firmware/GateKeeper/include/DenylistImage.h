@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "AllowlistImage.h"
+#include "FuseFilter.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DENYLIST SHARD FORMAT
+// ═══════════════════════════════════════════════════════════════════════════
+// The denylist is split by PlateId hash into SHARD count binary fuse
+// filters, one per 4 KB flash sector, so a change to the list rewrites only
+// the shards whose plates changed. Each shard is a 32-byte header followed
+// by the filter's fingerprints. Its generation is a CRC of its sorted
+// plates, so the server needs no version state: a shard whose generation
+// differs from the manifest is out of date.
+//
+// The manifest lists every shard's generation:
+//   ManifestHeader, then uint32_t generation[shardCount]
+// A generation of 0 means an empty shard. All fields are little-endian.
+// The header also carries the access schedule's generation (0: none),
+// since the schedule is synced alongside (ScheduleImage.h).
+//
+// Pure C++, shared by the firmware and the host tools; src/api/denylist.py
+// builds the same bytes.
+
+namespace DenylistImage {
+  constexpr uint32_t SHARD_BYTES = 4096;  // One flash sector
+  constexpr uint32_t SHARD_MAGIC = 0x53444B47;     // "GKDS"
+  constexpr uint32_t MANIFEST_MAGIC = 0x4D444B47;  // "GKDM"
+  constexpr uint64_t SHARD_SALT = 0x5348415244ULL;
+
+  struct ShardHeader {
+    uint32_t magic;
+    uint32_t generation;
+    uint32_t keys;
+    uint32_t crc;  // CRC-32 (zlib) of the fingerprints
+    uint64_t seed;
+    uint32_t segmentLength;
+    uint32_t segmentCount;
+  };
+
+  struct ManifestHeader {
+    uint32_t magic;
+    uint32_t shardCount;
+    uint32_t keys;
+    uint32_t scheduleGeneration;
+  };
+
+  static_assert(sizeof(ShardHeader) == 32, "Shard layout is shared with src/api/denylist.py");
+  static_assert(sizeof(ManifestHeader) == 16, "Manifest layout is shared with src/api/denylist.py");
+
+  constexpr uint32_t MAX_FINGERPRINTS = SHARD_BYTES - sizeof(ShardHeader);
+
+  inline uint32_t shardOf(uint64_t plateId, uint32_t shardCount) {
+    return FuseFilter::mulHigh(FuseFilter::mix(plateId ^ SHARD_SALT), shardCount);
+  }
+
+  inline FuseFilter::Params params(const ShardHeader& header) {
+    return {header.seed, header.segmentLength, header.segmentCount};
+  }
+
+  // Checks everything but the CRC, so a header read from flash can be
+  // trusted for sizes before any fingerprint is touched.
+  inline bool headerValid(const ShardHeader& header) {
+    return header.magic == SHARD_MAGIC && header.segmentLength != 0 &&
+           (header.segmentLength & (header.segmentLength - 1)) == 0 &&
+           header.segmentLength <= FuseFilter::MAX_SEGMENT_LENGTH && header.segmentCount != 0 &&
+           header.segmentCount <= MAX_FINGERPRINTS && params(header).arrayLength() <= MAX_FINGERPRINTS;
+  }
+
+  inline bool shardValid(const uint8_t* shard, size_t bytes) {
+    if (bytes < sizeof(ShardHeader)) {
+      return false;
+    }
+    const ShardHeader& header = *reinterpret_cast<const ShardHeader*>(shard);
+    if (!headerValid(header)) {
+      return false;
+    }
+    const uint32_t length = params(header).arrayLength();
+    return sizeof(ShardHeader) + length <= bytes &&
+           AllowlistImage::crc32(shard + sizeof(ShardHeader), length) == header.crc;
+  }
+
+  inline bool contains(const uint8_t* shard, uint64_t plateId) {
+    const ShardHeader& header = *reinterpret_cast<const ShardHeader*>(shard);
+    return header.keys != 0 && FuseFilter::contains(params(header), shard + sizeof(ShardHeader), plateId);
+  }
+}
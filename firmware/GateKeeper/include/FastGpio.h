@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Arduino.h>
+#include <soc/gpio_reg.h>
+#include <soc/soc.h>
+
+#include "QemuHarness.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PIN-SPECIALIZED GPIO ACCESS
+// ═══════════════════════════════════════════════════════════════════════════
+// digitalRead() resolves the pin at run time on every call. With the pin as a
+// template argument the register and mask fold to constants and a read
+// becomes a single load, cheap enough for kHz sampling and safe to inline
+// into IRAM interrupt handlers. pinMode()/attachInterrupt() stay with the
+// Arduino core; only the hot read/write paths go to the registers.
+
+template <int Pin>
+struct FastGpio {
+  static_assert(Pin >= 0 && Pin < 40, "ESP32 GPIO numbers are 0-39");
+
+  static constexpr uint32_t MASK = 1UL << (Pin & 31);
+
+  static inline __attribute__((always_inline)) int read() {
+#ifdef GATEKEEPER_QEMU
+    return GpioStimulus::read(Pin);
+#else
+    return (REG_READ(Pin < 32 ? GPIO_IN_REG : GPIO_IN1_REG) & MASK) ? HIGH : LOW;
+#endif
+  }
+
+  // GPIO 34-39 are input-only, so writes are rejected at compile time.
+  static inline __attribute__((always_inline)) void write(int level) {
+    static_assert(Pin < 34, "GPIO 34-39 are input-only");
+    if (level) {
+      REG_WRITE(Pin < 32 ? GPIO_OUT_W1TS_REG : GPIO_OUT1_W1TS_REG, MASK);
+    } else {
+      REG_WRITE(Pin < 32 ? GPIO_OUT_W1TC_REG : GPIO_OUT1_W1TC_REG, MASK);
+    }
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// GPIO READ MICROBENCHMARK
+// ═══════════════════════════════════════════════════════════════════════════
+// Built only in the gpio_bench environment. Prints CPU cycles per sample for
+// digitalRead() against FastGpio so the sampling budget for fusion is known.
+
+#ifdef GATEKEEPER_GPIO_BENCH
+template <int Pin>
+void runGpioBenchmark() {
+  constexpr uint32_t SAMPLES = 10000;
+  volatile int sink = 0;
+
+  uint32_t start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < SAMPLES; ++i) {
+    sink += digitalRead(Pin);
+  }
+  const uint32_t arduinoCycles = ESP.getCycleCount() - start;
+
+  start = ESP.getCycleCount();
+  for (uint32_t i = 0; i < SAMPLES; ++i) {
+    sink += FastGpio<Pin>::read();
+  }
+  const uint32_t fastCycles = ESP.getCycleCount() - start;
+
+  Serial.printf("[Bench] GPIO %d read, %u samples: digitalRead %.1f cycles/sample, "
+                "FastGpio %.1f cycles/sample\n",
+                Pin, SAMPLES, static_cast<float>(arduinoCycles) / SAMPLES,
+                static_cast<float>(fastCycles) / SAMPLES);
+  (void)sink;
+}
+#endif
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <esp_partition.h>
+
+#include "Config.h"
+#include "LockFreeQueue.h"
+#include "Watchdog.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FIELD TRACE
+// ═══════════════════════════════════════════════════════════════════════════
+// Records what a lane really does so the host simulator can replay it
+// against changed firmware logic (tools/trace_import.py, then
+// tools/sim/lane_sim). Between `trace start` and `trace stop` the "trace"
+// partition collects 8-byte little-endian records:
+//
+//   time_us u32 | kind u8 | channel u8 | value u16
+//
+//   Start     value = format version
+//   Edge      channel = GPIO, value = raw level, from the sensor edge ISR
+//   Presence  value = fused presence after debouncing
+//   Request   the decision request was sent
+//   Decision  value = DecisionState of the outcome (Failed: no answer)
+//   Gate      value = 1 open, 0 close
+//   Dropped   value = records lost to a full queue just before this one
+//
+// time_us is micros() and wraps every 71 minutes; the importer unwraps it.
+// The ISRs and the loop both produce, so records pass through an MPSC
+// queue, and the loop appends them to flash from flush(). Pages are
+// written as they fill, and a partly filled page is topped up every
+// TRACE_FLUSH_MS, so a power cut loses at most that much. `trace start`
+// erases the whole partition up front so no write while recording waits
+// on a sector erase. Recording stops when the partition is full.
+
+enum class TraceKind : uint8_t { Start = 1, Edge, Presence, Request, Decision, Gate, Dropped };
+
+struct TraceRecord {
+  uint32_t timeUs;
+  uint8_t kind;
+  uint8_t channel;
+  uint16_t value;
+};
+static_assert(sizeof(TraceRecord) == 8, "The importer reads 8-byte records");
+
+class FieldTrace {
+public:
+  static constexpr uint16_t FORMAT_VERSION = 1;
+
+  static bool begin() {
+    partition_ = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, static_cast<esp_partition_subtype_t>(Config::TRACE_PARTITION_SUBTYPE),
+        Config::TRACE_PARTITION_LABEL);
+    if (partition_ == nullptr) {
+      Serial.println("[Trace] No trace partition");
+      return false;
+    }
+    return true;
+  }
+
+  static bool recording() {
+    return recording_;
+  }
+
+  // Blocks the loop for the erase; meant for a technician at the console
+  static bool start(Print& out) {
+    if (partition_ == nullptr || recording_) {
+      return false;
+    }
+    out.printf("[Trace] Erasing %u KB\n", static_cast<unsigned>(partition_->size / 1024));
+    Watchdog::feed();
+    if (esp_partition_erase_range(partition_, 0, partition_->size) != ESP_OK) {
+      out.println("[Trace] Erase failed");
+      return false;
+    }
+    Watchdog::feed();
+
+    TraceRecord discarded;
+    while (queue_.pop(discarded)) {
+    }
+    dropped_.store(0, std::memory_order_relaxed);
+    offset_ = 0;
+    pageUsed_ = 0;
+    pageWritten_ = 0;
+    lastWriteMs_ = millis();
+    recording_ = true;
+    record(TraceKind::Start, 0, FORMAT_VERSION);
+    return true;
+  }
+
+  static void stop() {
+    if (!recording_) {
+      return;
+    }
+    drain();
+    writePage();
+    recording_ = false;
+  }
+
+  static void record(TraceKind kind, uint8_t channel, uint16_t value) {
+    if (recording_) {
+      push({static_cast<uint32_t>(micros()), static_cast<uint8_t>(kind), channel, value});
+    }
+  }
+
+  static void IRAM_ATTR recordEdge(uint8_t pin, int level) {
+    if (recording_) {
+      push({static_cast<uint32_t>(micros()), static_cast<uint8_t>(TraceKind::Edge), pin,
+            static_cast<uint16_t>(level)});
+    }
+  }
+
+  // Once per loop pass
+  static void flush(unsigned long nowMs) {
+    if (!recording_) {
+      return;
+    }
+    drain();
+    if (recording_ && pageUsed_ > pageWritten_ && (nowMs - lastWriteMs_) >= Config::TRACE_FLUSH_MS) {
+      writePage();
+    }
+  }
+
+  static void printStatus(Print& out) {
+    if (partition_ == nullptr) {
+      out.println("[Trace] No trace partition");
+      return;
+    }
+    const size_t capacity = partition_->size / sizeof(TraceRecord);
+    const size_t used = offset_ / sizeof(TraceRecord) + pageUsed_;
+    out.printf("[Trace] %s, %u of %u records, partition at 0x%x\n", recording_ ? "recording" : "stopped",
+               static_cast<unsigned>(used), static_cast<unsigned>(capacity),
+               static_cast<unsigned>(partition_->address));
+  }
+
+private:
+  static constexpr size_t PAGE_RECORDS = 256 / sizeof(TraceRecord);  // One flash program page
+
+  static inline const esp_partition_t* partition_ = nullptr;
+  static inline volatile bool recording_ = false;
+  static inline MpscQueue<TraceRecord, Config::TRACE_QUEUE> queue_;
+  static inline std::atomic<uint32_t> dropped_{0};
+  // Page being filled; records before pageWritten_ are already in flash
+  static inline TraceRecord page_[PAGE_RECORDS];
+  static inline size_t pageUsed_ = 0;
+  static inline size_t pageWritten_ = 0;
+  static inline size_t offset_ = 0;
+  static inline unsigned long lastWriteMs_ = 0;
+
+  static void IRAM_ATTR push(const TraceRecord& record) {
+    if (!queue_.push(record)) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  static void drain() {
+    TraceRecord record;
+    while (recording_ && queue_.pop(record)) {
+      const uint32_t dropped = dropped_.exchange(0, std::memory_order_relaxed);
+      if (dropped > 0) {
+        append({record.timeUs, static_cast<uint8_t>(TraceKind::Dropped), 0,
+                static_cast<uint16_t>(dropped > 0xFFFF ? 0xFFFF : dropped)});
+      }
+      append(record);
+    }
+  }
+
+  static void append(const TraceRecord& record) {
+    if (!recording_) {
+      return;
+    }
+    page_[pageUsed_++] = record;
+    if (pageUsed_ == PAGE_RECORDS) {
+      writePage();
+    }
+  }
+
+  // Programs the records not yet in flash; a full page moves on to the next
+  static void writePage() {
+    if (pageUsed_ > pageWritten_) {
+      const size_t start = offset_ + pageWritten_ * sizeof(TraceRecord);
+      if (esp_partition_write(partition_, start, &page_[pageWritten_],
+                              (pageUsed_ - pageWritten_) * sizeof(TraceRecord)) != ESP_OK) {
+        Serial.println("[Trace] Flash write failed, recording stopped");
+        recording_ = false;
+        return;
+      }
+      pageWritten_ = pageUsed_;
+      lastWriteMs_ = millis();
+    }
+    if (pageUsed_ == PAGE_RECORDS) {
+      offset_ += sizeof(page_);
+      pageUsed_ = 0;
+      pageWritten_ = 0;
+      if (offset_ + sizeof(page_) > partition_->size) {
+        Serial.println("[Trace] Partition full, recording stopped");
+        recording_ = false;
+      }
+    }
+  }
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+#include "Config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FIXED-CAPACITY STRING
+// ═══════════════════════════════════════════════════════════════════════════
+// Replaces Arduino String for per-event text (plates, payloads) so the steady
+// state never touches the heap. Input longer than Capacity is truncated.
+
+template <size_t Capacity>
+class FixedString {
+public:
+  FixedString() {
+    clear();
+  }
+
+  void clear() {
+    length_ = 0;
+    data_[0] = '\0';
+  }
+
+  void assign(const char* text, size_t length) {
+    length_ = length < Capacity ? length : Capacity;
+    memcpy(data_, text, length_);
+    data_[length_] = '\0';
+  }
+
+  void assign(const char* text) {
+    assign(text, strlen(text));
+  }
+
+  const char* c_str() const {
+    return data_;
+  }
+
+  size_t length() const {
+    return length_;
+  }
+
+  bool empty() const {
+    return length_ == 0;
+  }
+
+  static constexpr size_t capacity() {
+    return Capacity;
+  }
+
+private:
+  char data_[Capacity + 1];
+  size_t length_;
+};
+
+using PlateText = FixedString<Config::PLATE_MAX_LENGTH>;
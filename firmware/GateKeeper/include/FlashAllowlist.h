@@ -0,0 +1,243 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#include "AllowlistImage.h"
+#include "Config.h"
+#include "Metrics.h"
+#include "PerfectHash.h"
+#include "PlateId.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FLASH ALLOWLIST
+// ═══════════════════════════════════════════════════════════════════════════
+// Registered plates live in the "allowlist" data partition (partitions.csv)
+// as an image written by tools/allowlist_image.py. The image is mapped into
+// the data address space once and searched in place through the flash
+// cache, so a full partition costs the same RAM as ten plates: the mapping
+// handle and a pointer. The CRC is checked once when the image is mapped,
+// never per lookup.
+//
+// Either image layout works: Eytzinger (8 bytes per plate, exact, up to
+// about 188k plates in the 1.44 MB partition) or the minimal perfect hash
+// (about 20 bits per plate, constant time, 2^-16 false positives, about
+// 600k). A profile table costs one more byte per plate. Lookups need no network, so they can run on the
+// vehicle path. Compare layouts and sizes with `allow bench` on the
+// device and tools/bench/allowlist_bench on the host.
+//
+// An image built with profiles also gives each plate its access schedule
+// profile (AccessSchedule.h), read from the byte at the entry's index.
+
+class FlashAllowlist {
+public:
+  // Maps and validates the image. A blank or corrupt partition leaves the
+  // allowlist empty, not the firmware broken.
+  static bool begin() {
+    if (handle_ != 0) {
+      return true;
+    }
+
+    const esp_partition_t* partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, static_cast<esp_partition_subtype_t>(Config::ALLOWLIST_PARTITION_SUBTYPE),
+        Config::ALLOWLIST_PARTITION_LABEL);
+    if (partition == nullptr) {
+      Serial.println("[Allowlist] No allowlist partition");
+      return false;
+    }
+
+    AllowlistHeader header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK || !headerValid(header, *partition)) {
+      Serial.println("[Allowlist] No valid image in partition");
+      return false;
+    }
+
+    const void* mapped = nullptr;
+    if (esp_partition_mmap(partition, 0, sizeof(header) + header.dataBytes + header.profileBytes,
+                           SPI_FLASH_MMAP_DATA, &mapped, &handle_) != ESP_OK) {
+      Serial.println("[Allowlist] Unable to map partition");
+      handle_ = 0;
+      return false;
+    }
+
+    const uint8_t* data = static_cast<const uint8_t*>(mapped) + sizeof(header);
+    if (AllowlistImage::crc32(data, header.dataBytes) != header.dataCrc ||
+        AllowlistImage::crc32(data + header.dataBytes, header.profileBytes) != header.profileCrc) {
+      Serial.println("[Allowlist] Image CRC mismatch");
+      end();
+      return false;
+    }
+
+    layout_ = static_cast<AllowlistLayout>(header.layout);
+    if (layout_ == AllowlistLayout::PerfectHash && !perfectHash_.attach(data, header.dataBytes, header.count)) {
+      Serial.println("[Allowlist] Bad perfect hash table");
+      end();
+      return false;
+    }
+    keys_ = reinterpret_cast<const uint64_t*>(data);
+    profiles_ = header.profileBytes != 0 ? data + header.dataBytes : nullptr;
+    count_ = header.count;
+    partitionBytes_ = partition->size;
+    Metrics::set(Metric::AllowlistEntries, count_);
+    Serial.printf("[Allowlist] %u plates mapped (%s, %.1f bits each%s), generation %u\n",
+                  static_cast<unsigned>(count_), layoutName(), header.dataBytes * 8.0f / (count_ ? count_ : 1),
+                  profiles_ != nullptr ? ", with profiles" : "", static_cast<unsigned>(header.generation));
+    return true;
+  }
+
+  static void end() {
+    if (handle_ != 0) {
+      spi_flash_munmap(handle_);
+    }
+    handle_ = 0;
+    keys_ = nullptr;
+    profiles_ = nullptr;
+    count_ = 0;
+    Metrics::set(Metric::AllowlistEntries, 0);
+  }
+
+  // Picks up an image re-flashed while running (e.g. after a server
+  // invalidation and a parttool write).
+  static bool reload() {
+    end();
+    return begin();
+  }
+
+  static bool ready() {
+    return keys_ != nullptr;
+  }
+
+  static uint32_t count() {
+    return count_;
+  }
+
+  static bool contains(uint64_t plateId) {
+    if (plateId == PlateId::INVALID || !ready()) {
+      return false;
+    }
+    return layout_ == AllowlistLayout::PerfectHash ? perfectHash_.contains(plateId)
+                                                   : Eytzinger::contains(keys_, count_, plateId);
+  }
+
+  static bool contains(const char* plate) {
+    return contains(PlateId::pack(plate, Config::PLATE_MAX_LENGTH));
+  }
+
+  // Like contains(), also returning the entry's schedule profile (0 when
+  // the image has no profile table).
+  static bool lookup(uint64_t plateId, uint8_t& profile) {
+    profile = 0;
+    if (plateId == PlateId::INVALID || !ready()) {
+      return false;
+    }
+    const uint32_t index = layout_ == AllowlistLayout::PerfectHash ? perfectHash_.find(plateId)
+                                                                   : Eytzinger::find(keys_, count_, plateId);
+    if (index >= count_) {
+      return false;
+    }
+    profile = profiles_ != nullptr ? profiles_[index] : 0;
+    return true;
+  }
+
+  static bool lookup(const char* plate, uint8_t& profile) {
+    return lookup(PlateId::pack(plate, Config::PLATE_MAX_LENGTH), profile);
+  }
+
+  static void bench(Print& out) {
+    if (!ready()) {
+      out.println("[Allowlist] No image mapped");
+    } else if (layout_ == AllowlistLayout::PerfectHash) {
+      benchPerfectHash(out);
+    } else {
+      benchEytzinger(out);
+    }
+  }
+
+private:
+  static constexpr uint32_t BENCH_LOOKUPS = 20000;
+
+  static inline spi_flash_mmap_handle_t handle_ = 0;
+  static inline AllowlistLayout layout_ = AllowlistLayout::Eytzinger;
+  static inline const uint64_t* keys_ = nullptr;
+  static inline const uint8_t* profiles_ = nullptr;
+  static inline PerfectHash::View perfectHash_;
+  static inline uint32_t count_ = 0;
+  static inline uint32_t partitionBytes_ = 0;
+
+  static const char* layoutName() {
+    return layout_ == AllowlistLayout::PerfectHash ? "perfect hash" : "eytzinger";
+  }
+
+  // Times hits and near-misses at 10k, 50k and 200k entries. Any prefix of
+  // the Eytzinger array is a valid tree, so one full image covers each size.
+  // 200k plates only fit the partition as a perfect hash: flash a 200k mph
+  // image to time that size.
+  static void benchEytzinger(Print& out) {
+    static constexpr uint32_t SIZES[] = {10000, 50000, 200000};
+    for (const uint32_t size : SIZES) {
+      if (size > count_) {
+        out.printf("[Allowlist] n=%u skipped (image has %u%s)\n", static_cast<unsigned>(size),
+                   static_cast<unsigned>(count_), size * sizeof(uint64_t) > partitionBytes_ ? ", needs an mph image" : "");
+        continue;
+      }
+
+      uint32_t hits = 0;
+      uint32_t state = esp_random() | 1;
+      uint32_t startUs = micros();
+      for (uint32_t i = 0; i < BENCH_LOOKUPS; ++i) {
+        hits += Eytzinger::contains(keys_, size, keys_[xorshift(state) % size]) ? 1 : 0;
+      }
+      const uint32_t hitUs = micros() - startUs;
+
+      // Neighbours of members walk the full depth and are almost never members
+      uint32_t misses = 0;
+      startUs = micros();
+      for (uint32_t i = 0; i < BENCH_LOOKUPS; ++i) {
+        misses += Eytzinger::contains(keys_, size, keys_[xorshift(state) % size] + 1) ? 0 : 1;
+      }
+      const uint32_t missUs = micros() - startUs;
+
+      out.printf("[Allowlist] n=%u hit=%.0f ns miss=%.0f ns (%u/%u hits, %u/%u misses)\n",
+                 static_cast<unsigned>(size), hitUs * 1000.0f / BENCH_LOOKUPS, missUs * 1000.0f / BENCH_LOOKUPS,
+                 static_cast<unsigned>(hits), static_cast<unsigned>(BENCH_LOOKUPS), static_cast<unsigned>(misses),
+                 static_cast<unsigned>(BENCH_LOOKUPS));
+    }
+  }
+
+  // The image holds no keys, so members cannot be drawn from it. A random
+  // plate costs the same as a member once it reaches a fingerprint compare,
+  // which most do; the rest stop after the last level.
+  static void benchPerfectHash(Print& out) {
+    uint32_t state = esp_random() | 1;
+    uint32_t falsePositives = 0;
+    const uint32_t startUs = micros();
+    for (uint32_t i = 0; i < BENCH_LOOKUPS; ++i) {
+      const uint64_t high = xorshift(state);
+      falsePositives += perfectHash_.contains((high << 32) | xorshift(state)) ? 1 : 0;
+    }
+    const uint32_t elapsedUs = micros() - startUs;
+
+    out.printf("[Allowlist] n=%u levels=%u lookup=%.0f ns (%u/%u false positives)\n", static_cast<unsigned>(count_),
+               static_cast<unsigned>(perfectHash_.levels()), elapsedUs * 1000.0f / BENCH_LOOKUPS,
+               static_cast<unsigned>(falsePositives), static_cast<unsigned>(BENCH_LOOKUPS));
+  }
+
+  // Cheap enough not to show up in the timings, unlike esp_random()
+  static uint32_t xorshift(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  // The perfect hash data is checked by View::attach() once mapped.
+  static bool headerValid(const AllowlistHeader& header, const esp_partition_t& partition) {
+    const bool layoutValid =
+        header.layout == static_cast<uint16_t>(AllowlistLayout::Eytzinger)
+            ? header.dataBytes == header.count * sizeof(uint64_t)
+            : header.layout == static_cast<uint16_t>(AllowlistLayout::PerfectHash);
+    return header.magic == AllowlistImage::MAGIC && header.version == AllowlistImage::VERSION && layoutValid &&
+           (header.profileBytes == 0 || header.profileBytes == header.count) &&
+           sizeof(header) + header.dataBytes + header.profileBytes <= partition.size;
+  }
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// BINARY FUSE FILTER (8-bit fingerprints)
+// ═══════════════════════════════════════════════════════════════════════════
+// Static approximate set (Graf & Lemire, "Binary Fuse Filters", 2022). A key
+// maps to three slots in consecutive segments of the array; it is reported
+// present when the XOR of those three bytes equals its fingerprint. Members
+// always match; other keys match with probability 1/256. Space is about
+// 9 bits per key for large sets, rising towards 11 for a few thousand keys.
+//
+// The filter cannot be updated in place. Callers that need updates keep
+// many small filters and rebuild only the one that changed (Denylist.h).
+//
+// Pure C++, shared by the firmware and the host tools. The builder is only
+// used on the host; src/api/denylist.py has a Python port.
+
+namespace FuseFilter {
+  constexpr uint32_t MAX_SEGMENT_LENGTH = 1u << 18;
+
+  struct Params {
+    uint64_t seed;
+    uint32_t segmentLength;  // Power of two
+    uint32_t segmentCount;
+
+    uint32_t arrayLength() const {
+      return (segmentCount + 2) * segmentLength;
+    }
+  };
+
+  // murmur3 fmix64
+  inline uint64_t mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  // High 64 bits of hash * n, without a 128-bit type (none on Xtensa)
+  inline uint32_t mulHigh(uint64_t hash, uint32_t n) {
+    const uint64_t low = (hash & 0xFFFFFFFFULL) * n;
+    const uint64_t high = (hash >> 32) * n;
+    return static_cast<uint32_t>((high + (low >> 32)) >> 32);
+  }
+
+  inline uint8_t fingerprint(uint64_t hash) {
+    return static_cast<uint8_t>(hash ^ (hash >> 32));
+  }
+
+  inline void slots(uint64_t hash, const Params& params, uint32_t out[3]) {
+    const uint32_t mask = params.segmentLength - 1;
+    out[0] = mulHigh(hash, params.segmentCount * params.segmentLength);
+    out[1] = (out[0] + params.segmentLength) ^ (static_cast<uint32_t>(hash >> 18) & mask);
+    out[2] = (out[0] + 2 * params.segmentLength) ^ (static_cast<uint32_t>(hash) & mask);
+  }
+
+  inline bool contains(const Params& params, const uint8_t* fingerprints, uint64_t key) {
+    const uint64_t hash = mix(key + params.seed);
+    uint32_t at[3];
+    slots(hash, params, at);
+    return (fingerprint(hash) ^ fingerprints[at[0]] ^ fingerprints[at[1]] ^ fingerprints[at[2]]) == 0;
+  }
+
+  // Array geometry for n keys, as in the reference implementation
+  inline Params sizeFor(uint32_t n) {
+    Params params = {};
+    const double logN = n > 1 ? log(static_cast<double>(n)) : 0.0;
+    params.segmentLength = 1u << static_cast<int>(floor(logN / log(3.33) + 2.25));
+    if (params.segmentLength > MAX_SEGMENT_LENGTH) {
+      params.segmentLength = MAX_SEGMENT_LENGTH;
+    }
+    const double sizeFactor = n > 1 ? fmax(1.125, 0.875 + 0.25 * log(1e6) / logN) : 0.0;
+    const int64_t capacity = static_cast<int64_t>(round(n * sizeFactor));
+    const int64_t segments = (capacity + params.segmentLength - 1) / params.segmentLength - 2;
+    params.segmentCount = segments > 0 ? static_cast<uint32_t>(segments) : 1;
+    return params;
+  }
+
+  inline uint64_t splitmix(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  // Builds a filter over distinct keys by peeling: a slot used by exactly one
+  // remaining key fixes that key's last free slot, so keys are removed one at
+  // a time and assigned in reverse. Fails only for duplicate keys, or when
+  // every seed tried leaves a cycle.
+  inline bool build(const uint64_t* keys, uint32_t n, uint64_t seedState, Params& params,
+                    std::vector<uint8_t>& fingerprints, int attempts = 64) {
+    params = sizeFor(n);
+    const uint32_t length = params.arrayLength();
+    std::vector<uint32_t> counts(length);
+    std::vector<uint64_t> hashes(length);
+    std::vector<uint32_t> queue;
+    std::vector<uint64_t> peeledHash;
+    std::vector<uint32_t> peeledSlot;
+
+    for (int attempt = 0; attempt < attempts; ++attempt) {
+      params.seed = splitmix(seedState);
+      counts.assign(length, 0);
+      hashes.assign(length, 0);
+      for (uint32_t i = 0; i < n; ++i) {
+        const uint64_t hash = mix(keys[i] + params.seed);
+        uint32_t at[3];
+        slots(hash, params, at);
+        for (const uint32_t slot : at) {
+          ++counts[slot];
+          hashes[slot] ^= hash;
+        }
+      }
+
+      queue.clear();
+      for (uint32_t slot = 0; slot < length; ++slot) {
+        if (counts[slot] == 1) {
+          queue.push_back(slot);
+        }
+      }
+      peeledHash.clear();
+      peeledSlot.clear();
+      while (!queue.empty()) {
+        const uint32_t slot = queue.back();
+        queue.pop_back();
+        if (counts[slot] != 1) {
+          continue;
+        }
+        const uint64_t hash = hashes[slot];
+        peeledHash.push_back(hash);
+        peeledSlot.push_back(slot);
+        uint32_t at[3];
+        slots(hash, params, at);
+        for (const uint32_t other : at) {
+          --counts[other];
+          hashes[other] ^= hash;
+          if (counts[other] == 1) {
+            queue.push_back(other);
+          }
+        }
+      }
+      if (peeledHash.size() != n) {
+        continue;
+      }
+
+      fingerprints.assign(length, 0);
+      for (size_t i = peeledHash.size(); i-- > 0;) {
+        uint32_t at[3];
+        slots(peeledHash[i], params, at);
+        fingerprints[peeledSlot[i]] =
+            fingerprint(peeledHash[i]) ^ fingerprints[at[0]] ^ fingerprints[at[1]] ^ fingerprints[at[2]];
+      }
+      return true;
+    }
+    return false;
+  }
+}
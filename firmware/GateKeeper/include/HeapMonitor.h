@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+#include "Metrics.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// HEAP MONITOR
+// ═══════════════════════════════════════════════════════════════════════════
+// Free, minimum-ever-free and largest-block gauges; a shrinking largest block
+// at constant free space is the fragmentation signature that precedes the
+// out-of-memory reboots.
+
+class HeapMonitor {
+public:
+  static void sample() {
+    Metrics::set(Metric::HeapFree, heap_caps_get_free_size(MALLOC_CAP_8BIT));
+    Metrics::set(Metric::HeapMinFree, heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT));
+    Metrics::set(Metric::HeapLargestBlock, heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// HEAP TRIPWIRE (heap_tripwire BUILD ONLY)
+// ═══════════════════════════════════════════════════════════════════════════
+// malloc/calloc/realloc and operator new are wrapped at link time (see
+// src/HeapTripwire.cpp). Once armed at the end of setup(), every allocation
+// made by the app task records its size and caller; report() prints them from
+// the loop, outside the allocator. Resolve callers with
+// `xtensa-esp32-elf-addr2line -e .pio/build/heap_tripwire/firmware.elf ADDR`.
+// Wi-Fi and lwIP tasks allocate per packet by design and are not tracked.
+
+class HeapTripwire {
+public:
+#ifdef GATEKEEPER_HEAP_TRIPWIRE
+  static void arm();
+  static void report(Print& out);
+  static uint32_t allocationCount();
+#else
+  static void arm() {}
+  static void report(Print&) {}
+  static uint32_t allocationCount() {
+    return 0;
+  }
+#endif
+};
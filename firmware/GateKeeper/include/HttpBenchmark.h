@@ -0,0 +1,203 @@
+#pragma once
+
+// ═══════════════════════════════════════════════════════════════════════════
+// HTTP CLIENT BENCHMARK (http_bench BUILD ONLY)
+// ═══════════════════════════════════════════════════════════════════════════
+// `bench [n]` issues n recognition GETs through Arduino HTTPClient and then
+// through LeanHttpClient against the configured server, and prints latency
+// and heap allocations per request. Allocations are counted by the heap
+// tripwire, which the http_bench environment links in.
+//
+// `tls [n]` opens n TLS connections to the configured host with a fresh
+// session each time, then n more resuming the cached session, and prints the
+// handshake time of both. Point it at the API started with API_SSL_CERTFILE
+// and API_SSL_KEYFILE to measure against a local TLS server.
+//
+// `udp [n]` compares n decisions over keep-alive HTTP with n over the UDP
+// decision protocol. Both include the server's recognition time; start the
+// API with LPR_STUB_PLATE set to measure the transports alone.
+//
+// `mqtt [n]` does the same for MQTT trigger-to-decision through the broker,
+// as gate "bench" so the gate's own session is left alone. It needs the
+// API's MQTT bridge and LPR_STUB_PLATE, since a denied decision counts as
+// failed.
+
+#ifdef GATEKEEPER_HTTP_BENCH
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <algorithm>
+
+#include "Config.h"
+#include "HeapMonitor.h"
+#include "LeanHttpClient.h"
+#include "MqttDecisionTransport.h"
+#include "NonBlockingClient.h"
+#include "TlsClient.h"
+#include "UdpDecisionClient.h"
+#include "Watchdog.h"
+
+class HttpBenchmark {
+public:
+  static void onCommand(void*, const char* args, Print& out) {
+    const uint32_t requests = args[0] != '\0' ? strtoul(args, nullptr, 10) : 20;
+    if (requests == 0) {
+      return;
+    }
+
+    run(out, "HTTPClient", requests, [] {
+      HTTPClient http;
+      http.begin(Config::WEBHOOK_URL);
+      http.setTimeout(Config::HTTP_TIMEOUT_MS);
+      const int code = http.GET();
+      if (code > 0) {
+        http.getString();
+      }
+      http.end();
+      return code;
+    });
+
+    static LeanHttpClient<NonBlockingClient> lean;
+    lean.configure(Config::WEBHOOK_URL);
+    run(out, "LeanHttpClient", requests, [] {
+      static char body[Config::HTTP_BODY_BUFFER_SIZE];
+      return lean.get(body, sizeof(body), Config::HTTP_TIMEOUT_MS);
+    });
+  }
+
+  static void onUdpCommand(void*, const char* args, Print& out) {
+    const uint32_t requests = args[0] != '\0' ? strtoul(args, nullptr, 10) : 20;
+    if (requests == 0) {
+      return;
+    }
+
+    static LeanHttpClient<NonBlockingClient> http;
+    http.configure(Config::WEBHOOK_URL);
+    run(out, "HTTP keep-alive", requests, [] {
+      static char body[Config::HTTP_BODY_BUFFER_SIZE];
+      return http.get(body, sizeof(body), Config::HTTP_TIMEOUT_MS);
+    });
+
+    static UdpDecisionClient udp;
+    udp.configure(http.host(), Config::UDP_DECISION_PORT, Config::UDP_DECISION_KEY);
+    run(out, "UDP", requests, [] {
+      return udp.decide(Config::HTTP_TIMEOUT_MS) == UdpDecisionClient::Status::Done ? 200 : -1;
+    });
+    http.disconnect();
+  }
+
+  static void onMqttCommand(void*, const char* args, Print& out) {
+    const uint32_t requests = args[0] != '\0' ? strtoul(args, nullptr, 10) : 20;
+    if (requests == 0) {
+      return;
+    }
+
+    static LeanHttpClient<NonBlockingClient> http;
+    http.configure(Config::WEBHOOK_URL);
+    run(out, "HTTP keep-alive", requests, [] {
+      static char body[Config::HTTP_BODY_BUFFER_SIZE];
+      return http.get(body, sizeof(body), Config::HTTP_TIMEOUT_MS);
+    });
+    http.disconnect();
+
+    static MqttDecisionTransport mqtt("bench");
+    static bool initialized = false;
+    if (!initialized) {
+      mqtt.initialize();
+      initialized = true;
+    }
+    // Connected before timing starts, so the first sample is not a connect
+    mqtt.warmUp();
+    const unsigned long connectStartMs = millis();
+    while (!mqtt.connected() && (millis() - connectStartMs) < Config::MQTT_CONNECT_TIMEOUT_MS) {
+      mqtt.maintain(millis());
+      Watchdog::feed();
+      delay(1);
+    }
+    run(out, "MQTT", requests, [] {
+      PlateText plate;
+      mqtt.startDecision(millis());
+      DecisionState state;
+      while ((state = mqtt.pollDecision(millis(), plate)) == DecisionState::Pending) {
+        Watchdog::feed();
+        delay(1);
+      }
+      return state == DecisionState::Accepted ? 200 : -1;
+    });
+  }
+
+  static void onTlsCommand(void*, const char* args, Print& out) {
+    const uint32_t handshakes = args[0] != '\0' ? strtoul(args, nullptr, 10) : 10;
+    if (handshakes == 0) {
+      return;
+    }
+
+    static LeanHttpClient<TlsClient> tls;
+    tls.configure(Config::WEBHOOK_URL);
+    tls.transport().setHostname(tls.host());
+    tls.transport().setCaCert(Config::WEBHOOK_CA_CERT);
+
+    for (const bool resume : {false, true}) {
+      uint32_t totalUs = 0;
+      uint32_t maxUs = 0;
+      uint32_t failures = 0;
+      uint32_t resumed = 0;
+      for (uint32_t i = 0; i < handshakes; ++i) {
+        tls.disconnect();
+        if (!resume) {
+          tls.transport().forgetSession();
+        }
+        if (!tls.connect()) {
+          ++failures;
+          continue;
+        }
+        resumed += tls.transport().lastHandshakeResumed() ? 1 : 0;
+        const uint32_t elapsedUs = tls.transport().lastHandshakeUs();
+        totalUs += elapsedUs;
+        maxUs = elapsedUs > maxUs ? elapsedUs : maxUs;
+      }
+      const uint32_t completed = handshakes - failures;
+      out.printf("[Bench] TLS %-10s n=%u mean=%.2f ms max=%.2f ms failed=%u resumed=%u\n",
+                 resume ? "resumed" : "full", static_cast<unsigned>(handshakes),
+                 completed > 0 ? totalUs / 1000.0f / completed : 0.0f, maxUs / 1000.0f,
+                 static_cast<unsigned>(failures), static_cast<unsigned>(resumed));
+    }
+    tls.disconnect();
+  }
+
+private:
+  // Percentiles are taken over the first MAX_SAMPLES requests of a run.
+  static constexpr uint32_t MAX_SAMPLES = 256;
+  static inline uint32_t samplesUs_[MAX_SAMPLES];
+
+  template <typename Request>
+  static void run(Print& out, const char* label, uint32_t requests, Request request) {
+    uint32_t totalUs = 0;
+    uint32_t maxUs = 0;
+    uint32_t failures = 0;
+    const uint32_t allocationsBefore = HeapTripwire::allocationCount();
+
+    for (uint32_t i = 0; i < requests; ++i) {
+      const uint32_t startUs = micros();
+      if (request() != 200) {
+        ++failures;
+      }
+      const uint32_t elapsedUs = micros() - startUs;
+      totalUs += elapsedUs;
+      maxUs = elapsedUs > maxUs ? elapsedUs : maxUs;
+      if (i < MAX_SAMPLES) {
+        samplesUs_[i] = elapsedUs;
+      }
+    }
+
+    const uint32_t sampled = requests < MAX_SAMPLES ? requests : MAX_SAMPLES;
+    std::sort(samplesUs_, samplesUs_ + sampled);
+    const uint32_t allocations = HeapTripwire::allocationCount() - allocationsBefore;
+    out.printf("[Bench] %-15s n=%u mean=%.2f p50=%.2f p99=%.2f max=%.2f ms allocs/req=%.1f failed=%u\n", label,
+               static_cast<unsigned>(requests), totalUs / 1000.0f / requests,
+               samplesUs_[sampled / 2] / 1000.0f, samplesUs_[(sampled * 99) / 100] / 1000.0f, maxUs / 1000.0f,
+               static_cast<float>(allocations) / requests, static_cast<unsigned>(failures));
+  }
+};
+
+#endif
@@ -0,0 +1,385 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "Config.h"
+#include "Watchdog.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// LEAN HTTP/1.1 CLIENT
+// ═══════════════════════════════════════════════════════════════════════════
+// Purpose-built for the recognition GET and a few side GETs to the same
+// server (setPath). The URL is parsed and the request bytes are built once
+// per path; the connection is kept alive with Nagle disabled. Only the
+// status line, Content-Length and Connection headers are parsed and the body
+// lands in a caller-provided buffer, so a request makes no heap allocation
+// of its own.
+//
+// Requests are split into begin() and poll() so callers can keep the loop
+// running while the server works; get() wraps both for blocking use. With
+// no open connection begin() only starts one, and poll() sends the request
+// once it is up.
+// Connections likewise split into startConnect() and pollConnect(), which
+// bounds the lookup, connect and any handshake by SERVER_CONNECT_TIMEOUT_MS;
+// connect() wraps them. Transport is NonBlockingClient or any class with
+// the same startConnect/pollConnect/write/read API.
+
+template <typename Transport>
+class LeanHttpClient {
+public:
+  enum class Status { Idle, Pending, Done, Failed };
+  using ConnectStatus = typename Transport::ConnectStatus;
+
+  bool configure(const char* url) {
+    const char* cursor = url;
+    if (strncmp(cursor, "http://", 7) == 0) {
+      cursor += 7;
+      port_ = 80;
+    } else if (strncmp(cursor, "https://", 8) == 0) {
+      cursor += 8;
+      port_ = 443;
+    } else {
+      return false;
+    }
+
+    const char* hostEnd = cursor;
+    while (*hostEnd != '\0' && *hostEnd != ':' && *hostEnd != '/') {
+      ++hostEnd;
+    }
+    const size_t hostLength = hostEnd - cursor;
+    if (hostLength == 0 || hostLength >= sizeof(host_)) {
+      return false;
+    }
+    memcpy(host_, cursor, hostLength);
+    host_[hostLength] = '\0';
+
+    if (*hostEnd == ':') {
+      port_ = static_cast<uint16_t>(strtoul(hostEnd + 1, nullptr, 10));
+    }
+    const char* path = strchr(hostEnd, '/');
+    const int pathLength = snprintf(path_, sizeof(path_), "%s", path != nullptr ? path : "/");
+    if (pathLength <= 0 || static_cast<size_t>(pathLength) >= sizeof(path_) || !setPath(nullptr)) {
+      return false;
+    }
+    address_ = IPAddress();
+    return true;
+  }
+
+  // Requests another path on the same server and connection; nullptr goes
+  // back to the configured URL's path. Call between requests only.
+  bool setPath(const char* path) {
+    const int length = snprintf(request_, sizeof(request_),
+                                "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: keep-alive\r\n\r\n",
+                                path != nullptr ? path : path_, host_);
+    if (length <= 0 || static_cast<size_t>(length) >= sizeof(request_)) {
+      return false;
+    }
+    requestLength_ = length;
+    return true;
+  }
+
+  const char* host() const {
+    return host_;
+  }
+
+  uint16_t port() const {
+    return port_;
+  }
+
+  // Overrides the URL host's address, e.g. with a discovered server. The Host
+  // header keeps the configured name. A change drops the open connection.
+  void setEndpoint(IPAddress address, uint16_t port) {
+    if (static_cast<uint32_t>(address) == static_cast<uint32_t>(address_) && port == port_) {
+      return;
+    }
+    address_ = address;
+    port_ = port;
+    disconnect();
+  }
+
+  Transport& transport() {
+    return transport_;
+  }
+
+  // Starts opening the connection outside a request, e.g. right after boot,
+  // without waiting on it. Does nothing while the connection is open or
+  // already being opened.
+  bool startConnect(unsigned long nowMs) {
+    if (connecting_ || transport_.connected()) {
+      return true;
+    }
+    transport_.stop();
+
+    char address[16];
+    const char* host = host_;
+    if (static_cast<uint32_t>(address_) != 0) {
+      snprintf(address, sizeof(address), "%u.%u.%u.%u", address_[0], address_[1], address_[2], address_[3]);
+      host = address;
+    }
+    if (!transport_.startConnect(host, port_)) {
+      return false;
+    }
+    connecting_ = true;
+    connectStartedMs_ = nowMs;
+    return true;
+  }
+
+  ConnectStatus pollConnect(unsigned long nowMs) {
+    if (!connecting_) {
+      return transport_.connected() ? ConnectStatus::Connected : ConnectStatus::Failed;
+    }
+    ConnectStatus status = transport_.pollConnect();
+    if (status == ConnectStatus::Pending && (nowMs - connectStartedMs_) >= Config::SERVER_CONNECT_TIMEOUT_MS) {
+      transport_.stop();
+      status = ConnectStatus::Failed;
+    }
+    if (status != ConnectStatus::Pending) {
+      connecting_ = false;
+    }
+    if (status == ConnectStatus::Connected) {
+      transport_.setNoDelay(true);
+    }
+    return status;
+  }
+
+  // Opens (or reuses) the connection, blocking until it is open or failed.
+  bool connect() {
+    if (!startConnect(millis())) {
+      return false;
+    }
+    ConnectStatus status;
+    while ((status = pollConnect(millis())) == ConnectStatus::Pending) {
+      Watchdog::feed();
+      delay(1);
+    }
+    return status == ConnectStatus::Connected;
+  }
+
+  void disconnect() {
+    transport_.stop();
+    connecting_ = false;
+  }
+
+  bool begin(char* body, size_t capacity, unsigned long nowMs) {
+    body_ = body;
+    capacity_ = capacity;
+    bodyLength_ = 0;
+    statusCode_ = 0;
+    contentLength_ = -1;
+    closeAfter_ = false;
+    lineLength_ = 0;
+    state_ = ParseState::StatusLine;
+    startedMs_ = nowMs;
+
+    retried_ = false;
+    if (send(nowMs)) {
+      return true;
+    }
+    status_ = Status::Failed;
+    return false;
+  }
+
+  Status poll(unsigned long nowMs, unsigned long timeoutMs) {
+    if (status_ != Status::Pending) {
+      return status_;
+    }
+
+    if (!requestSent_) {
+      const ConnectStatus connection = pollConnect(nowMs);
+      if (connection == ConnectStatus::Failed || (connection == ConnectStatus::Connected && !writeRequest())) {
+        status_ = Status::Failed;
+        return finish();
+      }
+      if (connection == ConnectStatus::Pending) {
+        return timedOut(nowMs, timeoutMs);
+      }
+    }
+
+    while (transport_.available() > 0) {
+      if (state_ == ParseState::Body) {
+        readBody();
+      } else {
+        parseHeaderByte(static_cast<char>(transport_.read()));
+      }
+      if (status_ != Status::Pending) {
+        return finish();
+      }
+    }
+
+    if (state_ == ParseState::Body && contentLength_ >= 0 && bodyLength_ >= static_cast<size_t>(contentLength_)) {
+      status_ = Status::Done;
+      return finish();
+    }
+
+    if (!transport_.connected()) {
+      // A kept-alive socket the server closed while idle fails before the
+      // first response byte; resend once on a fresh connection.
+      if (reusedConnection_ && !retried_ && state_ == ParseState::StatusLine && lineLength_ == 0) {
+        retried_ = true;
+        transport_.stop();
+        if (send(nowMs)) {
+          return status_;
+        }
+        status_ = Status::Failed;
+        return finish();
+      }
+      // Without Content-Length the body ends when the server closes
+      status_ = (state_ == ParseState::Body && contentLength_ < 0) ? Status::Done : Status::Failed;
+      return finish();
+    }
+
+    return timedOut(nowMs, timeoutMs);
+  }
+
+  // Blocking request. Returns the HTTP status code, or a negative value.
+  int get(char* body, size_t capacity, unsigned long timeoutMs) {
+    if (!begin(body, capacity, millis())) {
+      return -1;
+    }
+    Status status;
+    while ((status = poll(millis(), timeoutMs)) == Status::Pending) {
+      Watchdog::feed();
+      delay(1);
+    }
+    return status == Status::Done ? statusCode_ : -2;
+  }
+
+  int statusCode() const {
+    return statusCode_;
+  }
+
+  size_t bodyLength() const {
+    return bodyLength_;
+  }
+
+private:
+  enum class ParseState { StatusLine, Headers, Body };
+
+  Transport transport_;
+  char host_[64] = {};
+  uint16_t port_ = 80;
+  IPAddress address_;
+  char path_[64] = {};
+  char request_[160] = {};
+  size_t requestLength_ = 0;
+
+  Status status_ = Status::Idle;
+  ParseState state_ = ParseState::StatusLine;
+  char line_[96] = {};
+  size_t lineLength_ = 0;
+  int statusCode_ = 0;
+  long contentLength_ = -1;
+  bool closeAfter_ = false;
+  char* body_ = nullptr;
+  size_t capacity_ = 0;
+  size_t bodyLength_ = 0;
+  unsigned long startedMs_ = 0;
+  unsigned long connectStartedMs_ = 0;
+  bool connecting_ = false;
+  bool reusedConnection_ = false;
+  bool retried_ = false;
+  bool requestSent_ = false;
+
+  // Writes the request on an open connection, or starts a connect for
+  // poll() to write it on once it is up.
+  bool send(unsigned long nowMs) {
+    status_ = Status::Pending;
+    reusedConnection_ = !connecting_ && transport_.connected();
+    if (reusedConnection_ && writeRequest()) {
+      return true;
+    }
+    requestSent_ = false;
+    reusedConnection_ = false;
+    if (!connecting_) {
+      transport_.stop();
+    }
+    return startConnect(nowMs);
+  }
+
+  bool writeRequest() {
+    requestSent_ = transport_.write(reinterpret_cast<const uint8_t*>(request_), requestLength_) == requestLength_;
+    return requestSent_;
+  }
+
+  Status timedOut(unsigned long nowMs, unsigned long timeoutMs) {
+    if ((nowMs - startedMs_) >= timeoutMs) {
+      status_ = Status::Failed;
+      return finish();
+    }
+    return status_;
+  }
+
+  void parseHeaderByte(char ch) {
+    if (ch == '\r') {
+      return;
+    }
+    if (ch != '\n') {
+      if (lineLength_ < sizeof(line_) - 1) {
+        line_[lineLength_++] = ch;  // Overlong header lines are truncated
+      }
+      return;
+    }
+
+    line_[lineLength_] = '\0';
+    lineLength_ = 0;
+
+    if (state_ == ParseState::StatusLine) {
+      // "HTTP/1.1 200 OK"
+      const char* space = strchr(line_, ' ');
+      statusCode_ = space != nullptr ? atoi(space + 1) : 0;
+      status_ = statusCode_ > 0 ? Status::Pending : Status::Failed;
+      state_ = ParseState::Headers;
+    } else if (line_[0] == '\0') {
+      state_ = ParseState::Body;
+      if (contentLength_ == 0) {
+        status_ = Status::Done;
+      }
+    } else if (strncasecmp(line_, "Content-Length:", 15) == 0) {
+      contentLength_ = strtol(line_ + 15, nullptr, 10);
+    } else if (strncasecmp(line_, "Connection:", 11) == 0) {
+      const char* value = line_ + 11;
+      while (*value == ' ') {
+        ++value;
+      }
+      closeAfter_ = strncasecmp(value, "close", 5) == 0;
+    }
+  }
+
+  void readBody() {
+    uint8_t chunk[64];
+    size_t wanted = sizeof(chunk);
+    if (contentLength_ >= 0) {
+      const size_t remaining = static_cast<size_t>(contentLength_) - bodyLength_;
+      wanted = remaining < wanted ? remaining : wanted;
+    }
+
+    const int read = transport_.read(chunk, wanted);
+    if (read <= 0) {
+      return;
+    }
+
+    // Bytes beyond the caller's buffer are consumed and dropped
+    if (bodyLength_ < capacity_ - 1) {
+      const size_t room = capacity_ - 1 - bodyLength_;
+      memcpy(body_ + bodyLength_, chunk, static_cast<size_t>(read) < room ? read : room);
+    }
+    bodyLength_ += read;
+
+    if (contentLength_ >= 0 && bodyLength_ >= static_cast<size_t>(contentLength_)) {
+      status_ = Status::Done;
+    }
+  }
+
+  Status finish() {
+    if (bodyLength_ >= capacity_) {
+      bodyLength_ = capacity_ - 1;
+    }
+    if (body_ != nullptr && capacity_ > 0) {
+      body_[bodyLength_] = '\0';
+    }
+    if (status_ == Status::Failed || closeAfter_) {
+      disconnect();
+    }
+    return status_;
+  }
+};
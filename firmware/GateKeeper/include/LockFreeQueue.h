@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// LOCK-FREE RING QUEUES
+// ═══════════════════════════════════════════════════════════════════════════
+// Fixed-capacity queues for ISR-to-task and task-to-task events. No locks,
+// no critical sections and no heap; elements are copied in place.
+//
+// Memory ordering: the producer writes the slot, then publishes the index
+// with a release store; the consumer reads the index with an acquire load
+// before touching the slot. On the dual-core ESP32 GCC emits MEMW around
+// these accesses, which orders them across both cores. 32-bit atomics are
+// lock-free on Xtensa (S32C1I), so the same code also builds for the host
+// stress test in tools/bench/queue_bench.
+//
+// Capacity must be a power of two. Indices run freely and wrap at 2^32.
+
+#if defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32)
+#include <esp_attr.h>
+#define QUEUE_HOT_PATH IRAM_ATTR
+#define QUEUE_CACHE_LINE 32
+#else
+#define QUEUE_HOT_PATH
+#define QUEUE_CACHE_LINE 64
+#endif
+
+// Single producer, single consumer. Wait-free on both sides, so the producer
+// may be an ISR and the consumer a task (or the other way round).
+template <typename T, size_t Capacity>
+class SpscQueue {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  QUEUE_HOT_PATH bool push(const T& value) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head - cachedTail_ == Capacity) {
+      cachedTail_ = tail_.load(std::memory_order_acquire);
+      if (head - cachedTail_ == Capacity) {
+        return false;
+      }
+    }
+
+    slots_[head & MASK] = value;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  QUEUE_HOT_PATH bool pop(T& out) {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == cachedHead_) {
+      cachedHead_ = head_.load(std::memory_order_acquire);
+      if (tail == cachedHead_) {
+        return false;
+      }
+    }
+
+    out = slots_[tail & MASK];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Approximate when called concurrently with push/pop.
+  size_t size() const {
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+  }
+
+  static constexpr size_t capacity() {
+    return Capacity;
+  }
+
+private:
+  static constexpr uint32_t MASK = Capacity - 1;
+
+  // Producer and consumer state live on separate lines so the two cores do
+  // not bounce the same line on every operation.
+  alignas(QUEUE_CACHE_LINE) std::atomic<uint32_t> head_{0};
+  uint32_t cachedTail_ = 0;
+  alignas(QUEUE_CACHE_LINE) std::atomic<uint32_t> tail_{0};
+  uint32_t cachedHead_ = 0;
+  alignas(QUEUE_CACHE_LINE) T slots_[Capacity];
+};
+
+// Multiple producers, single consumer (bounded Vyukov queue). Each slot
+// carries a sequence number that says whose turn it is. Producers claim a
+// slot with one CAS and never wait on each other, so ISRs on either core may
+// push. A producer preempted between claim and publish only delays the
+// consumer at that slot; nothing is lost or reordered per producer.
+template <typename T, size_t Capacity>
+class MpscQueue {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  MpscQueue() {
+    for (uint32_t i = 0; i < Capacity; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  QUEUE_HOT_PATH bool push(const T& value) {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot& slot = slots_[head & MASK];
+      const uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const int32_t lag = static_cast<int32_t>(sequence - head);
+
+      if (lag == 0) {
+        if (head_.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+          slot.value = value;
+          slot.sequence.store(head + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (lag < 0) {
+        return false;  // Full: the consumer has not released this slot yet
+      } else {
+        head = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  QUEUE_HOT_PATH bool pop(T& out) {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[tail & MASK];
+    if (slot.sequence.load(std::memory_order_acquire) != tail + 1) {
+      return false;  // Empty, or the next producer has not published yet
+    }
+
+    out = slot.value;
+    slot.sequence.store(tail + Capacity, std::memory_order_release);
+    tail_.store(tail + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  static constexpr size_t capacity() {
+    return Capacity;
+  }
+
+private:
+  static constexpr uint32_t MASK = Capacity - 1;
+
+  struct Slot {
+    std::atomic<uint32_t> sequence;
+    T value;
+  };
+
+  alignas(QUEUE_CACHE_LINE) std::atomic<uint32_t> head_{0};
+  alignas(QUEUE_CACHE_LINE) std::atomic<uint32_t> tail_{0};
+  alignas(QUEUE_CACHE_LINE) Slot slots_[Capacity];
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// METRICS
+// ═══════════════════════════════════════════════════════════════════════════
+// Fixed table of named 32-bit gauges and counters. Writing one is a single
+// store, so any module can publish without allocating or locking; the app
+// prints the whole table periodically.
+
+#define GATEKEEPER_METRICS(X)                        \
+  X(HeapFree, "heap_free")                           \
+  X(HeapMinFree, "heap_min_free")                    \
+  X(HeapLargestBlock, "heap_largest_block")          \
+  X(HeapAllocsAfterSetup, "heap_allocs_after_setup") \
+  X(TaskCount, "task_count")                         \
+  X(StackMinHeadroom, "stack_min_headroom")          \
+  X(HttpRequests, "http_requests")                   \
+  X(HttpFailures, "http_failures")                   \
+  X(DecisionRetries, "decision_retries")             \
+  X(HttpRequestUs, "http_request_us")                \
+  X(TlsFullHandshakes, "tls_full_handshakes")        \
+  X(TlsResumedHandshakes, "tls_resumed_handshakes")  \
+  X(TlsHandshakeUs, "tls_handshake_us")              \
+  X(UdpRequests, "udp_requests")                     \
+  X(UdpFailures, "udp_failures")                     \
+  X(UdpRetransmits, "udp_retransmits")               \
+  X(UdpRequestUs, "udp_request_us")                  \
+  X(MqttConnects, "mqtt_connects")                   \
+  X(MqttPublishes, "mqtt_publishes")                 \
+  X(MqttResends, "mqtt_resends")                     \
+  X(MqttDropped, "mqtt_dropped")                     \
+  X(MqttDecisionUs, "mqtt_decision_us")              \
+  X(DiscoveryQueries, "discovery_queries")           \
+  X(DiscoveryFailures, "discovery_failures")         \
+  X(DiscoveryChanges, "discovery_changes")           \
+  X(AllowlistEntries, "allowlist_entries")           \
+  X(AllowlistRejects, "allowlist_rejects")           \
+  X(DenylistPlates, "denylist_plates")               \
+  X(DenylistHits, "denylist_hits")                   \
+  X(DenylistAlertsFailed, "denylist_alerts_failed")  \
+  X(DenylistShardsSynced, "denylist_shards_synced")  \
+  X(DenylistSyncFailures, "denylist_sync_failures")  \
+  X(ScheduleRejects, "schedule_rejects")             \
+  X(ScheduleSyncs, "schedule_syncs")                 \
+  X(DisplayFrames, "display_frames")                 \
+  X(DisplayBytes, "display_bytes")                   \
+  X(DisplayDropped, "display_dropped")               \
+  X(DisplayPostMaxUs, "display_post_max_us")         \
+  X(DisplayFlushUs, "display_flush_us")              \
+  X(OledBusErrors, "oled_bus_errors")                \
+  X(OledBusRecoveries, "oled_bus_recoveries")        \
+  X(WatchdogResets, "watchdog_resets")               \
+  X(BootMs, "boot_ms")
+
+enum class Metric : uint8_t {
+#define GATEKEEPER_METRIC_ENUM(id, name) id,
+  GATEKEEPER_METRICS(GATEKEEPER_METRIC_ENUM)
+#undef GATEKEEPER_METRIC_ENUM
+  Count
+};
+
+class Metrics {
+public:
+  static void set(Metric metric, uint32_t value) {
+    values_[index(metric)] = value;
+  }
+
+  static void add(Metric metric, uint32_t delta = 1) {
+    values_[index(metric)] = values_[index(metric)] + delta;
+  }
+
+  static uint32_t get(Metric metric) {
+    return values_[index(metric)];
+  }
+
+  static void printTo(Print& out) {
+    out.print("[Metrics]");
+    for (size_t i = 0; i < COUNT; ++i) {
+      out.printf(" %s=%u", NAMES[i], static_cast<unsigned>(values_[i]));
+    }
+    out.println();
+  }
+
+private:
+  static constexpr size_t COUNT = static_cast<size_t>(Metric::Count);
+
+  static size_t index(Metric metric) {
+    return static_cast<size_t>(metric);
+  }
+
+  static constexpr const char* NAMES[COUNT] = {
+#define GATEKEEPER_METRIC_NAME(id, name) name,
+      GATEKEEPER_METRICS(GATEKEEPER_METRIC_NAME)
+#undef GATEKEEPER_METRIC_NAME
+  };
+
+  static inline volatile uint32_t values_[COUNT] = {};
+};
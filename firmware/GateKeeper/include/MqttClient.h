@@ -0,0 +1,489 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "Config.h"
+#include "LockFreeQueue.h"
+#include "Metrics.h"
+#include "NonBlockingClient.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// MINIMAL MQTT 3.1.1 CLIENT
+// ═══════════════════════════════════════════════════════════════════════════
+// Just what the gate needs: one persistent session (clean session = 0),
+// QoS 1 publish with PUBACK tracking, QoS 0/1 subscriptions and keep-alive.
+// All buffers are fixed, so nothing is allocated after setup.
+//
+// publish() only enqueues. loop() moves queued messages into a small
+// in-flight window, resends unacknowledged ones with DUP set, and
+// dispatches incoming PUBLISH packets to the handler. When the queue is
+// full publish() fails and the message is counted as dropped, so a dead
+// broker cannot grow memory or stall the loop.
+//
+// Connecting never waits either: startConnect() begins the name lookup and
+// TCP connect, and each loop() moves the attempt one step on (connected,
+// CONNECT sent, CONNACK read) until it succeeds or MQTT_CONNECT_TIMEOUT_MS
+// passes. The Transport must offer NonBlockingClient's startConnect() and
+// pollConnect().
+//
+// Because the session is persistent, the broker keeps the subscriptions and
+// queues QoS 1 messages while the gate is offline. If CONNACK reports that
+// the session still exists, SUBSCRIBE is skipped. In-flight publishes are
+// always resent after a reconnect, as 3.1.1 requires.
+
+template <typename Transport, size_t QueueCapacity>
+class MqttClient {
+public:
+  static constexpr size_t MAX_TOPIC = 48;
+  static constexpr size_t MAX_PAYLOAD = 96;
+
+  // Topic and payload are only valid during the call.
+  using MessageHandler = void (*)(void* context, const char* topic, const char* payload, size_t length);
+
+  void configure(const char* host, uint16_t port, const char* clientId, const char* username,
+                 const char* password, uint16_t keepAliveS) {
+    host_ = host;
+    port_ = port;
+    clientId_ = clientId;
+    username_ = username;
+    password_ = password;
+    keepAliveS_ = keepAliveS;
+  }
+
+  bool subscribe(const char* topic, uint8_t qos) {
+    if (subscriptionCount_ >= MAX_SUBSCRIPTIONS) {
+      return false;
+    }
+    subscriptions_[subscriptionCount_++] = {topic, qos};
+    if (link_ == Link::Up) {
+      sendSubscribe();
+    }
+    return true;
+  }
+
+  void onMessage(MessageHandler handler, void* context) {
+    handler_ = handler;
+    handlerContext_ = context;
+  }
+
+  // QoS 1 publish. Returns false (and counts a drop) when the queue is full.
+  bool publish(const char* topic, const char* payload, size_t length) {
+    Message message;
+    if (strlen(topic) >= MAX_TOPIC || length > MAX_PAYLOAD) {
+      return false;
+    }
+    strcpy(message.topic, topic);
+    memcpy(message.payload, payload, length);
+    message.length = static_cast<uint8_t>(length);
+
+    if (!outbound_.push(message)) {
+      Metrics::add(Metric::MqttDropped);
+      return false;
+    }
+    return true;
+  }
+
+  bool connected() {
+    return link_ == Link::Up && transport_.connected();
+  }
+
+  // Begins an attempt unless one is under way; loop() carries it on
+  void startConnect(unsigned long nowMs) {
+    if (link_ != Link::Down) {
+      return;
+    }
+    lastConnectAttemptMs_ = nowMs;
+    link_ = transport_.startConnect(host_, port_) ? Link::Connecting : Link::Down;
+  }
+
+  void loop(unsigned long nowMs) {
+    switch (link_) {
+      case Link::Down:
+        if ((nowMs - lastConnectAttemptMs_) >= Config::MQTT_RECONNECT_MS) {
+          startConnect(nowMs);
+        }
+        return;
+      case Link::Connecting:
+      case Link::AwaitingConnack:
+        advanceConnect(nowMs);
+        return;
+      case Link::Up:
+        break;
+    }
+    if (!transport_.connected()) {
+      link_ = Link::Down;
+      return;
+    }
+
+    readPackets(nowMs);
+    resendExpired(nowMs);
+    drainOutbound(nowMs);
+    keepAlive(nowMs);
+  }
+
+  void disconnect() {
+    if (link_ == Link::Up) {
+      static const uint8_t DISCONNECT[] = {0xE0, 0x00};
+      transport_.write(DISCONNECT, sizeof(DISCONNECT));
+    }
+    dropLink();
+  }
+
+private:
+  static constexpr size_t MAX_SUBSCRIPTIONS = 4;
+  static constexpr size_t MAX_INFLIGHT = 4;
+
+  enum class Link : uint8_t { Down, Connecting, AwaitingConnack, Up };
+  enum class RxState { Type, Length, Body };
+
+  struct Message {
+    char topic[MAX_TOPIC];
+    uint8_t payload[MAX_PAYLOAD];
+    uint8_t length;
+  };
+
+  struct Inflight {
+    Message message;
+    uint16_t packetId;
+    unsigned long sentMs;
+    bool used;
+  };
+
+  struct Subscription {
+    const char* topic;
+    uint8_t qos;
+  };
+
+  Transport transport_;
+  const char* host_ = "";
+  uint16_t port_ = 1883;
+  const char* clientId_ = "";
+  const char* username_ = "";
+  const char* password_ = "";
+  uint16_t keepAliveS_ = 30;
+
+  Subscription subscriptions_[MAX_SUBSCRIPTIONS] = {};
+  size_t subscriptionCount_ = 0;
+  MessageHandler handler_ = nullptr;
+  void* handlerContext_ = nullptr;
+
+  SpscQueue<Message, QueueCapacity> outbound_;
+  Inflight inflight_[MAX_INFLIGHT] = {};
+  uint16_t nextPacketId_ = 1;
+
+  Link link_ = Link::Down;
+  bool sessionPresent_ = false;
+  bool pingOutstanding_ = false;
+  unsigned long lastConnectAttemptMs_ = 0;
+  unsigned long lastSendMs_ = 0;
+  unsigned long pingSentMs_ = 0;
+
+  uint8_t tx_[256];
+  uint8_t rx_[192];
+  RxState rxState_ = RxState::Type;
+  uint8_t rxType_ = 0;
+  size_t rxLength_ = 0;
+  size_t rxCount_ = 0;
+  uint8_t rxShift_ = 0;
+
+  // ─── Connection ───────────────────────────────────────────────────────────
+
+  // One step per call, never waiting on the network
+  void advanceConnect(unsigned long nowMs) {
+    if ((nowMs - lastConnectAttemptMs_) >= Config::MQTT_CONNECT_TIMEOUT_MS) {
+      dropLink();
+      return;
+    }
+    if (link_ == Link::Connecting) {
+      const NonBlockingClient::ConnectStatus status = transport_.pollConnect();
+      if (status == NonBlockingClient::ConnectStatus::Pending) {
+        return;
+      }
+      if (status == NonBlockingClient::ConnectStatus::Failed) {
+        dropLink();
+        return;
+      }
+      transport_.setNoDelay(true);
+      rxState_ = RxState::Type;
+      link_ = Link::AwaitingConnack;
+      sendConnect();
+    }
+    if (!transport_.connected()) {
+      dropLink();
+      return;
+    }
+    readPackets(nowMs);  // CONNACK moves the link Up, or Down if refused
+    if (link_ == Link::Up) {
+      onConnected(nowMs);
+    }
+  }
+
+  void onConnected(unsigned long nowMs) {
+    Serial.print("[MQTT] Connected to ");
+    Serial.println(host_);
+    Metrics::add(Metric::MqttConnects);
+    if (!sessionPresent_) {
+      sendSubscribe();
+    }
+    for (Inflight& inflight : inflight_) {
+      if (inflight.used) {
+        sendPublish(inflight, true, nowMs);
+      }
+    }
+  }
+
+  void dropLink() {
+    transport_.stop();
+    link_ = Link::Down;
+  }
+
+  // ─── Outbound ─────────────────────────────────────────────────────────────
+
+  void drainOutbound(unsigned long nowMs) {
+    for (Inflight& inflight : inflight_) {
+      if (!inflight.used && outbound_.pop(inflight.message)) {
+        inflight.used = true;
+        inflight.packetId = takePacketId();
+        sendPublish(inflight, false, nowMs);
+        Metrics::add(Metric::MqttPublishes);
+      }
+    }
+  }
+
+  void resendExpired(unsigned long nowMs) {
+    for (Inflight& inflight : inflight_) {
+      if (inflight.used && (nowMs - inflight.sentMs) >= Config::MQTT_RESEND_MS) {
+        sendPublish(inflight, true, nowMs);
+        Metrics::add(Metric::MqttResends);
+      }
+    }
+  }
+
+  void keepAlive(unsigned long nowMs) {
+    const unsigned long keepAliveMs = keepAliveS_ * 1000UL;
+    if (pingOutstanding_ && (nowMs - pingSentMs_) >= keepAliveMs) {
+      transport_.stop();  // Broker gone; loop() reconnects
+      return;
+    }
+    // Ping at three quarters of the interval so the broker never times out
+    if (!pingOutstanding_ && (nowMs - lastSendMs_) >= keepAliveMs * 3 / 4) {
+      static const uint8_t PINGREQ[] = {0xC0, 0x00};
+      send(PINGREQ, sizeof(PINGREQ), nowMs);
+      pingOutstanding_ = true;
+      pingSentMs_ = nowMs;
+    }
+  }
+
+  uint16_t takePacketId() {
+    const uint16_t id = nextPacketId_++;
+    if (nextPacketId_ == 0) {
+      nextPacketId_ = 1;
+    }
+    return id;
+  }
+
+  void sendConnect() {
+    const bool hasUsername = username_[0] != '\0';
+    const bool hasPassword = hasUsername && password_[0] != '\0';
+    uint8_t flags = 0x00;  // Clean session off: keep subscriptions and queued messages
+    flags |= hasUsername ? 0x80 : 0;
+    flags |= hasPassword ? 0x40 : 0;
+
+    size_t length = 0;
+    uint8_t* body = tx_ + 5;
+    length += putString(body + length, "MQTT");
+    body[length++] = 4;  // Protocol level 3.1.1
+    body[length++] = flags;
+    body[length++] = static_cast<uint8_t>(keepAliveS_ >> 8);
+    body[length++] = static_cast<uint8_t>(keepAliveS_);
+    length += putString(body + length, clientId_);
+    if (hasUsername) {
+      length += putString(body + length, username_);
+    }
+    if (hasPassword) {
+      length += putString(body + length, password_);
+    }
+    sendPacket(0x10, length, millis());
+  }
+
+  void sendSubscribe() {
+    size_t length = 0;
+    uint8_t* body = tx_ + 5;
+    const uint16_t id = takePacketId();
+    body[length++] = static_cast<uint8_t>(id >> 8);
+    body[length++] = static_cast<uint8_t>(id);
+    for (size_t i = 0; i < subscriptionCount_; ++i) {
+      length += putString(body + length, subscriptions_[i].topic);
+      body[length++] = subscriptions_[i].qos;
+    }
+    sendPacket(0x82, length, millis());
+  }
+
+  void sendPublish(Inflight& inflight, bool duplicate, unsigned long nowMs) {
+    size_t length = 0;
+    uint8_t* body = tx_ + 5;
+    length += putString(body + length, inflight.message.topic);
+    body[length++] = static_cast<uint8_t>(inflight.packetId >> 8);
+    body[length++] = static_cast<uint8_t>(inflight.packetId);
+    memcpy(body + length, inflight.message.payload, inflight.message.length);
+    length += inflight.message.length;
+
+    inflight.sentMs = nowMs;
+    sendPacket(duplicate ? 0x3A : 0x32, length, nowMs);  // PUBLISH, QoS 1
+  }
+
+  void sendPuback(uint16_t packetId, unsigned long nowMs) {
+    const uint8_t puback[] = {0x40, 0x02, static_cast<uint8_t>(packetId >> 8), static_cast<uint8_t>(packetId)};
+    send(puback, sizeof(puback), nowMs);
+  }
+
+  // The body is already at tx_ + 5; the fixed header is written right
+  // before it so the packet goes out in one write.
+  void sendPacket(uint8_t type, size_t bodyLength, unsigned long nowMs) {
+    uint8_t header[5];
+    size_t headerLength = 0;
+    header[headerLength++] = type;
+    size_t remaining = bodyLength;
+    do {
+      uint8_t byte = remaining & 0x7F;
+      remaining >>= 7;
+      header[headerLength++] = byte | (remaining > 0 ? 0x80 : 0);
+    } while (remaining > 0);
+
+    uint8_t* start = tx_ + 5 - headerLength;
+    memcpy(start, header, headerLength);
+    send(start, headerLength + bodyLength, nowMs);
+  }
+
+  void send(const uint8_t* data, size_t length, unsigned long nowMs) {
+    if (transport_.write(data, length) != length) {
+      transport_.stop();
+      return;
+    }
+    lastSendMs_ = nowMs;
+  }
+
+  static size_t putString(uint8_t* out, const char* text) {
+    const size_t length = strlen(text);
+    out[0] = static_cast<uint8_t>(length >> 8);
+    out[1] = static_cast<uint8_t>(length);
+    memcpy(out + 2, text, length);
+    return length + 2;
+  }
+
+  // ─── Inbound ──────────────────────────────────────────────────────────────
+
+  void readPackets(unsigned long nowMs) {
+    while (transport_.available() > 0) {
+      const uint8_t byte = static_cast<uint8_t>(transport_.read());
+      switch (rxState_) {
+        case RxState::Type:
+          rxType_ = byte;
+          rxLength_ = 0;
+          rxShift_ = 0;
+          rxState_ = RxState::Length;
+          break;
+        case RxState::Length:
+          rxLength_ |= static_cast<size_t>(byte & 0x7F) << rxShift_;
+          rxShift_ += 7;
+          if ((byte & 0x80) == 0) {
+            rxCount_ = 0;
+            rxState_ = RxState::Body;
+            if (rxLength_ == 0) {
+              dispatch(nowMs);
+            }
+          }
+          break;
+        case RxState::Body:
+          // Bytes beyond rx_ are consumed and dropped
+          if (rxCount_ < sizeof(rx_)) {
+            rx_[rxCount_] = byte;
+          }
+          if (++rxCount_ == rxLength_) {
+            dispatch(nowMs);
+          }
+          break;
+      }
+    }
+  }
+
+  void dispatch(unsigned long nowMs) {
+    rxState_ = RxState::Type;
+    const size_t stored = rxLength_ < sizeof(rx_) ? rxLength_ : sizeof(rx_);
+
+    switch (rxType_ >> 4) {
+      case 2:  // CONNACK
+        if (link_ != Link::AwaitingConnack) {
+          break;
+        }
+        if (stored >= 2 && rx_[1] == 0) {
+          sessionPresent_ = (rx_[0] & 0x01) != 0;
+          link_ = Link::Up;
+          pingOutstanding_ = false;
+        } else {
+          Serial.printf("[MQTT] Connection refused, code %u\n", stored >= 2 ? rx_[1] : 0xFF);
+          dropLink();
+        }
+        break;
+      case 3:  // PUBLISH
+        handlePublish(stored, nowMs);
+        break;
+      case 4:  // PUBACK
+        if (stored >= 2) {
+          const uint16_t id = static_cast<uint16_t>((rx_[0] << 8) | rx_[1]);
+          for (Inflight& inflight : inflight_) {
+            if (inflight.used && inflight.packetId == id) {
+              inflight.used = false;
+            }
+          }
+        }
+        break;
+      case 9:  // SUBACK
+        for (size_t i = 2; i < stored; ++i) {
+          if (rx_[i] == 0x80) {
+            Serial.println("[MQTT] Subscription refused by broker");
+          }
+        }
+        break;
+      case 13:  // PINGRESP
+        pingOutstanding_ = false;
+        break;
+      default:
+        break;
+    }
+  }
+
+  void handlePublish(size_t stored, unsigned long nowMs) {
+    const uint8_t qos = (rxType_ >> 1) & 0x03;
+    if (stored < 2) {
+      return;
+    }
+    const size_t topicLength = static_cast<size_t>((rx_[0] << 8) | rx_[1]);
+    size_t offset = 2 + topicLength;
+    uint16_t packetId = 0;
+    if (qos > 0) {
+      if (offset + 2 > stored) {
+        return;
+      }
+      packetId = static_cast<uint16_t>((rx_[offset] << 8) | rx_[offset + 1]);
+      offset += 2;
+    }
+
+    if (handler_ != nullptr && topicLength < MAX_TOPIC && offset <= stored) {
+      char topic[MAX_TOPIC];
+      memcpy(topic, rx_ + 2, topicLength);
+      topic[topicLength] = '\0';
+
+      char payload[MAX_PAYLOAD + 1];
+      const size_t length = stored - offset < MAX_PAYLOAD ? stored - offset : MAX_PAYLOAD;
+      memcpy(payload, rx_ + offset, length);
+      payload[length] = '\0';
+      handler_(handlerContext_, topic, payload, length);
+    }
+
+    // Subscriptions are at most QoS 1, so the broker never sends QoS 2
+    if (qos == 1) {
+      sendPuback(packetId, nowMs);
+    }
+  }
+};
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include "Config.h"
+#include "DecisionTransport.h"
+#include "LockFreeQueue.h"
+#include "Metrics.h"
+#include "MqttClient.h"
+#include "SiteProfile.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// MQTT DECISION TRANSPORT
+// ═══════════════════════════════════════════════════════════════════════════
+// For sites that already run a broker. Topics, under gatekeeper/<gate>/:
+//
+//   trigger              out  QoS 1  {"id": 7}
+//   decision             in   QoS 1  {"id": 7, "plate": "51A12345", "status": true}
+//   command              in   QoS 0  open | close
+//   allowlist/invalidate in   QoS 1  any payload
+//   alert                out  QoS 1  51A12345 (probable denylist hit)
+//
+// Decisions are matched on the trigger ID, so a late or redelivered decision
+// for an earlier vehicle is ignored. IDs start at a random value on boot,
+// so decisions queued for a previous run never match. The command topic is
+// subscribed at QoS 0, so the broker does not queue commands while the gate
+// is offline and an old "open" cannot fire after a reconnect.
+// src/api/mqtt_bridge.py is the server side.
+
+class MqttDecisionTransport final : public DecisionTransport {
+public:
+  explicit MqttDecisionTransport(const char* gateId = Config::GATE_ID) : gateId_(gateId) {}
+
+  const char* name() const override {
+    return "MQTT";
+  }
+
+  void initialize() override {
+    snprintf(clientId_, sizeof(clientId_), "gatekeeper-%s", gateId_);
+    snprintf(triggerTopic_, sizeof(triggerTopic_), "gatekeeper/%s/trigger", gateId_);
+    snprintf(decisionTopic_, sizeof(decisionTopic_), "gatekeeper/%s/decision", gateId_);
+    snprintf(commandTopic_, sizeof(commandTopic_), "gatekeeper/%s/command", gateId_);
+    snprintf(invalidateTopic_, sizeof(invalidateTopic_), "gatekeeper/%s/allowlist/invalidate", gateId_);
+    snprintf(alertTopic_, sizeof(alertTopic_), "gatekeeper/%s/alert", gateId_);
+
+    client_.configure(Config::MQTT_BROKER_HOST, Config::MQTT_BROKER_PORT, clientId_, Config::MQTT_USERNAME,
+                      Config::MQTT_PASSWORD, Config::MQTT_KEEPALIVE_S);
+    client_.subscribe(decisionTopic_, 1);
+    client_.subscribe(commandTopic_, 0);
+    client_.subscribe(invalidateTopic_, 1);
+    client_.onMessage(onMessage, this);
+    nextId_ = esp_random();
+  }
+
+  // Only starts the attempt; maintain() and pollDecision() carry it on
+  void warmUp() override {
+    if (WiFi.status() == WL_CONNECTED) {
+      client_.startConnect(millis());
+    }
+  }
+
+  bool connected() {
+    return client_.connected();
+  }
+
+  void maintain(unsigned long nowMs) override {
+    if (WiFi.status() == WL_CONNECTED) {
+      client_.loop(nowMs);
+    }
+  }
+
+  void startDecision(unsigned long nowMs) override {
+    pendingId_ = nextId_++;
+    decided_ = false;
+    startedMs_ = nowMs;
+    startUs_ = micros();
+
+    char payload[24];
+    const int length = snprintf(payload, sizeof(payload), "{\"id\":%lu}", static_cast<unsigned long>(pendingId_));
+    Serial.printf("[MQTT] Trigger %lu\n", static_cast<unsigned long>(pendingId_));
+
+    state_ = DecisionState::Pending;
+    if (!client_.publish(triggerTopic_, payload, length)) {
+      Serial.println("[MQTT] Outbound queue full, trigger dropped");
+      state_ = DecisionState::Failed;
+    }
+  }
+
+  // Queued triggers go out as soon as the session is back, so waiting
+  // through a short broker outage still yields a decision.
+  DecisionState pollDecision(unsigned long nowMs, PlateText& plateOut) override {
+    if (state_ != DecisionState::Pending) {
+      return state_;
+    }
+    client_.loop(nowMs);
+    if (decided_) {
+      plateOut = plate_;
+      state_ = accepted_ ? DecisionState::Accepted : DecisionState::Denied;
+    } else if ((nowMs - startedMs_) >= SiteProfile::timeoutMs()) {
+      Serial.println("[MQTT] No decision before timeout");
+      state_ = DecisionState::Failed;
+    } else {
+      return state_;
+    }
+    Metrics::set(Metric::MqttDecisionUs, micros() - startUs_);
+    return state_;
+  }
+
+  bool nextCommand(RemoteCommand& command) override {
+    return commands_.pop(command);
+  }
+
+  // Queued like a trigger, so it survives a short broker outage
+  bool sendAlert(const char* plate) override {
+    return client_.publish(alertTopic_, plate, strlen(plate));
+  }
+
+private:
+  const char* gateId_;
+  MqttClient<NonBlockingClient, Config::MQTT_OUTBOUND_QUEUE> client_;
+  SpscQueue<RemoteCommand, 8> commands_;
+
+  char clientId_[40] = {};
+  char triggerTopic_[48] = {};
+  char decisionTopic_[48] = {};
+  char commandTopic_[48] = {};
+  char invalidateTopic_[48] = {};
+  char alertTopic_[48] = {};
+
+  uint32_t nextId_ = 0;
+  uint32_t pendingId_ = 0;
+  DecisionState state_ = DecisionState::Denied;
+  unsigned long startedMs_ = 0;
+  unsigned long startUs_ = 0;
+  bool decided_ = false;
+  bool accepted_ = false;
+  PlateText plate_;
+
+  static void onMessage(void* context, const char* topic, const char* payload, size_t) {
+    static_cast<MqttDecisionTransport*>(context)->handleMessage(topic, payload);
+  }
+
+  void handleMessage(const char* topic, const char* payload) {
+    if (strcmp(topic, decisionTopic_) == 0) {
+      uint32_t id = 0;
+      if (decided_ || !DecisionJson::parseIdField(payload, id) || id != pendingId_) {
+        return;  // Redelivery, or a decision for an earlier vehicle
+      }
+      bool status = false;
+      DecisionJson::parseStatusField(payload, status);
+      accepted_ = status;
+      plate_.clear();
+      DecisionJson::parsePlateField(payload, plate_);
+      decided_ = true;
+      // The payload is printed apart: through printf it would overflow the
+      // 64-byte stack buffer and allocate
+      Serial.printf("[MQTT] Decision %lu: ", static_cast<unsigned long>(id));
+      Serial.println(payload);
+    } else if (strcmp(topic, commandTopic_) == 0) {
+      if (strcmp(payload, "open") == 0) {
+        commands_.push(RemoteCommand::OpenGate);
+      } else if (strcmp(payload, "close") == 0) {
+        commands_.push(RemoteCommand::CloseGate);
+      } else {
+        Serial.print("[MQTT] Unknown command: ");
+        Serial.println(payload);
+      }
+    } else if (strcmp(topic, invalidateTopic_) == 0) {
+      commands_.push(RemoteCommand::InvalidateAllowlist);
+    }
+  }
+};
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lwip/dns.h>
+#include <lwip/sockets.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// NON-BLOCKING TCP CLIENT
+// ═══════════════════════════════════════════════════════════════════════════
+// Plain TCP over a raw lwIP socket for clients polled from the loop. Unlike
+// WiFiClient::connect(), which waits in select() for up to its timeout,
+// startConnect() only begins the name lookup and the connect, and
+// pollConnect() checks on them without waiting. The caller owns the
+// deadline and calls stop() when it passes.
+//
+// Names go through lwIP's asynchronous DNS; the result arrives on the
+// tcpip task, hence the volatile fields. A lookup abandoned by stop() may
+// still complete later and write the same host's address, which is
+// harmless. Reads are buffered and writes never wait: a write the socket
+// cannot take whole returns short, and the caller drops the connection.
+
+class NonBlockingClient {
+public:
+  enum class ConnectStatus { Pending, Connected, Failed };
+
+  ~NonBlockingClient() {
+    stop();
+  }
+
+  bool startConnect(const char* host, uint16_t port) {
+    stop();
+    port_ = port;
+    ip_addr_t address;
+    const err_t err = dns_gethostbyname(host, &address, onResolved, this);
+    if (err == ERR_OK) {
+      return openSocket(ip4_addr_get_u32(ip_2_ip4(&address)));
+    }
+    if (err != ERR_INPROGRESS) {
+      return false;
+    }
+    lookup_ = Lookup::Pending;
+    return true;
+  }
+
+  ConnectStatus pollConnect() {
+    if (lookup_ == Lookup::Pending) {
+      return ConnectStatus::Pending;
+    }
+    if (lookup_ == Lookup::Done) {
+      lookup_ = Lookup::None;
+      if (!openSocket(resolved_)) {
+        return ConnectStatus::Failed;
+      }
+    } else if (lookup_ == Lookup::Failed) {
+      lookup_ = Lookup::None;
+      return ConnectStatus::Failed;
+    }
+    if (socket_ < 0) {
+      return ConnectStatus::Failed;
+    }
+    if (!connecting_) {
+      return ConnectStatus::Connected;
+    }
+
+    fd_set sockets;
+    FD_ZERO(&sockets);
+    FD_SET(socket_, &sockets);
+    timeval noWait = {0, 0};
+    if (lwip_select(socket_ + 1, nullptr, &sockets, nullptr, &noWait) <= 0) {
+      return ConnectStatus::Pending;
+    }
+    int error = 0;
+    socklen_t length = sizeof(error);
+    if (lwip_getsockopt(socket_, SOL_SOCKET, SO_ERROR, &error, &length) != 0 || error != 0) {
+      stop();
+      return ConnectStatus::Failed;
+    }
+    connecting_ = false;
+    return ConnectStatus::Connected;
+  }
+
+  int setNoDelay(bool enabled) {
+    const int flag = enabled ? 1 : 0;
+    return lwip_setsockopt(socket_, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+  }
+
+  size_t write(const uint8_t* data, size_t length) {
+    if (socket_ < 0 || connecting_) {
+      return 0;
+    }
+    const int sent = lwip_send(socket_, data, length, 0);
+    if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+      stop();
+    }
+    return sent > 0 ? static_cast<size_t>(sent) : 0;
+  }
+
+  int available() {
+    fill();
+    return static_cast<int>(rxLength_ - rxPosition_);
+  }
+
+  int read() {
+    fill();
+    return rxPosition_ < rxLength_ ? rx_[rxPosition_++] : -1;
+  }
+
+  int read(uint8_t* buffer, size_t length) {
+    fill();
+    const size_t buffered = rxLength_ - rxPosition_;
+    const size_t count = buffered < length ? buffered : length;
+    memcpy(buffer, rx_ + rxPosition_, count);
+    rxPosition_ += count;
+    return static_cast<int>(count);
+  }
+
+  // Also notices a FIN on an idle connection
+  uint8_t connected() {
+    if (socket_ >= 0 && !connecting_ && rxPosition_ == rxLength_) {
+      fill();
+    }
+    return (socket_ >= 0 && !connecting_) || rxPosition_ < rxLength_;
+  }
+
+  // For a protocol layered on the connection (TlsClient), which then does
+  // its own reads and must not call read(), available() or connected().
+  int socket() const {
+    return socket_;
+  }
+
+  void stop() {
+    if (socket_ >= 0) {
+      lwip_close(socket_);
+      socket_ = -1;
+    }
+    lookup_ = Lookup::None;
+    connecting_ = false;
+    rxLength_ = rxPosition_ = 0;
+  }
+
+private:
+  enum class Lookup : uint8_t { None, Pending, Done, Failed };
+
+  int socket_ = -1;
+  uint16_t port_ = 0;
+  bool connecting_ = false;
+  volatile Lookup lookup_ = Lookup::None;
+  volatile uint32_t resolved_ = 0;
+
+  uint8_t rx_[128];
+  size_t rxLength_ = 0;
+  size_t rxPosition_ = 0;
+
+  bool openSocket(uint32_t address) {
+    socket_ = lwip_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (socket_ < 0) {
+      return false;
+    }
+    lwip_fcntl(socket_, F_SETFL, lwip_fcntl(socket_, F_GETFL, 0) | O_NONBLOCK);
+
+    sockaddr_in server = {};
+    server.sin_family = AF_INET;
+    server.sin_port = htons(port_);
+    server.sin_addr.s_addr = address;
+    if (lwip_connect(socket_, reinterpret_cast<sockaddr*>(&server), sizeof(server)) == 0) {
+      return true;
+    }
+    if (errno != EINPROGRESS) {
+      stop();
+      return false;
+    }
+    connecting_ = true;
+    return true;
+  }
+
+  void fill() {
+    if (socket_ < 0 || connecting_ || rxPosition_ < rxLength_) {
+      return;
+    }
+    rxLength_ = rxPosition_ = 0;
+    const int received = lwip_recv(socket_, rx_, sizeof(rx_), 0);
+    if (received > 0) {
+      rxLength_ = received;
+    } else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+      stop();  // FIN or a socket error
+    }
+  }
+
+  static void onResolved(const char*, const ip_addr_t* address, void* context) {
+    NonBlockingClient* client = static_cast<NonBlockingClient*>(context);
+    if (client->lookup_ != Lookup::Pending) {
+      return;
+    }
+    if (address == nullptr) {
+      client->lookup_ = Lookup::Failed;
+      return;
+    }
+    client->resolved_ = ip4_addr_get_u32(ip_2_ip4(address));
+    client->lookup_ = Lookup::Done;
+  }
+};
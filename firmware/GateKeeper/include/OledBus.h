@@ -0,0 +1,141 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "Config.h"
+#include "Metrics.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// OLED I2C BUS
+// ═══════════════════════════════════════════════════════════════════════════
+// Frame transport for the SSD1306, used by the display task instead of
+// Adafruit_SSD1306::display(). That path sends a frame as dozens of small
+// Wire transactions, each with its own start, address byte and stop. Here
+// a region's addressing commands and all of its data go out in ONE
+// transaction. Each command byte is prefixed with 0x80 (Co = 1, command).
+// Then one 0x40 marks the rest of the transaction as display data. The
+// Wire buffer is grown at start so a full frame fits.
+//
+// Every transfer is bounded by OLED_I2C_TIMEOUT_MS. A failed transfer, or
+// SDA found low at start, triggers the standard bus clear (I2C spec
+// 3.1.16). Up to nine SCL pulses let a slave that lost sync finish its
+// byte and release SDA, then a STOP resets every slave's state machine.
+// Without this a slave stuck mid-byte after a brown-out or a glitch
+// holds the bus low until power is cycled.
+
+class OledBus {
+public:
+  // Address commands for a region, each with its control byte, and the
+  // data control byte
+  static constexpr size_t HEADER_BYTES = 13;
+  static constexpr size_t MAX_TRANSACTION = HEADER_BYTES + Config::OLED_WIDTH * Config::OLED_HEIGHT / 8;
+
+  static bool begin() {
+    if (sdaStuck()) {
+      recover();
+    }
+    return start(Config::OLED_I2C_CLOCK_HZ);
+  }
+
+  // 100 kHz standard, 400 kHz fast mode, 1 MHz fast-mode plus. The
+  // SSD1306 datasheet only specifies 400 kHz; most modules run faster.
+  static void setClock(uint32_t hz) {
+    clockHz_ = hz;
+    Wire.setClock(hz);
+  }
+
+  static uint32_t clock() {
+    return clockHz_;
+  }
+
+  // Sends columns first..last of pages firstPage..lastPage of a frame
+  // buffer (Adafruit_SSD1306::getBuffer() layout) in one transaction.
+  // On failure the bus is cleared and the caller should resend the whole
+  // frame, since the panel may hold a partial write.
+  static bool writeRegion(uint8_t firstPage, uint8_t lastPage, uint8_t first, uint8_t last, const uint8_t* frame) {
+    const uint8_t header[HEADER_BYTES] = {0x80, 0x22, 0x80, firstPage, 0x80, lastPage,  // PAGEADDR
+                                          0x80, 0x21, 0x80, first,     0x80, last,      // COLUMNADDR
+                                          0x40};
+    Wire.beginTransmission(Config::OLED_I2C_ADDRESS);
+    Wire.write(header, sizeof(header));
+    // The panel wraps to the next page at the end of the column window
+    for (uint8_t page = firstPage; page <= lastPage; ++page) {
+      Wire.write(frame + page * Config::OLED_WIDTH + first, last - first + 1);
+    }
+    const uint8_t error = Wire.endTransmission();
+    if (error == 0) {
+      return true;
+    }
+
+    Metrics::add(Metric::OledBusErrors);
+    Serial.printf("[OLED] I2C error %u, clearing the bus\n", static_cast<unsigned>(error));
+    recover();
+    start(clockHz_);
+    return false;
+  }
+
+private:
+  static constexpr uint32_t HALF_CLOCK_US = 5;  // 100 kHz while bit-banging
+  static constexpr uint8_t CLEAR_PULSES = 9;
+
+  // A full frame, plus its header, must fit the timeout twice over
+  static_assert(Config::OLED_I2C_TIMEOUT_MS * (Config::OLED_I2C_CLOCK_HZ / 1000) >= 2 * 9 * MAX_TRANSACTION,
+                "OLED_I2C_TIMEOUT_MS is too short for a full frame at OLED_I2C_CLOCK_HZ");
+
+  static inline uint32_t clockHz_ = Config::OLED_I2C_CLOCK_HZ;
+
+  static bool start(uint32_t hz) {
+    // Only takes effect while the driver is stopped
+    Wire.setBufferSize(MAX_TRANSACTION);
+    if (!Wire.begin(Config::OLED_SDA_PIN, Config::OLED_SCL_PIN, hz)) {
+      Serial.println("[OLED] I2C start failed");
+      return false;
+    }
+    Wire.setTimeOut(Config::OLED_I2C_TIMEOUT_MS);
+    clockHz_ = hz;
+    return true;
+  }
+
+  static bool sdaStuck() {
+    pinMode(Config::OLED_SDA_PIN, INPUT_PULLUP);
+    pinMode(Config::OLED_SCL_PIN, INPUT_PULLUP);
+    delayMicroseconds(HALF_CLOCK_US);
+    return digitalRead(Config::OLED_SDA_PIN) == LOW;
+  }
+
+  // Takes the pins from the driver, clocks SDA free, sends a STOP and
+  // leaves the driver stopped. False when a line is still held low (SCL
+  // low means a slave is stretching forever; only a power cycle helps).
+  static bool recover() {
+    Wire.end();
+    Metrics::add(Metric::OledBusRecoveries);
+
+    pinMode(Config::OLED_SDA_PIN, INPUT_PULLUP);
+    pinMode(Config::OLED_SCL_PIN, OUTPUT_OPEN_DRAIN);
+    digitalWrite(Config::OLED_SCL_PIN, HIGH);
+    delayMicroseconds(HALF_CLOCK_US);
+    for (uint8_t i = 0; i < CLEAR_PULSES && digitalRead(Config::OLED_SDA_PIN) == LOW; ++i) {
+      digitalWrite(Config::OLED_SCL_PIN, LOW);
+      delayMicroseconds(HALF_CLOCK_US);
+      digitalWrite(Config::OLED_SCL_PIN, HIGH);
+      delayMicroseconds(HALF_CLOCK_US);
+    }
+
+    // STOP: SDA rises while SCL is high
+    digitalWrite(Config::OLED_SCL_PIN, LOW);
+    pinMode(Config::OLED_SDA_PIN, OUTPUT_OPEN_DRAIN);
+    digitalWrite(Config::OLED_SDA_PIN, LOW);
+    delayMicroseconds(HALF_CLOCK_US);
+    digitalWrite(Config::OLED_SCL_PIN, HIGH);
+    delayMicroseconds(HALF_CLOCK_US);
+    digitalWrite(Config::OLED_SDA_PIN, HIGH);
+    delayMicroseconds(HALF_CLOCK_US);
+
+    pinMode(Config::OLED_SDA_PIN, INPUT_PULLUP);
+    pinMode(Config::OLED_SCL_PIN, INPUT_PULLUP);
+    const bool released = digitalRead(Config::OLED_SDA_PIN) == HIGH && digitalRead(Config::OLED_SCL_PIN) == HIGH;
+    Serial.printf("[OLED] Bus clear %s\n", released ? "succeeded" : "failed, a line is still held low");
+    return released;
+  }
+};
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// MINIMAL PERFECT HASH ALLOWLIST (BBHash + 16-bit fingerprints)
+// ═══════════════════════════════════════════════════════════════════════════
+// Layout 2 of the allowlist image. A BBHash cascade maps each of the n
+// PlateIds to a distinct slot in [0, n), and a 16-bit fingerprint per slot
+// rejects keys that were never in the set. A lookup is one or two bit probes
+// plus a rank and a fingerprint read, instead of log2(n) dependent reads.
+//
+// Level l is a bit array of about gamma * (keys left) bits. Every key is
+// hashed to one bit per level; keys alone on their bit set it and stop,
+// colliding keys fall through to the next level. A key's slot is the rank
+// of its bit over all levels, counted with a cumulative rank every 256 bits.
+//
+// Size per key: about gamma * e^(1/gamma) bits of levels (3.3 at gamma 2)
+// plus 1/8 of that for ranks, plus 16 fingerprint bits. False-positive rate
+// for a non-member is at most 2^-16.
+//
+// Data layout after the AllowlistHeader (all little-endian, 8-byte aligned):
+//   Table                       levels and the word offset of each
+//   uint64_t words[total]       all levels, back to back
+//   uint32_t ranks[blocks]      set bits before each 4-word block
+//   uint16_t fingerprints[n]    indexed by slot
+//
+// Pure C++, shared by the firmware and the host tools. The builder is used
+// by tools/bench/allowlist_bench; tools/allowlist_image.py has a Python port
+// that must produce identical images.
+
+namespace PerfectHash {
+  constexpr uint32_t MAX_LEVELS = 24;
+  constexpr uint32_t RANK_BLOCK_WORDS = 4;
+  constexpr uint32_t NOT_FOUND = 0xFFFFFFFF;
+
+  struct Table {
+    uint32_t seed;
+    uint32_t levels;
+    uint32_t wordOffset[MAX_LEVELS + 1];  // Level l is words [wordOffset[l], wordOffset[l + 1])
+    uint32_t reserved;
+  };
+
+  static_assert(sizeof(Table) % 8 == 0, "Words after the table must stay aligned");
+
+  // murmur3 fmix64 of the key salted per level, so levels hash independently
+  inline uint64_t hash(uint64_t key, uint64_t salt) {
+    key ^= salt * 0x9E3779B97F4A7C15ULL;
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+    return key;
+  }
+
+  inline uint32_t levelBit(uint64_t key, uint32_t seed, uint32_t level, uint32_t bits) {
+    const uint64_t h = hash(key, (static_cast<uint64_t>(seed) << 8) | level);
+    return static_cast<uint32_t>(((h >> 32) * bits) >> 32);
+  }
+
+  inline uint16_t fingerprint(uint64_t key, uint32_t seed) {
+    return static_cast<uint16_t>(hash(key, (static_cast<uint64_t>(seed) << 8) | 0xFF) >> 48);
+  }
+
+  inline size_t padTo8(size_t bytes) {
+    return (bytes + 7) & ~static_cast<size_t>(7);
+  }
+
+  inline size_t rankBlocks(uint32_t totalWords) {
+    return (totalWords + RANK_BLOCK_WORDS - 1) / RANK_BLOCK_WORDS;
+  }
+
+  inline size_t dataBytes(uint32_t totalWords, uint32_t count) {
+    return sizeof(Table) + totalWords * sizeof(uint64_t) + padTo8(rankBlocks(totalWords) * sizeof(uint32_t)) +
+           padTo8(count * sizeof(uint16_t));
+  }
+
+  // Read-only view over the data of an image, e.g. straight from a flash
+  // mapping. Holds pointers only.
+  class View {
+  public:
+    bool attach(const uint8_t* data, size_t bytes, uint32_t count) {
+      table_ = nullptr;
+      if (bytes < sizeof(Table)) {
+        return false;
+      }
+      const Table* table = reinterpret_cast<const Table*>(data);
+      if (table->levels > MAX_LEVELS || table->wordOffset[0] != 0) {
+        return false;
+      }
+      for (uint32_t level = 0; level < table->levels; ++level) {
+        if (table->wordOffset[level + 1] <= table->wordOffset[level]) {
+          return false;
+        }
+      }
+      const uint32_t totalWords = table->wordOffset[table->levels];
+      if (dataBytes(totalWords, count) != bytes) {
+        return false;
+      }
+
+      table_ = table;
+      count_ = count;
+      words_ = reinterpret_cast<const uint64_t*>(data + sizeof(Table));
+      ranks_ = reinterpret_cast<const uint32_t*>(words_ + totalWords);
+      fingerprints_ = reinterpret_cast<const uint16_t*>(
+          reinterpret_cast<const uint8_t*>(ranks_) + padTo8(rankBlocks(totalWords) * sizeof(uint32_t)));
+      return true;
+    }
+
+    // Slot in [0, n) for a member; any slot or NOT_FOUND for a non-member.
+    uint32_t slot(uint64_t key) const {
+      for (uint32_t level = 0; level < table_->levels; ++level) {
+        const uint32_t first = table_->wordOffset[level];
+        const uint32_t bits = (table_->wordOffset[level + 1] - first) * 64;
+        const uint32_t bit = first * 64 + levelBit(key, table_->seed, level, bits);
+        if ((words_[bit / 64] >> (bit % 64)) & 1) {
+          return rank(bit);
+        }
+      }
+      return NOT_FOUND;
+    }
+
+    // Slot of a member, NOT_FOUND otherwise (up to false positives)
+    uint32_t find(uint64_t key) const {
+      const uint32_t index = slot(key);
+      return index < count_ && fingerprints_[index] == fingerprint(key, table_->seed) ? index : NOT_FOUND;
+    }
+
+    bool contains(uint64_t key) const {
+      return find(key) != NOT_FOUND;
+    }
+
+    uint32_t levels() const {
+      return table_->levels;
+    }
+
+  private:
+    const Table* table_ = nullptr;
+    const uint64_t* words_ = nullptr;
+    const uint32_t* ranks_ = nullptr;
+    const uint16_t* fingerprints_ = nullptr;
+    uint32_t count_ = 0;
+
+    uint32_t rank(uint32_t bit) const {
+      const uint32_t word = bit / 64;
+      uint32_t result = ranks_[word / RANK_BLOCK_WORDS];
+      for (uint32_t w = word - word % RANK_BLOCK_WORDS; w < word; ++w) {
+        result += __builtin_popcountll(words_[w]);
+      }
+      return result + __builtin_popcountll(words_[word] & ((1ULL << (bit % 64)) - 1));
+    }
+  };
+
+  // Builds the data section for a set of distinct keys. Fails if keys are
+  // left after MAX_LEVELS (duplicates, or a very unlucky seed: retry with
+  // another). gamma trades space for build time and lookup depth; 2 is
+  // the usual choice.
+  inline bool build(const uint64_t* keys, uint32_t count, uint32_t seed, double gamma, std::vector<uint8_t>& out) {
+    std::vector<uint64_t> words;
+    std::vector<uint64_t> remaining(keys, keys + count);
+    std::vector<uint64_t> next;
+    std::vector<uint64_t> collided;
+    Table table = {};
+    table.seed = seed;
+
+    while (!remaining.empty()) {
+      if (table.levels == MAX_LEVELS) {
+        return false;
+      }
+      const uint32_t levelWords = static_cast<uint32_t>(gamma * remaining.size() / 64) + 1;
+      const uint32_t bits = levelWords * 64;
+      const size_t first = words.size();
+      words.resize(first + levelWords, 0);
+      collided.assign(levelWords, 0);
+
+      for (const uint64_t key : remaining) {
+        const uint32_t bit = levelBit(key, seed, table.levels, bits);
+        uint64_t& word = words[first + bit / 64];
+        const uint64_t mask = 1ULL << (bit % 64);
+        if (word & mask) {
+          collided[bit / 64] |= mask;
+        }
+        word |= mask;
+      }
+      next.clear();
+      for (const uint64_t key : remaining) {
+        const uint32_t bit = levelBit(key, seed, table.levels, bits);
+        if (collided[bit / 64] & (1ULL << (bit % 64))) {
+          next.push_back(key);
+        }
+      }
+      for (uint32_t w = 0; w < levelWords; ++w) {
+        words[first + w] &= ~collided[w];
+      }
+
+      ++table.levels;
+      table.wordOffset[table.levels] = static_cast<uint32_t>(words.size());
+      remaining.swap(next);
+    }
+
+    const uint32_t totalWords = static_cast<uint32_t>(words.size());
+    out.assign(dataBytes(totalWords, count), 0);
+    memcpy(out.data(), &table, sizeof(table));
+    memcpy(out.data() + sizeof(table), words.data(), totalWords * sizeof(uint64_t));
+
+    uint32_t* ranks = reinterpret_cast<uint32_t*>(out.data() + sizeof(table) + totalWords * sizeof(uint64_t));
+    uint32_t setBits = 0;
+    for (uint32_t w = 0; w < totalWords; ++w) {
+      if (w % RANK_BLOCK_WORDS == 0) {
+        ranks[w / RANK_BLOCK_WORDS] = setBits;
+      }
+      setBits += __builtin_popcountll(words[w]);
+    }
+
+    View view;
+    if (setBits != count || !view.attach(out.data(), out.size(), count)) {
+      return false;
+    }
+    uint16_t* fingerprints = reinterpret_cast<uint16_t*>(out.data() + out.size() - padTo8(count * sizeof(uint16_t)));
+    for (uint32_t i = 0; i < count; ++i) {
+      const uint32_t index = view.slot(keys[i]);
+      if (index >= count) {
+        return false;
+      }
+      fingerprints[index] = fingerprint(keys[i], seed);
+    }
+    return true;
+  }
+}
@@ -0,0 +1,1104 @@
+#pragma once
+
+#include <stdint.h>
+
+// Generated by tools/plate_font.py; edit the outlines there, not this file.
+//
+// Plate glyphs at several pixel heights, stored as columns of SSD1306
+// pages (least significant bit on top). See PlateRenderer.h.
+
+namespace PlateFont {
+  inline constexpr char CHARSET[] = " -.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  constexpr uint8_t GLYPH_COUNT = 39;
+
+  struct Glyph {
+    uint16_t offset;  // Into the size's columns
+    uint8_t width;
+  };
+
+  struct Size {
+    uint8_t height;
+    uint8_t gap;  // Columns between glyphs
+    const Glyph* glyphs;
+    const uint8_t* columns;
+  };
+
+  inline constexpr uint8_t COLUMNS_8[] = {
+      0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x80, 0x7E, 0xA1, 0x99, 0x85, 0x7E, 0x00, 0x82, 0xFF, 0x80,
+      0x00, 0x82, 0xC1, 0xB1, 0x99, 0x8E, 0x42, 0x81, 0x99, 0x99, 0x7E, 0x30, 0x38, 0x26, 0xFF, 0x20,
+      0x5F, 0x99, 0x99, 0x99, 0x71, 0x7E, 0x99, 0x99, 0x99, 0x70, 0x01, 0x01, 0xF1, 0x0D, 0x07, 0x7E,
+      0x99, 0x99, 0x99, 0x7E, 0x0E, 0x99, 0x99, 0x99, 0x7E, 0xFE, 0x19, 0x19, 0x19, 0xFE, 0xFF, 0x99,
+      0x99, 0x99, 0x7E, 0x7E, 0x81, 0x81, 0x81, 0x42, 0xFF, 0x81, 0x81, 0x81, 0x7E, 0xFF, 0x99, 0x99,
+      0x99, 0x81, 0xFF, 0x19, 0x19, 0x19, 0x01, 0x7E, 0x81, 0x99, 0x99, 0x7A, 0xFF, 0x18, 0x18, 0x18,
+      0xFF, 0x00, 0x81, 0xFF, 0x81, 0x00, 0x40, 0x80, 0x80, 0x80, 0x7F, 0xFF, 0x18, 0x1C, 0x62, 0x81,
+      0xFF, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x06, 0x18, 0x06, 0xFF, 0xFF, 0x06, 0x18, 0x60, 0xFF, 0x7E,
+      0x81, 0x81, 0x81, 0x7E, 0xFF, 0x19, 0x19, 0x19, 0x0E, 0x7E, 0x81, 0x81, 0xC1, 0xFE, 0xFF, 0x19,
+      0x19, 0x79, 0xCE, 0x4E, 0x99, 0x99, 0x99, 0x72, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x7F, 0x80, 0x80,
+      0x80, 0x7F, 0x1F, 0x60, 0xC0, 0x60, 0x1F, 0xFF, 0x60, 0x18, 0x60, 0xFF, 0xC3, 0x3C, 0x18, 0x3C,
+      0xC3, 0x03, 0x0C, 0xF8, 0x0C, 0x03, 0xC1, 0xB1, 0x99, 0x8D, 0x83,
+  };
+  inline constexpr Glyph GLYPHS_8[] = {
+      {0, 2}, {2, 4}, {6, 1}, {7, 5}, {12, 5}, {17, 5}, {22, 5}, {27, 5},
+      {32, 5}, {37, 5}, {42, 5}, {47, 5}, {52, 5}, {57, 5}, {62, 5}, {67, 5},
+      {72, 5}, {77, 5}, {82, 5}, {87, 5}, {92, 5}, {97, 5}, {102, 5}, {107, 5},
+      {112, 5}, {117, 5}, {122, 5}, {127, 5}, {132, 5}, {137, 5}, {142, 5}, {147, 5},
+      {152, 5}, {157, 5}, {162, 5}, {167, 5}, {172, 5}, {177, 5}, {182, 5},
+  };
+
+  inline constexpr uint8_t COLUMNS_10[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02,
+      0x00, 0x02, 0xFE, 0x01, 0x83, 0x03, 0x61, 0x02, 0x19, 0x02, 0x07, 0x03, 0xFE, 0x01, 0x00, 0x00,
+      0x00, 0x02, 0xFF, 0x03, 0xFF, 0x03, 0x00, 0x02, 0x00, 0x00, 0x06, 0x02, 0x03, 0x03, 0xC1, 0x02,
+      0x61, 0x02, 0x13, 0x02, 0x0E, 0x02, 0x86, 0x01, 0x03, 0x03, 0x31, 0x02, 0x31, 0x02, 0x33, 0x03,
+      0xCE, 0x01, 0x40, 0x00, 0x70, 0x00, 0x4C, 0x00, 0x46, 0x00, 0xFF, 0x03, 0x40, 0x00, 0xBF, 0x01,
+      0x31, 0x03, 0x31, 0x02, 0x31, 0x02, 0x21, 0x03, 0xC1, 0x01, 0xFE, 0x01, 0x33, 0x03, 0x31, 0x02,
+      0x31, 0x02, 0x21, 0x03, 0xC0, 0x01, 0x01, 0x00, 0x01, 0x00, 0xC1, 0x03, 0xE1, 0x03, 0x19, 0x00,
+      0x07, 0x00, 0xCE, 0x01, 0x33, 0x03, 0x31, 0x02, 0x31, 0x02, 0x33, 0x03, 0xCE, 0x01, 0x0E, 0x00,
+      0x13, 0x02, 0x31, 0x02, 0x31, 0x02, 0x33, 0x03, 0xFE, 0x01, 0xFE, 0x03, 0x33, 0x00, 0x31, 0x00,
+      0x31, 0x00, 0x33, 0x00, 0xFE, 0x03, 0xFF, 0x03, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x33, 0x03,
+      0xCE, 0x01, 0xFE, 0x01, 0x03, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x86, 0x01, 0xFF, 0x03,
+      0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0xFE, 0x01, 0xFF, 0x03, 0x31, 0x02, 0x31, 0x02,
+      0x31, 0x02, 0x01, 0x02, 0x01, 0x02, 0xFF, 0x03, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x01, 0x00,
+      0x01, 0x00, 0xFE, 0x01, 0x03, 0x03, 0x01, 0x02, 0x31, 0x02, 0x33, 0x03, 0xF6, 0x01, 0xFF, 0x03,
+      0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x03,
+      0xFF, 0x03, 0x01, 0x02, 0x00, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03,
+      0xFF, 0x01, 0xFF, 0x03, 0x20, 0x00, 0x18, 0x00, 0x6C, 0x00, 0x82, 0x01, 0x01, 0x02, 0xFF, 0x03,
+      0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xFF, 0x03, 0x06, 0x00, 0x18, 0x00,
+      0x18, 0x00, 0x06, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x06, 0x00, 0x18, 0x00, 0x60, 0x00, 0x80, 0x01,
+      0xFF, 0x03, 0xFE, 0x01, 0x03, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0xFE, 0x01, 0xFF, 0x03,
+      0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x13, 0x00, 0x0E, 0x00, 0xFE, 0x01, 0x03, 0x03, 0x01, 0x02,
+      0x81, 0x02, 0x03, 0x03, 0xFE, 0x03, 0xFF, 0x03, 0x31, 0x00, 0x31, 0x00, 0x71, 0x00, 0x93, 0x01,
+      0x0E, 0x03, 0x8E, 0x01, 0x13, 0x03, 0x31, 0x02, 0x31, 0x02, 0x23, 0x03, 0xC6, 0x01, 0x01, 0x00,
+      0x01, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x03, 0x00, 0x02,
+      0x00, 0x02, 0x00, 0x03, 0xFF, 0x01, 0x3F, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x03, 0xC0, 0x00,
+      0x3F, 0x00, 0xFF, 0x03, 0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x80, 0x01, 0xFF, 0x03, 0x87, 0x03,
+      0xCC, 0x00, 0x30, 0x00, 0x30, 0x00, 0xCC, 0x00, 0x87, 0x03, 0x07, 0x00, 0x0C, 0x00, 0xF0, 0x03,
+      0xF0, 0x03, 0x0C, 0x00, 0x07, 0x00, 0x81, 0x03, 0xC1, 0x02, 0x21, 0x02, 0x11, 0x02, 0x0D, 0x02,
+      0x07, 0x02,
+  };
+  inline constexpr Glyph GLYPHS_10[] = {
+      {0, 3}, {6, 4}, {14, 2}, {18, 6}, {30, 6}, {42, 6}, {54, 6}, {66, 6},
+      {78, 6}, {90, 6}, {102, 6}, {114, 6}, {126, 6}, {138, 6}, {150, 6}, {162, 6},
+      {174, 6}, {186, 6}, {198, 6}, {210, 6}, {222, 6}, {234, 6}, {246, 6}, {258, 6},
+      {270, 6}, {282, 6}, {294, 6}, {306, 6}, {318, 6}, {330, 6}, {342, 6}, {354, 6},
+      {366, 6}, {378, 6}, {390, 6}, {402, 6}, {414, 6}, {426, 6}, {438, 6},
+  };
+
+  inline constexpr uint8_t COLUMNS_12[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
+      0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0xFC, 0x03, 0xFF, 0x0F, 0xC3, 0x0D, 0xF3, 0x0C, 0x3B, 0x0C,
+      0xFF, 0x0F, 0xFC, 0x03, 0x00, 0x00, 0x04, 0x0C, 0xFE, 0x0F, 0xFF, 0x0F, 0xFE, 0x0F, 0x00, 0x0C,
+      0x00, 0x00, 0x0C, 0x0C, 0x0F, 0x0E, 0x83, 0x0F, 0xC3, 0x0D, 0xE3, 0x0C, 0x7F, 0x0C, 0x1C, 0x0C,
+      0x0C, 0x03, 0x0F, 0x0F, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFF, 0x0F, 0x9C, 0x03, 0x80, 0x01,
+      0xE0, 0x01, 0xF8, 0x01, 0x9E, 0x01, 0xFF, 0x0F, 0xFF, 0x0F, 0x80, 0x01, 0x7F, 0x03, 0x7F, 0x0F,
+      0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xE3, 0x0F, 0x83, 0x03, 0xFC, 0x03, 0xFF, 0x0F, 0x63, 0x0C,
+      0x63, 0x0C, 0x63, 0x0C, 0xE3, 0x0F, 0x80, 0x03, 0x03, 0x00, 0x03, 0x00, 0x03, 0x07, 0xE3, 0x0F,
+      0xFB, 0x07, 0x3F, 0x00, 0x0F, 0x00, 0x9C, 0x03, 0xFF, 0x0F, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C,
+      0xFF, 0x0F, 0x9C, 0x03, 0x1C, 0x00, 0x7F, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFF, 0x0F,
+      0xFC, 0x03, 0xFC, 0x0F, 0xFF, 0x0F, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0xFF, 0x0F, 0xFC, 0x0F,
+      0xFF, 0x0F, 0xFF, 0x0F, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFF, 0x0F, 0x9C, 0x03, 0xFC, 0x03,
+      0xFF, 0x0F, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x0F, 0x0F, 0x0C, 0x03, 0xFF, 0x0F, 0xFF, 0x0F,
+      0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0xFF, 0x0F, 0xFC, 0x03, 0xFF, 0x0F, 0xFF, 0x0F, 0x63, 0x0C,
+      0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x03, 0x0C, 0xFF, 0x0F, 0xFF, 0x0F, 0x63, 0x00, 0x63, 0x00,
+      0x63, 0x00, 0x63, 0x00, 0x03, 0x00, 0xFC, 0x03, 0xFF, 0x0F, 0x03, 0x0C, 0x63, 0x0C, 0x63, 0x0C,
+      0xEF, 0x0F, 0xEC, 0x03, 0xFF, 0x0F, 0xFF, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xFF, 0x0F,
+      0xFF, 0x0F, 0x00, 0x00, 0x03, 0x0C, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0x03, 0x0C, 0x00, 0x00,
+      0x00, 0x03, 0x00, 0x0F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0x0F,
+      0xFF, 0x0F, 0x70, 0x00, 0xF8, 0x00, 0xDE, 0x03, 0x07, 0x0F, 0x03, 0x0C, 0xFF, 0x0F, 0xFF, 0x0F,
+      0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0xFF, 0x0F, 0xFF, 0x0F, 0x3C, 0x00,
+      0x70, 0x00, 0x3C, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0x3C, 0x00, 0xF0, 0x00,
+      0xC0, 0x03, 0xFF, 0x0F, 0xFF, 0x0F, 0xFC, 0x03, 0xFF, 0x0F, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C,
+      0xFF, 0x0F, 0xFC, 0x03, 0xFF, 0x0F, 0xFF, 0x0F, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x7F, 0x00,
+      0x1C, 0x00, 0xFC, 0x03, 0xFF, 0x0F, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0F, 0xFF, 0x0F, 0xFC, 0x0F,
+      0xFF, 0x0F, 0xFF, 0x0F, 0x63, 0x00, 0xE3, 0x00, 0xE3, 0x03, 0x7F, 0x0F, 0x1C, 0x0C, 0x1C, 0x03,
+      0x7F, 0x0F, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xEF, 0x0F, 0x8C, 0x03, 0x03, 0x00, 0x03, 0x00,
+      0xFF, 0x07, 0xFF, 0x0F, 0xFF, 0x07, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x03, 0xFF, 0x0F, 0x00, 0x0C,
+      0x00, 0x0C, 0x00, 0x0C, 0xFF, 0x0F, 0xFF, 0x03, 0x7F, 0x00, 0xFF, 0x01, 0x80, 0x07, 0x00, 0x0E,
+      0x80, 0x07, 0xFF, 0x01, 0x7F, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xC0, 0x03,
+      0xFF, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0x9F, 0x0F, 0xF8, 0x01, 0xF0, 0x00, 0xF8, 0x01, 0x9F, 0x0F,
+      0x0F, 0x0F, 0x0F, 0x00, 0x1F, 0x00, 0xF8, 0x07, 0xF0, 0x0F, 0xF8, 0x07, 0x1F, 0x00, 0x0F, 0x00,
+      0x03, 0x0F, 0x83, 0x0F, 0xC3, 0x0D, 0xF3, 0x0C, 0x3B, 0x0C, 0x1F, 0x0C, 0x0F, 0x0C,
+  };
+  inline constexpr Glyph GLYPHS_12[] = {
+      {0, 4}, {8, 5}, {18, 2}, {22, 7}, {36, 7}, {50, 7}, {64, 7}, {78, 7},
+      {92, 7}, {106, 7}, {120, 7}, {134, 7}, {148, 7}, {162, 7}, {176, 7}, {190, 7},
+      {204, 7}, {218, 7}, {232, 7}, {246, 7}, {260, 7}, {274, 7}, {288, 7}, {302, 7},
+      {316, 7}, {330, 7}, {344, 7}, {358, 7}, {372, 7}, {386, 7}, {400, 7}, {414, 7},
+      {428, 7}, {442, 7}, {456, 7}, {470, 7}, {484, 7}, {498, 7}, {512, 7},
+  };
+
+  inline constexpr uint8_t COLUMNS_14[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+      0xC0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x3F, 0xC3, 0x33,
+      0xF3, 0x30, 0x3F, 0x38, 0xFE, 0x1F, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x30, 0xFF, 0x3F,
+      0xFF, 0x3F, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x30, 0x0E, 0x38, 0x07, 0x3E, 0x03, 0x37,
+      0x83, 0x33, 0xE7, 0x31, 0x7E, 0x30, 0x3C, 0x30, 0x0C, 0x0C, 0x0E, 0x1C, 0xC7, 0x38, 0xC3, 0x30,
+      0xC3, 0x30, 0xE7, 0x39, 0xFE, 0x1F, 0x3C, 0x0F, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0x78, 0x03,
+      0xFE, 0x1F, 0xFF, 0x3F, 0xFE, 0x1F, 0x00, 0x03, 0xFF, 0x0C, 0xFF, 0x1C, 0xC3, 0x38, 0xC3, 0x30,
+      0xC3, 0x30, 0xC3, 0x39, 0x83, 0x1F, 0x03, 0x0F, 0xFC, 0x0F, 0xFE, 0x1F, 0xC7, 0x38, 0xC3, 0x30,
+      0xC3, 0x30, 0xC3, 0x39, 0x80, 0x1F, 0x00, 0x0F, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x3F,
+      0xC3, 0x3F, 0xF3, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x3C, 0x0F, 0xFE, 0x1F, 0xE7, 0x39, 0xC3, 0x30,
+      0xC3, 0x30, 0xE7, 0x39, 0xFE, 0x1F, 0x3C, 0x0F, 0x3C, 0x00, 0x7E, 0x00, 0xE7, 0x30, 0xC3, 0x30,
+      0xC3, 0x30, 0xC7, 0x38, 0xFE, 0x1F, 0xFC, 0x0F, 0xFC, 0x3F, 0xFE, 0x3F, 0xC7, 0x00, 0xC3, 0x00,
+      0xC3, 0x00, 0xC7, 0x00, 0xFE, 0x3F, 0xFC, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xC3, 0x30, 0xC3, 0x30,
+      0xC3, 0x30, 0xE7, 0x39, 0xFE, 0x1F, 0x3C, 0x0F, 0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x38, 0x03, 0x30,
+      0x03, 0x30, 0x07, 0x38, 0x0E, 0x1C, 0x0C, 0x0C, 0xFF, 0x3F, 0xFF, 0x3F, 0x03, 0x30, 0x03, 0x30,
+      0x03, 0x30, 0x07, 0x38, 0xFE, 0x1F, 0xFC, 0x0F, 0xFF, 0x3F, 0xFF, 0x3F, 0xC3, 0x30, 0xC3, 0x30,
+      0xC3, 0x30, 0xC3, 0x30, 0x03, 0x30, 0x03, 0x30, 0xFF, 0x3F, 0xFF, 0x3F, 0xC3, 0x00, 0xC3, 0x00,
+      0xC3, 0x00, 0xC3, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x38, 0xC3, 0x30,
+      0xC3, 0x30, 0xC7, 0x38, 0xCE, 0x1F, 0xCC, 0x0F, 0xFF, 0x3F, 0xFF, 0x3F, 0xC0, 0x00, 0xC0, 0x00,
+      0xC0, 0x00, 0xC0, 0x00, 0xFF, 0x3F, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0xFF, 0x3F,
+      0xFF, 0x3F, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x30,
+      0x00, 0x30, 0x00, 0x38, 0xFF, 0x1F, 0xFF, 0x0F, 0xFF, 0x3F, 0xFF, 0x3F, 0xE0, 0x01, 0xF0, 0x01,
+      0xF8, 0x03, 0x1E, 0x0F, 0x07, 0x3C, 0x03, 0x30, 0xFF, 0x3F, 0xFF, 0x3F, 0x00, 0x30, 0x00, 0x30,
+      0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xFF, 0x3F, 0xFF, 0x3F, 0x3C, 0x00, 0xF0, 0x00,
+      0xF0, 0x00, 0x3C, 0x00, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0x3C, 0x00, 0xF0, 0x00,
+      0xC0, 0x03, 0x00, 0x0F, 0xFF, 0x3F, 0xFF, 0x3F, 0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x38, 0x03, 0x30,
+      0x03, 0x30, 0x07, 0x38, 0xFE, 0x1F, 0xFC, 0x0F, 0xFF, 0x3F, 0xFF, 0x3F, 0xC3, 0x00, 0xC3, 0x00,
+      0xC3, 0x00, 0xE7, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0xFC, 0x0F, 0xFE, 0x1F, 0x07, 0x38, 0x03, 0x30,
+      0x03, 0x36, 0x07, 0x3E, 0xFE, 0x3F, 0xFC, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F, 0xC3, 0x00, 0xC3, 0x00,
+      0xC3, 0x03, 0xE7, 0x0F, 0x7E, 0x3C, 0x3C, 0x30, 0x3C, 0x0C, 0x7E, 0x1C, 0xE7, 0x38, 0xC3, 0x30,
+      0xC3, 0x30, 0xC7, 0x39, 0x8E, 0x1F, 0x0C, 0x0F, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x3F,
+      0xFF, 0x3F, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x0F, 0xFF, 0x1F, 0x00, 0x38, 0x00, 0x30,
+      0x00, 0x30, 0x00, 0x38, 0xFF, 0x1F, 0xFF, 0x0F, 0xFF, 0x00, 0xFF, 0x03, 0x00, 0x0F, 0x00, 0x3C,
+      0x00, 0x3C, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0x3F, 0xFF, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
+      0xC0, 0x03, 0x00, 0x0F, 0xFF, 0x3F, 0xFF, 0x3F, 0x0F, 0x3C, 0x1F, 0x3E, 0xF8, 0x07, 0xE0, 0x01,
+      0xE0, 0x01, 0xF8, 0x07, 0x1F, 0x3E, 0x0F, 0x3C, 0x0F, 0x00, 0x1F, 0x00, 0x78, 0x00, 0xE0, 0x3F,
+      0xE0, 0x3F, 0x78, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x03, 0x3C, 0x03, 0x3E, 0x83, 0x37, 0xC3, 0x31,
+      0xE3, 0x30, 0x7B, 0x30, 0x1F, 0x30, 0x0F, 0x30,
+  };
+  inline constexpr Glyph GLYPHS_14[] = {
+      {0, 4}, {8, 6}, {20, 2}, {24, 8}, {40, 8}, {56, 8}, {72, 8}, {88, 8},
+      {104, 8}, {120, 8}, {136, 8}, {152, 8}, {168, 8}, {184, 8}, {200, 8}, {216, 8},
+      {232, 8}, {248, 8}, {264, 8}, {280, 8}, {296, 8}, {312, 8}, {328, 8}, {344, 8},
+      {360, 8}, {376, 8}, {392, 8}, {408, 8}, {424, 8}, {440, 8}, {456, 8}, {472, 8},
+      {488, 8}, {504, 8}, {520, 8}, {536, 8}, {552, 8}, {568, 8}, {584, 8},
+  };
+
+  inline constexpr uint8_t COLUMNS_16[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01,
+      0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0xFC, 0x3F,
+      0xFE, 0x7F, 0x07, 0xEC, 0x03, 0xCE, 0x83, 0xC7, 0xE3, 0xC1, 0x73, 0xC0, 0x37, 0xE0, 0xFE, 0x7F,
+      0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x0E, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0,
+      0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x0E, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x03, 0xCE,
+      0x03, 0xC7, 0x83, 0xC3, 0xC7, 0xC1, 0xFE, 0xC0, 0x7C, 0xC0, 0x0C, 0x30, 0x0E, 0x70, 0x07, 0xE0,
+      0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0xC7, 0xE3, 0xFE, 0x7F, 0x7C, 0x3E, 0x00, 0x06,
+      0x00, 0x07, 0xC0, 0x07, 0xE0, 0x06, 0x78, 0x06, 0x1E, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06,
+      0x00, 0x06, 0xFF, 0x31, 0xFF, 0x71, 0x83, 0xE1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1,
+      0x83, 0xE3, 0x03, 0x7F, 0x03, 0x3E, 0xFC, 0x3F, 0xFE, 0x7F, 0x87, 0xE1, 0x83, 0xC1, 0x83, 0xC1,
+      0x83, 0xC1, 0x83, 0xC1, 0x83, 0xE3, 0x00, 0x7F, 0x00, 0x3E, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+      0x03, 0x00, 0x03, 0xFE, 0x83, 0xFF, 0xC3, 0x03, 0xF3, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x7C, 0x3E,
+      0xFE, 0x7F, 0xC7, 0xE3, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0xC7, 0xE3, 0xFE, 0x7F,
+      0x7C, 0x3E, 0x7C, 0x00, 0xFE, 0x00, 0xC7, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1,
+      0x87, 0xE1, 0xFE, 0x7F, 0xFC, 0x3F, 0xFC, 0xFF, 0xFE, 0xFF, 0x87, 0x01, 0x83, 0x01, 0x83, 0x01,
+      0x83, 0x01, 0x83, 0x01, 0x87, 0x01, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xC1,
+      0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0xC7, 0xE3, 0xFE, 0x7F, 0x7C, 0x3E, 0xFC, 0x3F,
+      0xFE, 0x7F, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x0E, 0x70,
+      0x0C, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+      0x07, 0xE0, 0xFE, 0x7F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1,
+      0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x03, 0xC0, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x01,
+      0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x03, 0x00, 0x03, 0x00, 0xFC, 0x3F,
+      0xFE, 0x7F, 0x07, 0xE0, 0x03, 0xC0, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x87, 0xE1, 0x8E, 0x7F,
+      0x8C, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+      0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0xFF, 0xFF,
+      0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x70, 0x00, 0xE0,
+      0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0xFF, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF,
+      0xFF, 0xFF, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x03, 0xF0, 0x07, 0x1C, 0x1E, 0x0E, 0x38, 0x07, 0xF0,
+      0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+      0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x78, 0x00, 0xE0, 0x01,
+      0xE0, 0x01, 0x78, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00,
+      0x78, 0x00, 0xE0, 0x01, 0x80, 0x07, 0x00, 0x1E, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
+      0xFE, 0x7F, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0xFE, 0x7F,
+      0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,
+      0xC7, 0x01, 0xFE, 0x00, 0x7C, 0x00, 0xFC, 0x3F, 0xFE, 0x7F, 0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0,
+      0x03, 0xC8, 0x03, 0xF8, 0x07, 0xF0, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x01,
+      0x83, 0x01, 0x83, 0x01, 0x83, 0x07, 0x83, 0x1F, 0xC7, 0x3D, 0xFE, 0xF0, 0x7C, 0xC0, 0x7C, 0x30,
+      0xFE, 0x70, 0xC7, 0xE1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x87, 0xE3, 0x0E, 0x7F,
+      0x0C, 0x3E, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+      0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x3F, 0xFF, 0x7F, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0xC0,
+      0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0xFF, 0x7F, 0xFF, 0x3F, 0xFF, 0x01, 0xFF, 0x07, 0x00, 0x1E,
+      0x00, 0x3C, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xFF,
+      0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x1E, 0x80, 0x07, 0x80, 0x07, 0x00, 0x1E, 0x00, 0x3C, 0xFF, 0xFF,
+      0xFF, 0xFF, 0x0F, 0xF0, 0x1F, 0xF8, 0x70, 0x0E, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07,
+      0x70, 0x0E, 0x1F, 0xF8, 0x0F, 0xF0, 0x0F, 0x00, 0x1F, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0xFF,
+      0xC0, 0xFF, 0xE0, 0x00, 0x70, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xCE,
+      0x03, 0xC7, 0x83, 0xC3, 0xC3, 0xC1, 0xE3, 0xC0, 0x73, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0,
+  };
+  inline constexpr Glyph GLYPHS_16[] = {
+      {0, 5}, {10, 8}, {26, 2}, {30, 10}, {50, 10}, {70, 10}, {90, 10}, {110, 10},
+      {130, 10}, {150, 10}, {170, 10}, {190, 10}, {210, 10}, {230, 10}, {250, 10}, {270, 10},
+      {290, 10}, {310, 10}, {330, 10}, {350, 10}, {370, 10}, {390, 10}, {410, 10}, {430, 10},
+      {450, 10}, {470, 10}, {490, 10}, {510, 10}, {530, 10}, {550, 10}, {570, 10}, {590, 10},
+      {610, 10}, {630, 10}, {650, 10}, {670, 10}, {690, 10}, {710, 10}, {730, 10},
+  };
+
+  inline constexpr uint8_t COLUMNS_20[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06,
+      0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xFC, 0xFF, 0x03, 0x0E, 0x40, 0x07, 0x07,
+      0xF0, 0x0E, 0x03, 0x78, 0x0C, 0x03, 0x1E, 0x0C, 0x83, 0x07, 0x0C, 0xE3, 0x01, 0x0C, 0xF7, 0x00,
+      0x0E, 0x2E, 0x00, 0x07, 0xFC, 0xFF, 0x03, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x1C, 0x00, 0x0C, 0x0E, 0x00, 0x0C, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x00,
+      0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+      0x0C, 0x1C, 0x00, 0x0E, 0x0E, 0x00, 0x0F, 0x07, 0xC0, 0x0F, 0x03, 0xE0, 0x0C, 0x03, 0x70, 0x0C,
+      0x03, 0x38, 0x0C, 0x03, 0x1C, 0x0C, 0x07, 0x0F, 0x0C, 0x8E, 0x03, 0x0C, 0xFC, 0x01, 0x0C, 0xF8,
+      0x00, 0x0C, 0x18, 0x80, 0x01, 0x1C, 0x80, 0x03, 0x0E, 0x00, 0x07, 0x07, 0x00, 0x0E, 0x03, 0x06,
+      0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x07, 0x0F, 0x0E, 0x8E, 0x1F, 0x07,
+      0xFC, 0xF9, 0x03, 0xF8, 0xF0, 0x01, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x80,
+      0x37, 0x00, 0xC0, 0x31, 0x00, 0xF0, 0x30, 0x00, 0x3C, 0x30, 0x00, 0xFE, 0xFF, 0x07, 0xFF, 0xFF,
+      0x0F, 0xFE, 0xFF, 0x07, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0xFF, 0x87, 0x01, 0xFF, 0x87, 0x03,
+      0x03, 0x06, 0x07, 0x03, 0x06, 0x0E, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03,
+      0x06, 0x0C, 0x03, 0x0E, 0x0E, 0x03, 0x1C, 0x07, 0x03, 0xF8, 0x03, 0x03, 0xF0, 0x01, 0xF8, 0xFF,
+      0x01, 0xFC, 0xFF, 0x03, 0x0E, 0x06, 0x07, 0x07, 0x06, 0x0E, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C,
+      0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x0E, 0x0E, 0x00, 0x1C, 0x07, 0x00, 0xF8, 0x03, 0x00,
+      0xF0, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+      0x00, 0x03, 0xF0, 0x0F, 0x03, 0xFC, 0x0F, 0x03, 0x0F, 0x00, 0xC3, 0x07, 0x00, 0xE3, 0x01, 0x00,
+      0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0xF0, 0x01, 0xFC, 0xF9, 0x03, 0x8E, 0x1F, 0x07, 0x07,
+      0x0F, 0x0E, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x07, 0x0F,
+      0x0E, 0x8E, 0x1F, 0x07, 0xFC, 0xF9, 0x03, 0xF8, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x01, 0x00,
+      0x8E, 0x03, 0x00, 0x07, 0x07, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03,
+      0x06, 0x0C, 0x07, 0x06, 0x0E, 0x0E, 0x06, 0x07, 0xFC, 0xFF, 0x03, 0xF8, 0xFF, 0x01, 0xF8, 0xFF,
+      0x0F, 0xFC, 0xFF, 0x0F, 0x0E, 0x06, 0x00, 0x07, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00,
+      0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x07, 0x06, 0x00, 0x0E, 0x06, 0x00, 0xFC, 0xFF, 0x0F, 0xF8,
+      0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06,
+      0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x07, 0x0F, 0x0E, 0x8E, 0x1F, 0x07,
+      0xFC, 0xF9, 0x03, 0xF8, 0xF0, 0x01, 0xF8, 0xFF, 0x01, 0xFC, 0xFF, 0x03, 0x0E, 0x00, 0x07, 0x07,
+      0x00, 0x0E, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x07, 0x00,
+      0x0E, 0x0E, 0x00, 0x07, 0x1C, 0x80, 0x03, 0x18, 0x80, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F,
+      0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03,
+      0x00, 0x0C, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x07, 0xFC, 0xFF, 0x03, 0xF8, 0xFF, 0x01, 0xFF, 0xFF,
+      0x0F, 0xFF, 0xFF, 0x0F, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C,
+      0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03,
+      0x00, 0x0C, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06,
+      0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x00, 0x00,
+      0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xFC, 0xFF, 0x03, 0x0E, 0x00, 0x07, 0x07,
+      0x00, 0x0E, 0x03, 0x00, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x07, 0x06,
+      0x0E, 0x0E, 0x06, 0x07, 0x1C, 0xFE, 0x03, 0x18, 0xFE, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F,
+      0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00,
+      0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0xFF, 0xFF, 0x0F,
+      0xFF, 0xFF, 0x0F, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00,
+      0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07,
+      0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x00, 0x1C, 0x00, 0x00,
+      0x0F, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x0F, 0x00, 0xE0, 0x1E, 0x00, 0x70, 0x78, 0x00, 0x3C, 0xE0,
+      0x01, 0x0E, 0x80, 0x03, 0x07, 0x00, 0x0F, 0x03, 0x00, 0x0C, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F,
+      0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00,
+      0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0xFF, 0xFF,
+      0x0F, 0xFF, 0xFF, 0x0F, 0x3C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x80, 0x07, 0x00,
+      0x80, 0x07, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF,
+      0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x3C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x01,
+      0x00, 0x80, 0x07, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x01, 0x00, 0xC0, 0x03,
+      0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0x01, 0xFC, 0xFF, 0x03, 0x0E, 0x00, 0x07, 0x07,
+      0x00, 0x0E, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x07, 0x00,
+      0x0E, 0x0E, 0x00, 0x07, 0xFC, 0xFF, 0x03, 0xF8, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F,
+      0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03,
+      0x06, 0x00, 0x07, 0x07, 0x00, 0x8E, 0x03, 0x00, 0xFC, 0x01, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0xFF,
+      0x01, 0xFC, 0xFF, 0x03, 0x0E, 0x00, 0x07, 0x07, 0x00, 0x0E, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C,
+      0x03, 0x40, 0x0C, 0x03, 0xC0, 0x0C, 0x07, 0xC0, 0x0F, 0x0E, 0x00, 0x07, 0xFC, 0xFF, 0x0F, 0xF8,
+      0xFF, 0x0D, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06,
+      0x00, 0x03, 0x06, 0x00, 0x03, 0x1E, 0x00, 0x03, 0x7E, 0x00, 0x07, 0xF7, 0x01, 0x8E, 0xC3, 0x03,
+      0xFC, 0x01, 0x0F, 0xF8, 0x00, 0x0C, 0xF8, 0x80, 0x01, 0xFC, 0x81, 0x03, 0x8E, 0x03, 0x07, 0x07,
+      0x07, 0x0E, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x03, 0x06, 0x0C, 0x07, 0x0E,
+      0x0E, 0x0E, 0x1C, 0x07, 0x1C, 0xF8, 0x03, 0x18, 0xF0, 0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+      0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x03,
+      0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0xFF,
+      0x01, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C,
+      0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x03, 0xFF,
+      0xFF, 0x01, 0xFF, 0x07, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x01, 0x00, 0xC0,
+      0x03, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x03, 0x00, 0xF0, 0x01, 0x00, 0x78, 0x00,
+      0xFF, 0x1F, 0x00, 0xFF, 0x07, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x00, 0xC0, 0x03, 0x00,
+      0xF0, 0x01, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0,
+      0x01, 0x00, 0xC0, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0x1F, 0x80, 0x0F, 0x3F, 0xC0, 0x0F,
+      0x70, 0xE0, 0x00, 0xE0, 0x79, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x80,
+      0x1F, 0x00, 0xE0, 0x79, 0x00, 0x70, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0x1F, 0x80, 0x0F, 0x1F, 0x00,
+      0x00, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0xFF, 0x0F,
+      0x00, 0xFF, 0x0F, 0x80, 0x03, 0x00, 0xE0, 0x01, 0x00, 0x70, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
+      0x00, 0x00, 0x03, 0x80, 0x0F, 0x03, 0xC0, 0x0F, 0x03, 0xE0, 0x0C, 0x03, 0x78, 0x0C, 0x03, 0x1C,
+      0x0C, 0x03, 0x0E, 0x0C, 0x03, 0x07, 0x0C, 0x83, 0x03, 0x0C, 0xE3, 0x01, 0x0C, 0x73, 0x00, 0x0C,
+      0x3F, 0x00, 0x0C, 0x1F, 0x00, 0x0C,
+  };
+  inline constexpr Glyph GLYPHS_20[] = {
+      {0, 6}, {18, 9}, {45, 3}, {54, 12}, {90, 12}, {126, 12}, {162, 12}, {198, 12},
+      {234, 12}, {270, 12}, {306, 12}, {342, 12}, {378, 12}, {414, 12}, {450, 12}, {486, 12},
+      {522, 12}, {558, 12}, {594, 12}, {630, 12}, {666, 12}, {702, 12}, {738, 12}, {774, 12},
+      {810, 12}, {846, 12}, {882, 12}, {918, 12}, {954, 12}, {990, 12}, {1026, 12}, {1062, 12},
+      {1098, 12}, {1134, 12}, {1170, 12}, {1206, 12}, {1242, 12}, {1278, 12}, {1314, 12},
+  };
+
+  inline constexpr uint8_t COLUMNS_24[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3C,
+      0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x40, 0xF0,
+      0xFF, 0x0F, 0xF8, 0xFF, 0x1F, 0xFE, 0xFF, 0x7F, 0x1F, 0x80, 0xFF, 0x0F, 0xC0, 0xF7, 0x07, 0xF0,
+      0xE3, 0x07, 0xFC, 0xE0, 0x07, 0x3F, 0xE0, 0xC7, 0x0F, 0xE0, 0xEF, 0x03, 0xF0, 0xFF, 0x01, 0xF8,
+      0xFE, 0xFF, 0x7F, 0xF8, 0xFF, 0x1F, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x30, 0x00, 0xE0, 0x3C, 0x00, 0xE0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x30, 0x00, 0xE0, 0x78, 0x00, 0xF0, 0x3E, 0x00, 0xF8, 0x1F, 0x00, 0xFC, 0x0F,
+      0x00, 0xFF, 0x07, 0x80, 0xEF, 0x07, 0xC0, 0xE7, 0x07, 0xF0, 0xE1, 0x07, 0xF8, 0xE0, 0x0F, 0x7C,
+      0xE0, 0x1F, 0x1E, 0xE0, 0xFE, 0x0F, 0xE0, 0xF8, 0x07, 0xE0, 0xF0, 0x03, 0xE0, 0x30, 0x00, 0x0C,
+      0x78, 0x00, 0x1E, 0x3E, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x0F, 0x18, 0xF0, 0x07, 0x18, 0xE0, 0x07,
+      0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x0F, 0x3C, 0xF0, 0x1F, 0x7E, 0xF8, 0xFE, 0xFF,
+      0x7F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x0F, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x01,
+      0x00, 0xFE, 0x01, 0x80, 0xDF, 0x01, 0xC0, 0xCF, 0x01, 0xF0, 0xC3, 0x01, 0xFC, 0xC0, 0x01, 0xFE,
+      0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xC0,
+      0x01, 0xFF, 0x1F, 0x0C, 0xFF, 0x3F, 0x1E, 0xFF, 0x3F, 0x7C, 0x07, 0x3C, 0xF8, 0x07, 0x3C, 0xF0,
+      0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xF0, 0x07,
+      0x78, 0xF8, 0x07, 0xF0, 0x7F, 0x07, 0xE0, 0x1F, 0x07, 0xC0, 0x0F, 0xF0, 0xFF, 0x0F, 0xF8, 0xFF,
+      0x1F, 0xFE, 0xFF, 0x7F, 0x1F, 0x3C, 0xF8, 0x0F, 0x3C, 0xF0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0,
+      0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xF0, 0x07, 0x78, 0xF8, 0x00, 0xF0, 0x7F, 0x00,
+      0xE0, 0x1F, 0x00, 0xC0, 0x0F, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+      0x00, 0x07, 0x00, 0x00, 0x07, 0x80, 0x7F, 0x07, 0xE0, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0xFE, 0x7F,
+      0x87, 0x3F, 0x00, 0xC7, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xF0,
+      0xC3, 0x0F, 0xF8, 0xE7, 0x1F, 0xFE, 0xFF, 0x7F, 0x1F, 0x7E, 0xF8, 0x0F, 0x3C, 0xF0, 0x07, 0x3C,
+      0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x0F, 0x3C, 0xF0, 0x1F, 0x7E, 0xF8,
+      0xFE, 0xFF, 0x7F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x0F, 0xF0, 0x03, 0x00, 0xF8, 0x07, 0x00, 0xFE,
+      0x0F, 0x00, 0x1F, 0x1E, 0xE0, 0x0F, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C,
+      0xE0, 0x07, 0x3C, 0xE0, 0x0F, 0x3C, 0xF0, 0x1F, 0x3C, 0xF8, 0xFE, 0xFF, 0x7F, 0xF8, 0xFF, 0x1F,
+      0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x1F, 0x3C, 0x00, 0x0F,
+      0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x0F, 0x3C,
+      0x00, 0x1F, 0x3C, 0x00, 0xFE, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07,
+      0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x0F, 0x3C, 0xF0, 0x1F, 0x7E, 0xF8, 0xFE, 0xFF,
+      0x7F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x0F, 0xF0, 0xFF, 0x0F, 0xF8, 0xFF, 0x1F, 0xFE, 0xFF, 0x7F,
+      0x1F, 0x00, 0xF8, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07,
+      0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x1F, 0x00, 0xF8, 0x3E, 0x00, 0x7C, 0x78, 0x00, 0x1E, 0x30, 0x00,
+      0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0,
+      0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x1F,
+      0x00, 0xF8, 0xFE, 0xFF, 0x7F, 0xF8, 0xFF, 0x1F, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0,
+      0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x18, 0xE0, 0x07, 0x00, 0xE0, 0x07,
+      0x00, 0xE0, 0x07, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x3C,
+      0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00,
+      0x07, 0x3C, 0x00, 0x07, 0x18, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0xF0,
+      0xFF, 0x0F, 0xF8, 0xFF, 0x1F, 0xFE, 0xFF, 0x7F, 0x1F, 0x00, 0xF8, 0x0F, 0x00, 0xF0, 0x07, 0x00,
+      0xE0, 0x07, 0x18, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x0F, 0x3C, 0xF0, 0x1F, 0x3C, 0xF8,
+      0x3E, 0xFC, 0x7F, 0x78, 0xFC, 0x1F, 0x30, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+      0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x07,
+      0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+      0xE0, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+      0x00, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00,
+      0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+      0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x78, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x7F, 0x00, 0xE0, 0xFB, 0x01, 0xF0,
+      0xF1, 0x03, 0xF8, 0xC0, 0x0F, 0x3C, 0x00, 0x3F, 0x1F, 0x00, 0xFC, 0x0F, 0x00, 0xF8, 0x07, 0x00,
+      0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
+      0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
+      0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0x00, 0xF0, 0x03, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x1F, 0x00,
+      0x00, 0x1F, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01,
+      0x00, 0xF0, 0x03, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0x03,
+      0x00, 0xC0, 0x0F, 0x00, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+      0xFF, 0x0F, 0xF8, 0xFF, 0x1F, 0xFE, 0xFF, 0x7F, 0x1F, 0x00, 0xF8, 0x0F, 0x00, 0xF0, 0x07, 0x00,
+      0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x1F, 0x00, 0xF8,
+      0xFE, 0xFF, 0x7F, 0xF8, 0xFF, 0x1F, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C,
+      0x00, 0x07, 0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x1E, 0x00, 0xFE, 0x0F, 0x00, 0xF8, 0x07, 0x00,
+      0xF0, 0x03, 0x00, 0xF0, 0xFF, 0x0F, 0xF8, 0xFF, 0x1F, 0xFE, 0xFF, 0x7F, 0x1F, 0x00, 0xF8, 0x0F,
+      0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE7, 0x07, 0x00, 0xEF, 0x0F, 0x00,
+      0xFF, 0x1F, 0x00, 0xFC, 0xFE, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07, 0x3C, 0x00, 0x07,
+      0x3C, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0x0F, 0xFC, 0x0F, 0x1F, 0x9E, 0x3F, 0xFE, 0x0F,
+      0xFE, 0xF8, 0x07, 0xF8, 0xF0, 0x03, 0xE0, 0xF0, 0x03, 0x0C, 0xF8, 0x07, 0x1E, 0xFE, 0x0F, 0x7C,
+      0x1F, 0x1E, 0xF8, 0x0F, 0x3C, 0xF0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07, 0x3C, 0xE0, 0x07,
+      0x3C, 0xE0, 0x0F, 0x3C, 0xF0, 0x1F, 0x78, 0xF8, 0x3E, 0xF0, 0x7F, 0x78, 0xE0, 0x1F, 0x30, 0xC0,
+      0x0F, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
+      0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x07, 0x00, 0x00, 0x07,
+      0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+      0x1F, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
+      0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x7F, 0xFF,
+      0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0x1F, 0x00, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xE0,
+      0x07, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F,
+      0x00, 0xC0, 0x1F, 0x00, 0xE0, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0x7F, 0x00, 0xFF, 0x1F, 0x00, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x3F, 0x00, 0xC0, 0x0F, 0x00, 0xF0,
+      0x03, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0x00, 0xC0, 0x0F, 0x00, 0x80, 0x3F,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFC, 0x7F, 0x00, 0xFE, 0xFF,
+      0x81, 0xFF, 0xE0, 0xC3, 0x07, 0xC0, 0xE7, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E,
+      0x00, 0x00, 0xFF, 0x00, 0xC0, 0xE7, 0x03, 0xE0, 0xC3, 0x07, 0xFF, 0x81, 0xFF, 0x7F, 0x00, 0xFE,
+      0x3F, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xE0, 0x03, 0x00, 0xC0,
+      0x07, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0xFE, 0xFF, 0x00, 0xFE, 0xFF, 0x00, 0xFF, 0x7F, 0xC0, 0x07,
+      0x00, 0xE0, 0x03, 0x00, 0xFF, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0x00, 0xFC,
+      0x07, 0x00, 0xFE, 0x07, 0x80, 0xFF, 0x07, 0xC0, 0xE7, 0x07, 0xE0, 0xE3, 0x07, 0xF8, 0xE0, 0x07,
+      0x7C, 0xE0, 0x07, 0x3E, 0xE0, 0x07, 0x1F, 0xE0, 0xC7, 0x07, 0xE0, 0xE7, 0x03, 0xE0, 0xFF, 0x01,
+      0xE0, 0x7F, 0x00, 0xE0, 0x3F, 0x00, 0xE0,
+  };
+  inline constexpr Glyph GLYPHS_24[] = {
+      {0, 7}, {21, 10}, {51, 4}, {63, 14}, {105, 14}, {147, 14}, {189, 14}, {231, 14},
+      {273, 14}, {315, 14}, {357, 14}, {399, 14}, {441, 14}, {483, 14}, {525, 14}, {567, 14},
+      {609, 14}, {651, 14}, {693, 14}, {735, 14}, {777, 14}, {819, 14}, {861, 14}, {903, 14},
+      {945, 14}, {987, 14}, {1029, 14}, {1071, 14}, {1113, 14}, {1155, 14}, {1197, 14}, {1239, 14},
+      {1281, 14}, {1323, 14}, {1365, 14}, {1407, 14}, {1449, 14}, {1491, 14}, {1533, 14},
+  };
+
+  inline constexpr uint8_t COLUMNS_28[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+      0x00, 0x00, 0x00, 0x06, 0xE0, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x03,
+      0xFE, 0xFF, 0xFF, 0x07, 0x3F, 0x00, 0xFE, 0x0F, 0x1F, 0x80, 0xBF, 0x0F, 0x0F, 0xE0, 0x3F, 0x0F,
+      0x0F, 0xF0, 0x0F, 0x0F, 0x0F, 0xFC, 0x03, 0x0F, 0x0F, 0xFF, 0x00, 0x0F, 0xCF, 0x7F, 0x00, 0x0F,
+      0xDF, 0x1F, 0x80, 0x0F, 0xFF, 0x07, 0xC0, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x03,
+      0xF8, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F,
+      0xFE, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06,
+      0xF8, 0x00, 0x80, 0x0F, 0xFC, 0x00, 0xC0, 0x0F, 0x7E, 0x00, 0xE0, 0x0F, 0x3F, 0x00, 0xF0, 0x0F,
+      0x1F, 0x00, 0xF8, 0x0F, 0x0F, 0x00, 0xFE, 0x0F, 0x0F, 0x00, 0x3F, 0x0F, 0x0F, 0x80, 0x1F, 0x0F,
+      0x0F, 0xC0, 0x0F, 0x0F, 0x0F, 0xF0, 0x07, 0x0F, 0x1F, 0xF8, 0x01, 0x0F, 0x3F, 0xFC, 0x00, 0x0F,
+      0xFE, 0x7F, 0x00, 0x0F, 0xFC, 0x3F, 0x00, 0x0F, 0xF8, 0x1F, 0x00, 0x0F, 0xE0, 0x07, 0x00, 0x06,
+      0x60, 0x00, 0x60, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0xF0, 0x03, 0x7E, 0x00, 0xE0, 0x07,
+      0x3F, 0x00, 0xC0, 0x0F, 0x1F, 0x60, 0x80, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x1F, 0xF8, 0x81, 0x0F,
+      0x3F, 0xFC, 0xC3, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x03, 0xF8, 0x9F, 0xFF, 0x01,
+      0xE0, 0x07, 0x7E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x0F, 0x00,
+      0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x80, 0x3F, 0x0F, 0x00,
+      0xE0, 0x1F, 0x0F, 0x00, 0xF8, 0x07, 0x0F, 0x00, 0xFC, 0x03, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x0F, 0x00,
+      0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFE, 0x7F, 0x60, 0x00, 0xFF, 0xFF, 0xF0, 0x01,
+      0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x07, 0x0F, 0xF0, 0xC0, 0x0F, 0x0F, 0xF0, 0x80, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x81, 0x0F, 0x0F, 0xF0, 0xC3, 0x0F, 0x0F, 0xE0, 0xFF, 0x07,
+      0x0F, 0xC0, 0xFF, 0x03, 0x0F, 0x80, 0xFF, 0x01, 0x06, 0x00, 0x7E, 0x00, 0xE0, 0xFF, 0x7F, 0x00,
+      0xF8, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0x07, 0x3F, 0xF0, 0xC0, 0x0F,
+      0x1F, 0xF0, 0x80, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x81, 0x0F, 0x0F, 0xF0, 0xC3, 0x0F,
+      0x06, 0xE0, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x7E, 0x00,
+      0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFC, 0x03, 0x0F, 0x00, 0xFF, 0x0F,
+      0x0F, 0xC0, 0xFF, 0x0F, 0x0F, 0xF0, 0xFF, 0x0F, 0x0F, 0xFC, 0xFF, 0x03, 0x0F, 0xFF, 0x01, 0x00,
+      0xCF, 0x7F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00,
+      0x7E, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x7E, 0x00, 0xF8, 0x9F, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x03,
+      0xFE, 0xFF, 0xFF, 0x07, 0x3F, 0xFC, 0xC3, 0x0F, 0x1F, 0xF8, 0x81, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x1F, 0xF8, 0x81, 0x0F, 0x3F, 0xFC, 0xC3, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x03,
+      0xF8, 0x9F, 0xFF, 0x01, 0xE0, 0x07, 0x7E, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
+      0xFC, 0x3F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x06, 0x3F, 0xFC, 0x00, 0x0F, 0x1F, 0xF8, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x1F, 0xF0, 0x80, 0x0F, 0x3F, 0xF0, 0xC0, 0x0F, 0xFE, 0xFF, 0xFF, 0x07,
+      0xFC, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0xFF, 0x07,
+      0xF8, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0x3F, 0xF0, 0x00, 0x00,
+      0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+      0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+      0xFE, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0xFF, 0x07,
+      0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x1F, 0xF8, 0x81, 0x0F,
+      0x3F, 0xFC, 0xC3, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x03, 0xF8, 0x9F, 0xFF, 0x01,
+      0xE0, 0x07, 0x7E, 0x00, 0xE0, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x03,
+      0xFE, 0xFF, 0xFF, 0x07, 0x3F, 0x00, 0xC0, 0x0F, 0x1F, 0x00, 0x80, 0x0F, 0x0F, 0x00, 0x00, 0x0F,
+      0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F,
+      0x1F, 0x00, 0x80, 0x0F, 0x3F, 0x00, 0xC0, 0x0F, 0x7E, 0x00, 0xE0, 0x07, 0xFC, 0x00, 0xF0, 0x03,
+      0xF8, 0x00, 0xF0, 0x01, 0x60, 0x00, 0x60, 0x00, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F,
+      0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F,
+      0x0F, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x80, 0x0F, 0x3F, 0x00, 0xC0, 0x0F, 0xFE, 0xFF, 0xFF, 0x07,
+      0xFC, 0xFF, 0xFF, 0x03, 0xF8, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0x7F, 0x00, 0xFE, 0xFF, 0xFF, 0x07,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0x60, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x06,
+      0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x07,
+      0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+      0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+      0x0F, 0xF0, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0x06, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x03,
+      0xFE, 0xFF, 0xFF, 0x07, 0x3F, 0x00, 0xC0, 0x0F, 0x1F, 0x00, 0x80, 0x0F, 0x0F, 0x00, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x1F, 0xF0, 0x80, 0x0F, 0x3F, 0xF0, 0xC0, 0x0F, 0x7E, 0xF0, 0xFF, 0x07, 0xFC, 0xF0, 0xFF, 0x03,
+      0xF8, 0xF0, 0xFF, 0x01, 0x60, 0xE0, 0x7F, 0x00, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x07,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x0F, 0x00, 0x00, 0x0F,
+      0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F,
+      0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x07,
+      0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+      0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x0F,
+      0x00, 0x00, 0xC0, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x01,
+      0xFE, 0xFF, 0x7F, 0x00, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFE, 0xFF, 0xFF, 0x07, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xFE, 0x00, 0x00,
+      0x00, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0x07, 0x00, 0xC0, 0xEF, 0x1F, 0x00, 0xF0, 0xC7, 0x3F, 0x00,
+      0xF8, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0xFC, 0x03, 0x7E, 0x00, 0xF8, 0x07, 0x3F, 0x00, 0xE0, 0x0F,
+      0x1F, 0x00, 0x80, 0x0F, 0x06, 0x00, 0x00, 0x06, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+      0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+      0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+      0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0xFE, 0xFF, 0xFF, 0x07,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0xFC, 0x07, 0x00, 0x00,
+      0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
+      0x00, 0xFF, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00,
+      0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x07,
+      0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x07,
+      0xFC, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+      0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x80, 0xFF, 0x00,
+      0x00, 0x00, 0xFE, 0x03, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFE, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x03,
+      0xFE, 0xFF, 0xFF, 0x07, 0x3F, 0x00, 0xC0, 0x0F, 0x1F, 0x00, 0x80, 0x0F, 0x0F, 0x00, 0x00, 0x0F,
+      0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F,
+      0x1F, 0x00, 0x80, 0x0F, 0x3F, 0x00, 0xC0, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x03,
+      0xF8, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0x7F, 0x00, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+      0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+      0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
+      0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x00,
+      0xF8, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0x07, 0x3F, 0x00, 0xC0, 0x0F,
+      0x1F, 0x00, 0x80, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x18, 0x0F,
+      0x0F, 0x00, 0x3C, 0x0F, 0x0F, 0x00, 0xFC, 0x0F, 0x1F, 0x00, 0xF8, 0x0F, 0x3F, 0x00, 0xF0, 0x0F,
+      0xFE, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0x7F, 0x06,
+      0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x07,
+      0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+      0x0F, 0xF0, 0x03, 0x00, 0x0F, 0xF0, 0x0F, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x1F, 0xF8, 0xFF, 0x00,
+      0x3F, 0xFC, 0xFE, 0x03, 0xFE, 0x7F, 0xF8, 0x07, 0xFC, 0x3F, 0xE0, 0x0F, 0xF8, 0x1F, 0x80, 0x0F,
+      0xE0, 0x07, 0x00, 0x06, 0xE0, 0x07, 0x60, 0x00, 0xF8, 0x1F, 0xF0, 0x01, 0xFC, 0x3F, 0xF0, 0x03,
+      0xFE, 0x7F, 0xE0, 0x07, 0x3F, 0xFC, 0xC0, 0x0F, 0x1F, 0xF8, 0x80, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F,
+      0x1F, 0xF0, 0x81, 0x0F, 0x3F, 0xF0, 0xC3, 0x0F, 0x7E, 0xE0, 0xFF, 0x07, 0xFC, 0xC0, 0xFF, 0x03,
+      0xF8, 0x80, 0xFF, 0x01, 0x60, 0x00, 0x7E, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFF, 0xFF, 0xFF, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00,
+      0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xC0, 0x0F,
+      0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F,
+      0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x0F,
+      0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0x7F, 0x00,
+      0xFE, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0x07, 0x00, 0xFE, 0xFF, 0x1F, 0x00,
+      0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0x0F,
+      0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xFF, 0x01,
+      0x00, 0xC0, 0x7F, 0x00, 0xFE, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x07, 0x00, 0xFF, 0xFF, 0x01, 0x00,
+      0xFE, 0x7F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFE, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x80, 0xFF, 0x00, 0x00, 0xE0, 0x3F, 0x00,
+      0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xE0, 0x3F, 0x00,
+      0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xFE, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0x7E, 0x00, 0xE0, 0x07, 0xFF, 0x01, 0xF8, 0x0F,
+      0xFF, 0x03, 0xFC, 0x0F, 0xFE, 0x07, 0xFE, 0x07, 0xC0, 0x0F, 0x3F, 0x00, 0x80, 0x9F, 0x1F, 0x00,
+      0x00, 0xFF, 0x0F, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xFC, 0x03, 0x00,
+      0x00, 0xFF, 0x0F, 0x00, 0x80, 0x9F, 0x1F, 0x00, 0xC0, 0x0F, 0x3F, 0x00, 0xFE, 0x07, 0xFE, 0x07,
+      0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0x01, 0xF8, 0x0F, 0x7E, 0x00, 0xE0, 0x07, 0x7E, 0x00, 0x00, 0x00,
+      0xFF, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,
+      0x80, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x0F,
+      0x00, 0xFC, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x03, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,
+      0xFE, 0x07, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
+      0x06, 0x00, 0xE0, 0x07, 0x0F, 0x00, 0xF8, 0x0F, 0x0F, 0x00, 0xFC, 0x0F, 0x0F, 0x00, 0xFE, 0x0F,
+      0x0F, 0x00, 0x3F, 0x0F, 0x0F, 0x80, 0x1F, 0x0F, 0x0F, 0xE0, 0x0F, 0x0F, 0x0F, 0xF0, 0x03, 0x0F,
+      0x0F, 0xF8, 0x01, 0x0F, 0x0F, 0xFC, 0x00, 0x0F, 0x0F, 0x7F, 0x00, 0x0F, 0x8F, 0x1F, 0x00, 0x0F,
+      0xCF, 0x0F, 0x00, 0x0F, 0xFF, 0x07, 0x00, 0x0F, 0xFF, 0x03, 0x00, 0x0F, 0xFF, 0x01, 0x00, 0x0F,
+      0x7E, 0x00, 0x00, 0x06,
+  };
+  inline constexpr Glyph GLYPHS_28[] = {
+      {0, 8}, {32, 13}, {84, 4}, {100, 17}, {168, 17}, {236, 17}, {304, 17}, {372, 17},
+      {440, 17}, {508, 17}, {576, 17}, {644, 17}, {712, 17}, {780, 17}, {848, 17}, {916, 17},
+      {984, 17}, {1052, 17}, {1120, 17}, {1188, 17}, {1256, 17}, {1324, 17}, {1392, 17}, {1460, 17},
+      {1528, 17}, {1596, 17}, {1664, 17}, {1732, 17}, {1800, 17}, {1868, 17}, {1936, 17}, {2004, 17},
+      {2072, 17}, {2140, 17}, {2208, 17}, {2276, 17}, {2344, 17}, {2412, 17}, {2480, 17},
+  };
+
+  inline constexpr uint8_t COLUMNS_32[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00,
+      0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00,
+      0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+      0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x1F,
+      0xFC, 0xFF, 0xFF, 0x3F, 0x7F, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0xF8, 0xFD, 0x0F, 0x00, 0xFE, 0xF1,
+      0x0F, 0x80, 0xFF, 0xF0, 0x0F, 0xC0, 0x3F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFC, 0x03, 0xF0,
+      0x0F, 0xFF, 0x01, 0xF0, 0x8F, 0x7F, 0x00, 0xF0, 0xBF, 0x1F, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0xFE,
+      0xFC, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0xFF, 0x07,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xE0, 0x00, 0x00, 0xF0, 0xF0, 0x01, 0x00, 0xF0, 0xF8, 0x01, 0x00, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+      0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x60,
+      0xF0, 0x01, 0x00, 0xF8, 0xF8, 0x01, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFF,
+      0x3F, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0xF0, 0xF3, 0x0F, 0x00, 0xF8, 0xF1,
+      0x0F, 0x00, 0xFE, 0xF0, 0x0F, 0x00, 0x7F, 0xF0, 0x0F, 0x80, 0x1F, 0xF0, 0x0F, 0xC0, 0x0F, 0xF0,
+      0x3F, 0xF0, 0x07, 0xF0, 0x7F, 0xF8, 0x03, 0xF0, 0xFC, 0xFF, 0x00, 0xF0, 0xF8, 0x7F, 0x00, 0xF0,
+      0xF0, 0x3F, 0x00, 0xF0, 0xE0, 0x1F, 0x00, 0x60, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x01, 0x80, 0x0F,
+      0xF8, 0x01, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xFC,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0xF0, 0x0F, 0xFC,
+      0x7F, 0xF8, 0x1F, 0xFE, 0xFC, 0xFF, 0xFF, 0x3F, 0xF8, 0x7F, 0xFE, 0x1F, 0xF0, 0x3F, 0xFC, 0x0F,
+      0xE0, 0x1F, 0xF8, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7F, 0x00,
+      0x00, 0xC0, 0x7F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xFE, 0x79, 0x00,
+      0x00, 0x7F, 0x78, 0x00, 0xC0, 0x3F, 0x78, 0x00, 0xF0, 0x0F, 0x78, 0x00, 0xF8, 0x03, 0x78, 0x00,
+      0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x38, 0x00,
+      0xFE, 0xFF, 0x01, 0x07, 0xFF, 0xFF, 0x83, 0x0F, 0xFF, 0xFF, 0x83, 0x1F, 0xFF, 0xFF, 0x03, 0x3F,
+      0x0F, 0xC0, 0x03, 0xFE, 0x0F, 0xC0, 0x03, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xFC, 0x0F, 0xC0, 0x1F, 0xFE, 0x0F, 0x00, 0xFF, 0x3F,
+      0x0F, 0x00, 0xFE, 0x1F, 0x0F, 0x00, 0xFC, 0x0F, 0x06, 0x00, 0xF8, 0x07, 0xE0, 0xFF, 0xFF, 0x07,
+      0xF0, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x3F, 0x7F, 0xC0, 0x03, 0xFE,
+      0x3F, 0xC0, 0x03, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x0F, 0xFC, 0x0F, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0x1F,
+      0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xF8, 0x07, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xE0, 0x3F, 0x0F, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0xFF, 0xFF,
+      0x0F, 0x80, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0x3F, 0x0F, 0xF8, 0x07, 0x00, 0x0F, 0xFE, 0x01, 0x00,
+      0x8F, 0xFF, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00,
+      0xFE, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x07, 0xF0, 0x3F, 0xFC, 0x0F, 0xF8, 0x7F, 0xFE, 0x1F,
+      0xFC, 0xFF, 0xFF, 0x3F, 0x7F, 0xF8, 0x1F, 0xFE, 0x3F, 0xF0, 0x0F, 0xFC, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0xF0, 0x0F, 0xFC, 0x7F, 0xF8, 0x1F, 0xFE,
+      0xFC, 0xFF, 0xFF, 0x3F, 0xF8, 0x7F, 0xFE, 0x1F, 0xF0, 0x3F, 0xFC, 0x0F, 0xE0, 0x1F, 0xF8, 0x07,
+      0xE0, 0x1F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00,
+      0x7F, 0xF8, 0x03, 0xF0, 0x3F, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0xC0, 0x03, 0xFE, 0xFC, 0xFF, 0xFF, 0x3F,
+      0xF8, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x7F,
+      0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x7F, 0x7F, 0xC0, 0x03, 0x00,
+      0x3F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00,
+      0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00,
+      0x3F, 0xC0, 0x03, 0x00, 0x7F, 0xC0, 0x03, 0x00, 0xFC, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF,
+      0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x7F, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0xF0, 0x0F, 0xFC,
+      0x7F, 0xF8, 0x1F, 0xFE, 0xFC, 0xFF, 0xFF, 0x3F, 0xF8, 0x7F, 0xFE, 0x1F, 0xF0, 0x3F, 0xFC, 0x0F,
+      0xE0, 0x1F, 0xF8, 0x07, 0xE0, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x1F,
+      0xFC, 0xFF, 0xFF, 0x3F, 0x7F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFE,
+      0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0x80, 0x1F, 0xF0, 0x01, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x07,
+      0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFE, 0xFC, 0xFF, 0xFF, 0x3F,
+      0xF8, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0x7F,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x06, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00,
+      0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00,
+      0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00,
+      0x0F, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0x06, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x1F,
+      0xFC, 0xFF, 0xFF, 0x3F, 0x7F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0xC0, 0x03, 0xFE,
+      0xFC, 0xC0, 0xFF, 0x3F, 0xF8, 0xC1, 0xFF, 0x1F, 0xF0, 0xC1, 0xFF, 0x0F, 0xE0, 0x80, 0xFF, 0x07,
+      0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x7F,
+      0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00,
+      0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00,
+      0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xFE, 0xFF, 0xFF, 0x7F,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x80, 0x0F,
+      0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFC,
+      0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+      0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFC,
+      0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x0F,
+      0xFE, 0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0xF0, 0x03, 0x00,
+      0x00, 0xF8, 0x01, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x80, 0x9F, 0x7F, 0x00,
+      0xC0, 0x0F, 0xFF, 0x00, 0xF0, 0x07, 0xFC, 0x03, 0xF8, 0x03, 0xF0, 0x0F, 0xFC, 0x00, 0xC0, 0x3F,
+      0x7E, 0x00, 0x80, 0x7F, 0x3F, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0xF8, 0x06, 0x00, 0x00, 0x60,
+      0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+      0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+      0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+      0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0x7F,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x7F, 0xFC, 0x07, 0x00, 0x00,
+      0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0x03, 0x00,
+      0x00, 0xF0, 0x03, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xC0, 0x7F, 0x00, 0x00,
+      0xF0, 0x1F, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x7F, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x7F, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00,
+      0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+      0x00, 0xC0, 0x3F, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0x0F,
+      0x00, 0x00, 0xE0, 0x3F, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFE, 0xFF, 0xFF, 0x7F, 0xE0, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x1F,
+      0xFC, 0xFF, 0xFF, 0x3F, 0x7F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFE,
+      0xFC, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0xFF, 0x07,
+      0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+      0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00,
+      0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00,
+      0x0F, 0xC0, 0x03, 0x00, 0x3F, 0xF0, 0x03, 0x00, 0x7F, 0xF8, 0x03, 0x00, 0xFC, 0xFF, 0x00, 0x00,
+      0xF8, 0x7F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07,
+      0xF0, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x3F, 0x7F, 0x00, 0x00, 0xFE,
+      0x3F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0,
+      0x0F, 0x00, 0xC0, 0xF0, 0x0F, 0x00, 0xE0, 0xF1, 0x0F, 0x00, 0xE0, 0xF3, 0x0F, 0x00, 0xE0, 0xFF,
+      0x3F, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF,
+      0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x67, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00,
+      0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x03, 0x00, 0x0F, 0xC0, 0x0F, 0x00,
+      0x0F, 0xC0, 0x3F, 0x00, 0x0F, 0xC0, 0xFF, 0x00, 0x0F, 0xC0, 0xFF, 0x03, 0x3F, 0xF0, 0xFB, 0x0F,
+      0x7F, 0xF8, 0xE3, 0x3F, 0xFC, 0xFF, 0x80, 0x7F, 0xF8, 0x7F, 0x00, 0xFE, 0xF0, 0x3F, 0x00, 0xF8,
+      0xE0, 0x1F, 0x00, 0x60, 0xE0, 0x1F, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x0F, 0xF8, 0x7F, 0x80, 0x1F,
+      0xFC, 0xFF, 0x00, 0x3F, 0x7F, 0xF8, 0x03, 0xFE, 0x3F, 0xF0, 0x03, 0xFC, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0,
+      0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0xC0, 0x0F, 0xFC, 0x7F, 0xC0, 0x1F, 0xFE,
+      0xFC, 0x00, 0xFF, 0x3F, 0xF8, 0x01, 0xFE, 0x1F, 0xF0, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0xF8, 0x07,
+      0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+      0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+      0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x07,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFE,
+      0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+      0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0,
+      0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F,
+      0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0x07, 0xFE, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0x07, 0x00,
+      0xFF, 0xFF, 0x1F, 0x00, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0x07,
+      0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC,
+      0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFC, 0x07,
+      0x00, 0x00, 0xFF, 0x01, 0xFE, 0xFF, 0x7F, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x07, 0x00,
+      0xFE, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFE, 0x03,
+      0x00, 0x80, 0xFF, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x00,
+      0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xE0, 0x3F,
+      0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x7F,
+      0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFE, 0x0F, 0xF0, 0x7F,
+      0x80, 0x1F, 0xF8, 0x01, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00,
+      0x00, 0xF0, 0x0F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x3F, 0x00,
+      0x00, 0x7E, 0x7E, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x80, 0x1F, 0xF8, 0x01, 0xFE, 0x0F, 0xF0, 0x7F,
+      0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00,
+      0xFF, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
+      0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0xFF,
+      0x00, 0xE0, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0x7E, 0x00, 0x00,
+      0x00, 0x3F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00,
+      0xFF, 0x01, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7F, 0x0F, 0x00, 0x80, 0xFF,
+      0x0F, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xF8, 0xF1, 0x0F, 0x00, 0xFC, 0xF0,
+      0x0F, 0x00, 0x7E, 0xF0, 0x0F, 0x80, 0x3F, 0xF0, 0x0F, 0xC0, 0x0F, 0xF0, 0x0F, 0xE0, 0x07, 0xF0,
+      0x0F, 0xF0, 0x03, 0xF0, 0x0F, 0xFC, 0x01, 0xF0, 0x0F, 0x7E, 0x00, 0xF0, 0x0F, 0x3F, 0x00, 0xF0,
+      0x8F, 0x1F, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0xF0,
+      0xFE, 0x00, 0x00, 0x60,
+  };
+  inline constexpr Glyph GLYPHS_32[] = {
+      {0, 10}, {40, 14}, {96, 5}, {116, 19}, {192, 19}, {268, 19}, {344, 19}, {420, 19},
+      {496, 19}, {572, 19}, {648, 19}, {724, 19}, {800, 19}, {876, 19}, {952, 19}, {1028, 19},
+      {1104, 19}, {1180, 19}, {1256, 19}, {1332, 19}, {1408, 19}, {1484, 19}, {1560, 19}, {1636, 19},
+      {1712, 19}, {1788, 19}, {1864, 19}, {1940, 19}, {2016, 19}, {2092, 19}, {2168, 19}, {2244, 19},
+      {2320, 19}, {2396, 19}, {2472, 19}, {2548, 19}, {2624, 19}, {2700, 19}, {2776, 19},
+  };
+
+  inline constexpr uint8_t COLUMNS_40[] = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
+      0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
+      0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
+      0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3C,
+      0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF8,
+      0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+      0x00, 0x00, 0x00, 0x20, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF,
+      0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x01, 0x00,
+      0xF8, 0x7F, 0x7F, 0x00, 0x00, 0x7E, 0xFE, 0x3F, 0x00, 0x80, 0x7F, 0xFC, 0x1F, 0x00, 0xE0, 0x7F,
+      0xF8, 0x1F, 0x00, 0xF8, 0x3F, 0xF8, 0x1F, 0x00, 0xFC, 0x0F, 0xF8, 0x1F, 0x00, 0xFF, 0x03, 0xF8,
+      0x1F, 0xC0, 0xFF, 0x00, 0xF8, 0x1F, 0xF0, 0x3F, 0x00, 0xF8, 0x1F, 0xFC, 0x1F, 0x00, 0xF8, 0x1F,
+      0xFE, 0x07, 0x00, 0xF8, 0x3F, 0xFE, 0x01, 0x00, 0xFC, 0x7F, 0x7E, 0x00, 0x00, 0xFE, 0xFE, 0x1F,
+      0x00, 0x80, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF,
+      0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x70, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0xF0,
+      0x07, 0x00, 0x00, 0xF8, 0xF8, 0x03, 0x00, 0x00, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+      0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x70, 0xC0, 0x07, 0x00, 0x00, 0xF8, 0xF0, 0x07,
+      0x00, 0x00, 0xFC, 0xF8, 0x07, 0x00, 0x00, 0xFF, 0xFC, 0x03, 0x00, 0x80, 0xFF, 0xFE, 0x01, 0x00,
+      0xC0, 0xFF, 0x7F, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0xFC,
+      0xFB, 0x1F, 0x00, 0x00, 0xFE, 0xF9, 0x1F, 0x00, 0x00, 0xFF, 0xF8, 0x1F, 0x00, 0xC0, 0x3F, 0xF8,
+      0x1F, 0x00, 0xE0, 0x1F, 0xF8, 0x1F, 0x00, 0xF0, 0x0F, 0xF8, 0x1F, 0x00, 0xF8, 0x07, 0xF8, 0x1F,
+      0x00, 0xFC, 0x01, 0xF8, 0x3F, 0x00, 0xFF, 0x00, 0xF8, 0x7F, 0x80, 0x7F, 0x00, 0xF8, 0xFE, 0xC1,
+      0x3F, 0x00, 0xF8, 0xFC, 0xFF, 0x1F, 0x00, 0xF8, 0xF8, 0xFF, 0x07, 0x00, 0xF8, 0xF0, 0xFF, 0x03,
+      0x00, 0xF8, 0xC0, 0xFF, 0x01, 0x00, 0xF8, 0x80, 0xFF, 0x00, 0x00, 0x70, 0x80, 0x03, 0x00, 0xC0,
+      0x01, 0xC0, 0x07, 0x00, 0xE0, 0x03, 0xF0, 0x07, 0x00, 0xE0, 0x0F, 0xF8, 0x07, 0x00, 0xE0, 0x1F,
+      0xFC, 0x03, 0x00, 0xC0, 0x3F, 0xFE, 0x01, 0x00, 0x80, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x3F,
+      0x00, 0x18, 0x00, 0xFC, 0x1F, 0x00, 0x3C, 0x00, 0xF8, 0x1F, 0x00, 0x3C, 0x00, 0xF8, 0x1F, 0x00,
+      0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E,
+      0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x3F, 0x00, 0xFF, 0x00,
+      0xFC, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0xFE, 0xC1, 0xFF, 0x83, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F,
+      0xF8, 0xFF, 0xE7, 0xFF, 0x1F, 0xF0, 0xFF, 0xC3, 0xFF, 0x0F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0x80,
+      0xFF, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00,
+      0xE0, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0xFF,
+      0x0F, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0xBF, 0x0F, 0x00, 0x00, 0xF8, 0x9F, 0x0F,
+      0x00, 0x00, 0xFC, 0x87, 0x0F, 0x00, 0x00, 0xFF, 0x83, 0x0F, 0x00, 0xC0, 0xFF, 0x80, 0x0F, 0x00,
+      0xE0, 0x3F, 0x80, 0x0F, 0x00, 0xF8, 0x1F, 0x80, 0x0F, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+      0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x80,
+      0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xFE, 0xFF, 0x3F, 0xC0,
+      0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x0F, 0xFF, 0xFF, 0x7F, 0xE0, 0x1F,
+      0xFF, 0xFF, 0x7F, 0xC0, 0x3F, 0x1F, 0x00, 0x7E, 0x80, 0x7F, 0x1F, 0x00, 0x7E, 0x00, 0xFE, 0x1F,
+      0x00, 0x7E, 0x00, 0xFC, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00,
+      0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E,
+      0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0xFE, 0x00,
+      0xFC, 0x1F, 0x00, 0xFC, 0x01, 0xFE, 0x1F, 0x00, 0xFC, 0x83, 0x7F, 0x1F, 0x00, 0xF8, 0xFF, 0x3F,
+      0x1F, 0x00, 0xE0, 0xFF, 0x1F, 0x1F, 0x00, 0xC0, 0xFF, 0x0F, 0x1F, 0x00, 0x80, 0xFF, 0x03, 0x0E,
+      0x00, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF,
+      0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x01, 0x7E,
+      0x80, 0x7F, 0x7F, 0x00, 0x7E, 0x00, 0xFE, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x1F, 0x00, 0x7E, 0x00,
+      0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8,
+      0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F,
+      0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0xFE, 0x00, 0xFC, 0x1F, 0x00, 0xFC, 0x01, 0xFE, 0x0E, 0x00,
+      0xFC, 0x83, 0x7F, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0xC0,
+      0xFF, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x0E, 0x00, 0x00, 0x00,
+      0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F,
+      0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x3F, 0x1F, 0x00,
+      0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0xFC,
+      0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0x3F, 0x1F, 0xC0, 0xFF, 0x01, 0x00, 0x1F, 0xF0, 0x7F, 0x00,
+      0x00, 0x1F, 0xFC, 0x1F, 0x00, 0x00, 0x1F, 0xFE, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+      0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFE,
+      0x03, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0xFF, 0x01, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0xF0, 0xFF,
+      0xC3, 0xFF, 0x0F, 0xF8, 0xFF, 0xE7, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xC1, 0xFF,
+      0x83, 0x7F, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x3F, 0x00, 0xFF, 0x00, 0xFC, 0x1F, 0x00, 0x7E, 0x00,
+      0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8,
+      0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F,
+      0x00, 0x7E, 0x00, 0xF8, 0x3F, 0x00, 0xFF, 0x00, 0xFC, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0xFE, 0xC1,
+      0xFF, 0x83, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0xE7, 0xFF, 0x1F, 0xF0, 0xFF, 0xC3,
+      0xFF, 0x0F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0x80, 0xFF, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0x00, 0x00,
+      0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00,
+      0xFC, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0xC1, 0x3F, 0x00, 0x70, 0x7F, 0x80, 0x3F, 0x00, 0xF8, 0x3F,
+      0x00, 0x7F, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00,
+      0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E,
+      0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x3F, 0x00, 0x7E, 0x00,
+      0xFC, 0x7F, 0x00, 0x7E, 0x00, 0xFE, 0xFE, 0x01, 0x7E, 0x80, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F,
+      0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0x80,
+      0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0x01, 0x7E,
+      0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00,
+      0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00,
+      0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F,
+      0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0xFE, 0x01,
+      0x7E, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F,
+      0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00,
+      0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E,
+      0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x3F, 0x00, 0xFF, 0x00,
+      0xFC, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0xFE, 0xC1, 0xFF, 0x83, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F,
+      0xF8, 0xFF, 0xE7, 0xFF, 0x1F, 0xF0, 0xFF, 0xC3, 0xFF, 0x0F, 0xC0, 0xFF, 0x81, 0xFF, 0x03, 0x80,
+      0xFF, 0x00, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF,
+      0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x01, 0x00,
+      0x80, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00,
+      0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8,
+      0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F,
+      0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x01,
+      0x00, 0x80, 0x7F, 0xFC, 0x03, 0x00, 0xC0, 0x3F, 0xF8, 0x07, 0x00, 0xE0, 0x1F, 0xF0, 0x07, 0x00,
+      0xE0, 0x0F, 0xC0, 0x07, 0x00, 0xE0, 0x03, 0x80, 0x03, 0x00, 0xC0, 0x01, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F,
+      0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00,
+      0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
+      0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00,
+      0xFC, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x01, 0x00, 0x80, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F,
+      0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0x80,
+      0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x7E,
+      0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00,
+      0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8,
+      0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F,
+      0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x3C, 0x00, 0xF8, 0x1F, 0x00,
+      0x3C, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
+      0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x0E, 0x00, 0x00, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F,
+      0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00,
+      0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E,
+      0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00,
+      0x00, 0x1F, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0E,
+      0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF,
+      0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x01, 0x00,
+      0x80, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00,
+      0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3C, 0x00, 0xF8, 0x1F, 0x00, 0x3C, 0x00, 0xF8,
+      0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F,
+      0x00, 0x7E, 0x00, 0xF8, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x7F, 0x00, 0x7E, 0x00, 0xFE, 0xFE, 0x01,
+      0x7E, 0x80, 0x7F, 0xFC, 0x03, 0xFE, 0xFF, 0x3F, 0xF8, 0x07, 0xFE, 0xFF, 0x1F, 0xF0, 0x07, 0xFE,
+      0xFF, 0x0F, 0xC0, 0x07, 0xFC, 0xFF, 0x03, 0x80, 0x03, 0xFC, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
+      0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
+      0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E,
+      0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
+      0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+      0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+      0x00, 0x70, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
+      0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+      0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x0E, 0x00,
+      0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+      0x01, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x1F,
+      0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+      0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+      0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+      0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+      0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x80, 0x7F, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F,
+      0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE,
+      0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xFC,
+      0x03, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00,
+      0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
+      0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0xFF, 0xF8, 0x1F, 0x00, 0x80, 0x7F, 0xF0, 0x3F, 0x00, 0xC0,
+      0x3F, 0xC0, 0xFF, 0x00, 0xE0, 0x1F, 0x00, 0xFF, 0x03, 0xF8, 0x07, 0x00, 0xFC, 0x0F, 0xFC, 0x03,
+      0x00, 0xF8, 0x1F, 0xFE, 0x01, 0x00, 0xE0, 0x7F, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00,
+      0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+      0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+      0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+      0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+      0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8,
+      0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+      0x00, 0x00, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0x1F, 0x00,
+      0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00,
+      0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00,
+      0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00,
+      0xFF, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x1F,
+      0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0,
+      0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xF0,
+      0x3F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFC,
+      0x0F, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF,
+      0x03, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+      0xFF, 0xFF, 0xFF, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF,
+      0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x01, 0x00,
+      0x80, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00,
+      0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8,
+      0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F,
+      0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x01,
+      0x00, 0x80, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0xFF, 0xFF,
+      0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F,
+      0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00,
+      0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E,
+      0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00,
+      0x00, 0x7F, 0x80, 0x3F, 0x00, 0x00, 0xFE, 0xC1, 0x3F, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0x00,
+      0xF8, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x80,
+      0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF,
+      0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x01, 0x00,
+      0x80, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00,
+      0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF8,
+      0x1F, 0x00, 0x00, 0x38, 0xF8, 0x1F, 0x00, 0x00, 0xFC, 0xF8, 0x1F, 0x00, 0x00, 0xFC, 0xF9, 0x1F,
+      0x00, 0x00, 0xF8, 0xFB, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0x00, 0xE0, 0xFF, 0xFE, 0x01,
+      0x00, 0xC0, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFB, 0x80, 0xFF, 0xFF, 0xFF, 0x71, 0xFE, 0xFF, 0xFF, 0xFF,
+      0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F,
+      0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00,
+      0x7E, 0x00, 0x00, 0x1F, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0x00, 0xFE, 0x03, 0x00, 0x1F, 0x00, 0xFE,
+      0x0F, 0x00, 0x1F, 0x00, 0xFE, 0x3F, 0x00, 0x1F, 0x00, 0xFE, 0xFF, 0x00, 0x3F, 0x00, 0xFF, 0xFF,
+      0x03, 0x7F, 0x80, 0x3F, 0xFE, 0x07, 0xFE, 0xC1, 0x3F, 0xF8, 0x1F, 0xFC, 0xFF, 0x1F, 0xE0, 0x7F,
+      0xF8, 0xFF, 0x07, 0xC0, 0xFF, 0xF0, 0xFF, 0x03, 0x00, 0xFF, 0xC0, 0xFF, 0x01, 0x00, 0xFC, 0x80,
+      0xFF, 0x00, 0x00, 0x70, 0x80, 0xFF, 0x00, 0xC0, 0x01, 0xC0, 0xFF, 0x01, 0xE0, 0x03, 0xF0, 0xFF,
+      0x03, 0xE0, 0x0F, 0xF8, 0xFF, 0x07, 0xE0, 0x1F, 0xFC, 0xFF, 0x1F, 0xC0, 0x3F, 0xFE, 0xC1, 0x3F,
+      0x80, 0x7F, 0x7F, 0x80, 0x3F, 0x00, 0xFE, 0x3F, 0x00, 0x7F, 0x00, 0xFC, 0x1F, 0x00, 0x7E, 0x00,
+      0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8,
+      0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x1F,
+      0x00, 0x7E, 0x00, 0xF8, 0x3F, 0x00, 0xFE, 0x00, 0xFC, 0x7F, 0x00, 0xFC, 0x01, 0xFE, 0xFE, 0x01,
+      0xFC, 0x83, 0x7F, 0xFC, 0x03, 0xF8, 0xFF, 0x3F, 0xF8, 0x07, 0xE0, 0xFF, 0x1F, 0xF0, 0x07, 0xC0,
+      0xFF, 0x0F, 0xC0, 0x07, 0x80, 0xFF, 0x03, 0x80, 0x03, 0x00, 0xFF, 0x01, 0x0E, 0x00, 0x00, 0x00,
+      0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F,
+      0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+      0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0E,
+      0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+      0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+      0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
+      0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8,
+      0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+      0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+      0x00, 0x80, 0x7F, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+      0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xFF, 0x3F, 0x00,
+      0x00, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+      0xFE, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00,
+      0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,
+      0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00,
+      0xE0, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0xFF,
+      0x03, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0x00,
+      0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xFE,
+      0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+      0xF8, 0x1F, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0xFF,
+      0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00,
+      0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00,
+      0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
+      0x00, 0xF8, 0x1F, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0x03, 0x00, 0xC0,
+      0x7F, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0xFC, 0xFF,
+      0xFE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x81, 0x7F, 0x00, 0x00,
+      0xF8, 0xC3, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0xC0,
+      0xFF, 0x03, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF,
+      0x03, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xC3, 0x1F,
+      0x00, 0x00, 0xFE, 0x81, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFE, 0x7F, 0x00, 0xFE, 0x7F,
+      0xFF, 0x3F, 0x00, 0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0xFE,
+      0x03, 0x00, 0xC0, 0x7F, 0xFE, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x0F,
+      0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+      0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+      0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+      0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00,
+      0xF0, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0xFF,
+      0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00,
+      0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xC0,
+      0x7F, 0x1F, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0xFF,
+      0x1F, 0x00, 0x00, 0xFE, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xF8, 0x1F, 0x00, 0x80, 0x7F, 0xF8, 0x1F,
+      0x00, 0xC0, 0x1F, 0xF8, 0x1F, 0x00, 0xF0, 0x0F, 0xF8, 0x1F, 0x00, 0xF8, 0x07, 0xF8, 0x1F, 0x00,
+      0xFC, 0x03, 0xF8, 0x1F, 0x00, 0xFE, 0x01, 0xF8, 0x1F, 0x80, 0x7F, 0x00, 0xF8, 0x1F, 0xC0, 0x3F,
+      0x00, 0xF8, 0x1F, 0xE0, 0x1F, 0x00, 0xF8, 0x1F, 0xF0, 0x0F, 0x00, 0xF8, 0x1F, 0xF8, 0x03, 0x00,
+      0xF8, 0x1F, 0xFE, 0x01, 0x00, 0xF8, 0x1F, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0x00, 0xF8,
+      0xFF, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0xF8, 0xFE,
+      0x03, 0x00, 0x00, 0x70,
+  };
+  inline constexpr Glyph GLYPHS_40[] = {
+      {0, 12}, {60, 18}, {150, 6}, {180, 24}, {300, 24}, {420, 24}, {540, 24}, {660, 24},
+      {780, 24}, {900, 24}, {1020, 24}, {1140, 24}, {1260, 24}, {1380, 24}, {1500, 24}, {1620, 24},
+      {1740, 24}, {1860, 24}, {1980, 24}, {2100, 24}, {2220, 24}, {2340, 24}, {2460, 24}, {2580, 24},
+      {2700, 24}, {2820, 24}, {2940, 24}, {3060, 24}, {3180, 24}, {3300, 24}, {3420, 24}, {3540, 24},
+      {3660, 24}, {3780, 24}, {3900, 24}, {4020, 24}, {4140, 24}, {4260, 24}, {4380, 24},
+  };
+
+  // Ascending height
+  inline constexpr Size SIZES[] = {
+      {8, 1, GLYPHS_8, COLUMNS_8},
+      {10, 1, GLYPHS_10, COLUMNS_10},
+      {12, 2, GLYPHS_12, COLUMNS_12},
+      {14, 2, GLYPHS_14, COLUMNS_14},
+      {16, 2, GLYPHS_16, COLUMNS_16},
+      {20, 2, GLYPHS_20, COLUMNS_20},
+      {24, 3, GLYPHS_24, COLUMNS_24},
+      {28, 4, GLYPHS_28, COLUMNS_28},
+      {32, 4, GLYPHS_32, COLUMNS_32},
+      {40, 5, GLYPHS_40, COLUMNS_40},
+  };
+  constexpr uint8_t SIZE_COUNT = 10;
+}
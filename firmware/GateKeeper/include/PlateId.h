@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PACKED PLATE IDS
+// ═══════════════════════════════════════════════════════════════════════════
+// A plate normalized the way the server does it (letters and digits only,
+// upper case) packed into 64 bits. Each character is a base-37 digit
+// (0 = padding, 1-10 = '0'-'9', 11-36 = 'A'-'Z'). Up to 12 characters fit,
+// since 37^12 < 2^64. The first character is the most significant, so
+// numeric order of the IDs matches alphabetical order of the plates.
+//
+// 0 is never a valid ID and signals "not packable". Pure C++, shared by
+// the firmware and the host tools.
+
+namespace PlateId {
+  constexpr size_t MAX_CHARS = 12;
+  constexpr uint64_t INVALID = 0;
+
+  inline int digitOf(char ch) {
+    if (ch >= '0' && ch <= '9') {
+      return 1 + (ch - '0');
+    }
+    if (ch >= 'A' && ch <= 'Z') {
+      return 11 + (ch - 'A');
+    }
+    if (ch >= 'a' && ch <= 'z') {
+      return 11 + (ch - 'a');
+    }
+    return -1;  // Separator or punctuation: skipped, as the server does
+  }
+
+  inline uint64_t pack(const char* text, size_t length) {
+    uint64_t id = 0;
+    size_t packed = 0;
+    for (size_t i = 0; i < length && text[i] != '\0'; ++i) {
+      const int digit = digitOf(text[i]);
+      if (digit < 0) {
+        continue;
+      }
+      if (packed == MAX_CHARS) {
+        return INVALID;
+      }
+      id = id * 37 + static_cast<uint64_t>(digit);
+      ++packed;
+    }
+    if (packed == 0) {
+      return INVALID;
+    }
+    for (; packed < MAX_CHARS; ++packed) {
+      id *= 37;  // Pad on the right to keep the ordering
+    }
+    return id;
+  }
+
+  // Writes the plate text (NUL terminated) into out[MAX_CHARS + 1].
+  inline void unpack(uint64_t id, char* out) {
+    char digits[MAX_CHARS];
+    for (size_t i = MAX_CHARS; i-- > 0;) {
+      const int digit = static_cast<int>(id % 37);
+      id /= 37;
+      digits[i] = digit == 0 ? '\0' : digit <= 10 ? static_cast<char>('0' + digit - 1)
+                                                  : static_cast<char>('A' + digit - 11);
+    }
+    size_t length = 0;
+    while (length < MAX_CHARS && digits[length] != '\0') {
+      out[length] = digits[length];
+      ++length;
+    }
+    out[length] = '\0';
+  }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "PlateFont.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PLATE RENDERER
+// ═══════════════════════════════════════════════════════════════════════════
+// Draws a plate on one line in the largest PlateFont size that fits the
+// given box, so a long motorcycle plate shrinks instead of wrapping or
+// clipping. Glyphs are stored in the SSD1306 page layout, so drawing is a
+// copy of column bytes into the display buffer: one OR per column and page
+// when the top edge is page-aligned, two otherwise. There is no per-pixel
+// work as with the scaled GFX font.
+//
+// Pure C++ on a plain page buffer (width * height / 8 bytes, page-major,
+// as Adafruit_SSD1306::getBuffer()), so the host tools can use it too.
+
+namespace PlateRenderer {
+  // Index into PlateFont::CHARSET; lower case maps to upper, anything
+  // else to a blank.
+  inline uint8_t glyphIndex(char c) {
+    if (c >= 'a' && c <= 'z') {
+      c = static_cast<char>(c - 'a' + 'A');
+    }
+    for (uint8_t i = 0; i < PlateFont::GLYPH_COUNT; ++i) {
+      if (PlateFont::CHARSET[i] == c) {
+        return i;
+      }
+    }
+    return 0;
+  }
+
+  inline uint16_t textWidth(const char* text, const PlateFont::Size& size) {
+    uint16_t width = 0;
+    for (const char* c = text; *c != '\0'; ++c) {
+      width += size.glyphs[glyphIndex(*c)].width + (c == text ? 0 : size.gap);
+    }
+    return width;
+  }
+
+  // Largest size whose line fits; the smallest if none does
+  inline const PlateFont::Size& fit(const char* text, uint16_t maxWidth, uint16_t maxHeight) {
+    for (uint8_t i = PlateFont::SIZE_COUNT; i-- > 1;) {
+      const PlateFont::Size& size = PlateFont::SIZES[i];
+      if (size.height <= maxHeight && textWidth(text, size) <= maxWidth) {
+        return size;
+      }
+    }
+    return PlateFont::SIZES[0];
+  }
+
+  // ORs the text into the buffer with its top-left corner at (x, y),
+  // clipped to the buffer. Returns the x after the last glyph.
+  inline int16_t draw(uint8_t* buffer, uint16_t width, uint16_t height, int16_t x, int16_t y, const char* text,
+                      const PlateFont::Size& size) {
+    if (y < 0 || y >= height) {
+      return x;
+    }
+    const uint8_t glyphPages = (size.height + 7) / 8;
+    const uint8_t bufferPages = height / 8;
+    const uint8_t firstPage = y / 8;
+    const uint8_t shift = y % 8;
+
+    for (const char* c = text; *c != '\0'; ++c) {
+      x += c == text ? 0 : size.gap;
+      const PlateFont::Glyph& glyph = size.glyphs[glyphIndex(*c)];
+      const uint8_t* columns = size.columns + glyph.offset;
+      for (uint8_t column = 0; column < glyph.width; ++column, ++x, columns += glyphPages) {
+        if (x < 0 || x >= width) {
+          continue;
+        }
+        for (uint8_t page = 0; page < glyphPages && firstPage + page < bufferPages; ++page) {
+          uint8_t* target = buffer + (firstPage + page) * width + x;
+          target[0] |= static_cast<uint8_t>(columns[page] << shift);
+          if (shift != 0 && firstPage + page + 1 < bufferPages) {
+            target[width] |= static_cast<uint8_t>(columns[page] >> (8 - shift));
+          }
+        }
+      }
+    }
+    return x;
+  }
+}
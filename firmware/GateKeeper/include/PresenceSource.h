@@ -0,0 +1,158 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PRESENCE SOURCE INTERFACE
+// ═══════════════════════════════════════════════════════════════════════════
+// Hardware-free on purpose: the host simulator (tools/sim) replays recorded
+// traces through the same fusion code that runs on the gate.
+
+class PresenceSource {
+public:
+  virtual ~PresenceSource() = default;
+
+  virtual void initialize() {}
+
+  // Samples the sensor. Returns true when the debounced presence state changed.
+  virtual bool update(unsigned long nowMs) = 0;
+
+  virtual bool isPresent() const = 0;
+  virtual const char* name() const = 0;
+
+  // Time of the last debounced state change, used for timing alignment.
+  unsigned long lastChangeMs() const {
+    return lastChangeMs_;
+  }
+
+  // Voting weight (0-100) reflecting how much this sensor type is trusted.
+  uint8_t confidence() const {
+    return confidence_;
+  }
+
+protected:
+  explicit PresenceSource(uint8_t confidence) : confidence_(confidence) {}
+
+  void markChanged(unsigned long nowMs) {
+    lastChangeMs_ = nowMs;
+  }
+
+private:
+  uint8_t confidence_;
+  unsigned long lastChangeMs_ = 0;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PRESENCE FUSION (K-OF-N VOTING)
+// ═══════════════════════════════════════════════════════════════════════════
+// A vehicle is reported once at least `minVotes` sources agree and their
+// summed confidence reaches `minConfidence`. Only sources that asserted within
+// `alignWindowMs` of each other vote together, so a stuck or long-held sensor
+// cannot combine with an unrelated glitch minutes later. Release needs no
+// alignment: the vehicle is gone once fewer than `minVotes` sources remain.
+
+template <size_t MaxSources = 4>
+class PresenceFusion {
+public:
+  PresenceFusion(uint8_t minVotes, uint16_t minConfidence, unsigned long alignWindowMs)
+      : minVotes_(minVotes), minConfidence_(minConfidence), alignWindowMs_(alignWindowMs) {}
+
+  bool addSource(PresenceSource& source) {
+    if (count_ >= MaxSources) {
+      return false;
+    }
+    sources_[count_++] = &source;
+    return true;
+  }
+
+  void initialize() {
+    for (size_t i = 0; i < count_; ++i) {
+      sources_[i]->initialize();
+    }
+    // A vehicle already standing at boot is adopted without a recognition
+    present_ = alignedVoteReached();
+  }
+
+  // Returns true when the fused presence state changed.
+  bool update(unsigned long nowMs) {
+    for (size_t i = 0; i < count_; ++i) {
+      sources_[i]->update(nowMs);
+    }
+
+    const bool next = present_ ? stillPresent() : alignedVoteReached();
+    if (next == present_) {
+      return false;
+    }
+
+    present_ = next;
+    if (present_) {
+      ++assertions_;
+    }
+    return true;
+  }
+
+  bool isPresent() const {
+    return present_;
+  }
+
+  size_t sourceCount() const {
+    return count_;
+  }
+
+  const PresenceSource& source(size_t index) const {
+    return *sources_[index];
+  }
+
+  // Number of fused assertions, i.e. recognition requests caused.
+  unsigned long assertions() const {
+    return assertions_;
+  }
+
+private:
+  PresenceSource* sources_[MaxSources] = {};
+  size_t count_ = 0;
+  uint8_t minVotes_;
+  uint16_t minConfidence_;
+  unsigned long alignWindowMs_;
+  bool present_ = false;
+  unsigned long assertions_ = 0;
+
+  bool alignedVoteReached() const {
+    for (size_t anchor = 0; anchor < count_; ++anchor) {
+      if (!sources_[anchor]->isPresent()) {
+        continue;
+      }
+
+      uint8_t votes = 0;
+      uint16_t confidence = 0;
+      for (size_t i = 0; i < count_; ++i) {
+        if (sources_[i]->isPresent() && isAligned(*sources_[anchor], *sources_[i])) {
+          ++votes;
+          confidence += sources_[i]->confidence();
+        }
+      }
+
+      if (votes >= minVotes_ && confidence >= minConfidence_) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool stillPresent() const {
+    uint8_t votes = 0;
+    for (size_t i = 0; i < count_; ++i) {
+      if (sources_[i]->isPresent()) {
+        ++votes;
+      }
+    }
+    return votes >= minVotes_ && votes > 0;
+  }
+
+  bool isAligned(const PresenceSource& a, const PresenceSource& b) const {
+    const unsigned long ta = a.lastChangeMs();
+    const unsigned long tb = b.lastChangeMs();
+    return (ta > tb ? ta - tb : tb - ta) <= alignWindowMs_;
+  }
+};
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "Config.h"
+#include "DebouncedSensor.h"
+#include "FastGpio.h"
+#include "PresenceSource.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DIGITAL PRESENCE SOURCES
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Debounced GPIO input that reports presence at the given active level.
+template <int Pin>
+class DigitalPresenceSource : public PresenceSource {
+public:
+  DigitalPresenceSource(const char* name, int activeLevel, uint8_t confidence, int mode = INPUT)
+      : PresenceSource(confidence), name_(name), activeLevel_(activeLevel), mode_(mode) {}
+
+  void initialize() override {
+    sensor_.initialize(mode_, activeLevel_);
+    markChanged(millis());
+  }
+
+  bool update(unsigned long nowMs) override {
+    if (!sensor_.hasChanged()) {
+      return false;
+    }
+    markChanged(nowMs);
+    return true;
+  }
+
+  bool isPresent() const override {
+    return sensor_.getStableValue() == activeLevel_;
+  }
+
+  const char* name() const override {
+    return name_;
+  }
+
+  uint32_t rawEdgeCount() const {
+    return DebouncedSensor<Pin>::rawEdgeCount();
+  }
+
+private:
+  const char* name_;
+  int activeLevel_;
+  int mode_;
+  DebouncedSensor<Pin> sensor_;
+};
+
+// LM393 reflective IR module: DO pulls low while an object is in range.
+class Lm393Source : public DigitalPresenceSource<Config::LM393_SENSOR_PIN> {
+public:
+  Lm393Source() : DigitalPresenceSource("lm393", LOW, Config::LM393_CONFIDENCE) {}
+};
+
+// Inductive loop detector relay output (dry contact to GND while occupied).
+class LoopDetectorSource : public DigitalPresenceSource<Config::LOOP_DETECTOR_PIN> {
+public:
+  LoopDetectorSource()
+      : DigitalPresenceSource("loop", LOW, Config::LOOP_DETECTOR_CONFIDENCE, INPUT_PULLUP) {}
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CAMERA MOTION SOURCE
+// ═══════════════════════════════════════════════════════════════════════════
+// IP camera alarm output driven by its motion detection. Motion arrives as
+// short pulses, so presence is held for CAMERA_MOTION_HOLD_MS after the last one.
+
+class CameraMotionSource : public PresenceSource {
+public:
+  CameraMotionSource() : PresenceSource(Config::CAMERA_MOTION_CONFIDENCE) {}
+
+  void initialize() override {
+    pinMode(Config::CAMERA_MOTION_PIN, INPUT);
+    markChanged(millis());
+  }
+
+  bool update(unsigned long nowMs) override {
+    if (FastGpio<Config::CAMERA_MOTION_PIN>::read() == HIGH) {
+      lastMotionMs_ = nowMs;
+      if (!present_) {
+        return setPresent(true, nowMs);
+      }
+      return false;
+    }
+
+    if (present_ && (nowMs - lastMotionMs_) >= Config::CAMERA_MOTION_HOLD_MS) {
+      return setPresent(false, nowMs);
+    }
+    return false;
+  }
+
+  bool isPresent() const override {
+    return present_;
+  }
+
+  const char* name() const override {
+    return "camera";
+  }
+
+private:
+  bool present_ = false;
+  unsigned long lastMotionMs_ = 0;
+
+  bool setPresent(bool present, unsigned long nowMs) {
+    present_ = present;
+    markChanged(nowMs);
+    return true;
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ULTRASONIC SOURCE (HC-SR04 / JSN-SR04T)
+// ═══════════════════════════════════════════════════════════════════════════
+// Pings every ULTRASONIC_INTERVAL_MS and requires two consecutive readings on
+// the same side of the threshold, which rejects single spurious echoes. Rain
+// and sunlight that fool the LM393 do not affect it.
+
+class UltrasonicSource : public PresenceSource {
+public:
+  UltrasonicSource() : PresenceSource(Config::ULTRASONIC_CONFIDENCE) {}
+
+  void initialize() override {
+    pinMode(Config::ULTRASONIC_TRIG_PIN, OUTPUT);
+    pinMode(Config::ULTRASONIC_ECHO_PIN, INPUT);
+    digitalWrite(Config::ULTRASONIC_TRIG_PIN, LOW);
+    markChanged(millis());
+  }
+
+  bool update(unsigned long nowMs) override {
+    if ((nowMs - lastPingMs_) < Config::ULTRASONIC_INTERVAL_MS) {
+      return false;
+    }
+    lastPingMs_ = nowMs;
+
+    const bool inRange = measureInRange();
+    if (inRange == present_) {
+      agreeingReadings_ = 0;
+      return false;
+    }
+
+    if (++agreeingReadings_ < 2) {
+      return false;
+    }
+
+    agreeingReadings_ = 0;
+    present_ = inRange;
+    markChanged(nowMs);
+    return true;
+  }
+
+  bool isPresent() const override {
+    return present_;
+  }
+
+  const char* name() const override {
+    return "ultrasonic";
+  }
+
+private:
+  static constexpr unsigned long US_PER_CM_ROUND_TRIP = 58;
+
+  bool present_ = false;
+  uint8_t agreeingReadings_ = 0;
+  unsigned long lastPingMs_ = 0;
+
+  bool measureInRange() {
+    FastGpio<Config::ULTRASONIC_TRIG_PIN>::write(HIGH);
+    delayMicroseconds(10);
+    FastGpio<Config::ULTRASONIC_TRIG_PIN>::write(LOW);
+
+    const unsigned long echoUs =
+        pulseIn(Config::ULTRASONIC_ECHO_PIN, HIGH, Config::ULTRASONIC_ECHO_TIMEOUT_US);
+    if (echoUs == 0) {
+      return false;  // No echo within range
+    }
+    return (echoUs / US_PER_CM_ROUND_TRIP) <= Config::ULTRASONIC_PRESENCE_CM;
+  }
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdint.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PROTOTHREADS
+// ═══════════════════════════════════════════════════════════════════════════
+// Stackless coroutines in the style of Dunkels' protothreads, for flows
+// that wait on the network or the clock but must not block the loop. The
+// body of a flow is one member function, written top to bottom:
+//
+//   PtState flow() {
+//     PT_BEGIN(pt_);
+//     display_.showCarChecking();
+//     decisions_.startDecision(millis());
+//     PT_AWAIT(pt_, decided());
+//     ...
+//     PT_END(pt_);
+//   }
+//
+// loop() calls it every pass until it returns Done. At each PT_AWAIT whose
+// condition is false it returns Waiting. The next call jumps straight back
+// to that line through a switch on the saved __LINE__. A protothread is
+// therefore 2 bytes with no stack of its own, and resuming one costs a
+// call and an indirect jump. tools/bench/protothread_bench measures both.
+//
+// The price of having no stack:
+//   - Locals do not survive a wait. Keep anything needed after PT_AWAIT or
+//     PT_YIELD in members.
+//   - The body must not use switch itself (an if chain is fine), and must
+//     not put two waits on one source line.
+//   - Only the protothread's own function may wait. A nested flow is a
+//     second Protothread awaited with PT_AWAIT_CHILD.
+//
+// C++20 coroutines would lift the first two rules, but the arduino-esp32
+// 2.x toolchain is GCC 8 without -fcoroutines, and each coroutine frame
+// would come from the heap unless every promise type supplied an
+// allocator.
+
+enum class PtState : uint8_t { Waiting, Done };
+
+struct Protothread {
+  uint16_t line = 0;  // 0: not started or finished
+
+  bool running() const {
+    return line != 0;
+  }
+
+  // Abandons the flow; the next call starts from PT_BEGIN
+  void reset() {
+    line = 0;
+  }
+};
+
+#define PT_BEGIN(pt)   \
+  switch ((pt).line) { \
+    case 0:
+
+// Returns Waiting until cond holds. cond is re-evaluated on every call.
+#define PT_AWAIT(pt, cond)       \
+  do {                           \
+    (pt).line = __LINE__;        \
+    [[fallthrough]];             \
+    case __LINE__:               \
+      if (!(cond)) {             \
+        return PtState::Waiting; \
+      }                          \
+  } while (0)
+
+// Gives the loop one pass, then continues
+#define PT_YIELD(pt)         \
+  do {                       \
+    (pt).line = __LINE__;    \
+    return PtState::Waiting; \
+    case __LINE__:;          \
+  } while (0)
+
+// child is a call returning PtState, made on every resume until Done
+#define PT_AWAIT_CHILD(pt, child) PT_AWAIT(pt, (child) == PtState::Done)
+
+// Ends the flow early; the next call starts from PT_BEGIN
+#define PT_EXIT(pt)       \
+  do {                    \
+    (pt).line = 0;        \
+    return PtState::Done; \
+  } while (0)
+
+#define PT_END(pt)     \
+  }                    \
+  (pt).line = 0;       \
+  return PtState::Done
@@ -0,0 +1,326 @@
+#pragma once
+
+// ═══════════════════════════════════════════════════════════════════════════
+// QEMU EMULATION HARNESS (qemu BUILD ONLY)
+// ═══════════════════════════════════════════════════════════════════════════
+// Lets the shipping image run on Espressif's QEMU fork
+// (qemu-system-xtensa -machine esp32), driven from the host by
+// tools/qemu/gatekeeper_qemu.py. QEMU models neither the radio, GPIO input
+// nor LEDC. The gate's three contacts with the world are therefore
+// rerouted at the narrowest point:
+//
+//   Network  ServerTransport is UartTunnelClient. Each TCP connection the
+//            HTTP clients open is carried over UART1 to the host script,
+//            which opens the real socket to the server. The API started
+//            with LPR_STUB_PLATE stands in for recognition.
+//   Sensors  FastGpio<Pin>::read() returns the level last set by the
+//            `pin <gpio> <0|1>` console command, so the debouncers and
+//            fusion sample injected edges.
+//   Outputs  Every servo or relay move prints a "[QEMU] out" line with
+//            the pulse width or level and esp_timer time. The host script
+//            pairs it with the "[QEMU] pin" line of its stimulus.
+//
+// Everything between those points is the real code: presence fusion, the
+// recognition flow, LeanHttpClient, metrics and the sampling profiler.
+//
+// Tunnel frames, both directions: 0xA5 | type | channel | length | payload
+//   device to host  Open (ipv4[4], port u16 LE), Data, Close
+//   host to device  Opened (ok u8), Data, Closed
+// The host sends nothing for a channel once it has seen its Close.
+
+#ifdef GATEKEEPER_QEMU
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#include "Config.h"
+#include "NonBlockingClient.h"
+#include "SerialConsole.h"
+#include "Watchdog.h"
+
+static_assert(Config::DECISION_TRANSPORT == Config::DecisionTransportKind::Webhook &&
+                  !Config::UDP_DECISION_ENABLED && !Config::WEBHOOK_USE_TLS,
+              "The QEMU build only tunnels the plain HTTP webhook");
+
+// Input levels read in place of GPIO_IN. Pins start at the level their
+// sensor reports with no vehicle.
+class GpioStimulus {
+public:
+  static int read(int pin) {
+    return ((levels_ >> pin) & 1) != 0 ? HIGH : LOW;
+  }
+
+  static void set(int pin, int level) {
+    if (level == HIGH) {
+      levels_ |= 1ULL << pin;
+    } else {
+      levels_ &= ~(1ULL << pin);
+    }
+  }
+
+private:
+  static inline uint64_t levels_ = (1ULL << Config::LM393_SENSOR_PIN) | (1ULL << Config::LOOP_DETECTOR_PIN);
+};
+
+class UartTunnel {
+public:
+  static constexpr int CHANNELS = 4;
+
+  static void begin() {
+    // Must be set before begin(); covers a burst of server bytes between polls
+    Serial1.setRxBufferSize(RX_BUFFER);
+    Serial1.begin(Config::QEMU_TUNNEL_BAUD, SERIAL_8N1, Config::QEMU_TUNNEL_RX_PIN, Config::QEMU_TUNNEL_TX_PIN);
+  }
+
+  // Blocks like WiFiClient::connect() until the host has its socket.
+  // Returns the channel, or -1.
+  static int open(IPAddress address, uint16_t port) {
+    int channel = 0;
+    while (channel < CHANNELS && channels_[channel].state != State::Free) {
+      ++channel;
+    }
+    if (channel == CHANNELS) {
+      return -1;
+    }
+
+    Channel& slot = channels_[channel];
+    slot.state = State::Opening;
+    slot.head = 0;
+    slot.count = 0;
+    const uint8_t target[6] = {address[0], address[1], address[2], address[3], static_cast<uint8_t>(port & 0xFF),
+                               static_cast<uint8_t>(port >> 8)};
+    send(FrameType::Open, channel, target, sizeof(target));
+
+    const unsigned long startedMs = millis();
+    while (slot.state == State::Opening && (millis() - startedMs) < Config::QEMU_TUNNEL_CONNECT_TIMEOUT_MS) {
+      pump();
+      Watchdog::feed();
+      delay(1);
+    }
+    if (slot.state != State::Connected) {
+      close(channel);
+      return -1;
+    }
+    return channel;
+  }
+
+  static size_t write(int channel, const uint8_t* data, size_t length) {
+    if (channels_[channel].state != State::Connected) {
+      return 0;
+    }
+    for (size_t sent = 0; sent < length;) {
+      const size_t chunk = length - sent < MAX_PAYLOAD ? length - sent : MAX_PAYLOAD;
+      send(FrameType::Data, channel, data + sent, chunk);
+      sent += chunk;
+    }
+    return length;
+  }
+
+  static int available(int channel) {
+    pump();
+    return channels_[channel].count;
+  }
+
+  static int read(int channel, uint8_t* buffer, size_t length) {
+    pump();
+    Channel& slot = channels_[channel];
+    size_t copied = 0;
+    while (copied < length && slot.count > 0) {
+      buffer[copied++] = slot.ring[slot.head];
+      slot.head = (slot.head + 1) % RING_SIZE;
+      --slot.count;
+    }
+    return copied > 0 ? static_cast<int>(copied) : -1;
+  }
+
+  // Unread bytes keep a closed connection readable, as with WiFiClient
+  static bool connected(int channel) {
+    pump();
+    const Channel& slot = channels_[channel];
+    return slot.state == State::Connected || slot.count > 0;
+  }
+
+  static void close(int channel) {
+    if (channels_[channel].state == State::Connected || channels_[channel].state == State::Opening) {
+      send(FrameType::Close, channel, nullptr, 0);
+    }
+    channels_[channel].state = State::Free;
+  }
+
+private:
+  enum class FrameType : uint8_t { Open = 1, Data = 2, Close = 3, Opened = 4, Closed = 5 };
+  enum class State : uint8_t { Free, Opening, Connected, Closed };
+
+  static constexpr uint8_t SYNC = 0xA5;
+  static constexpr size_t HEADER_SIZE = 4;
+  static constexpr size_t MAX_PAYLOAD = 255;
+  static constexpr size_t RING_SIZE = 1024;
+  static constexpr size_t RX_BUFFER = 4096;
+
+  struct Channel {
+    State state;
+    uint8_t ring[RING_SIZE];
+    size_t head;
+    size_t count;
+  };
+
+  static inline Channel channels_[CHANNELS] = {};  // All Free and empty
+  // Frame being assembled from UART1; staged_ once complete but not yet
+  // delivered, e.g. while its channel's ring is full
+  static inline uint8_t header_[HEADER_SIZE];
+  static inline size_t headerLength_ = 0;
+  static inline uint8_t payload_[MAX_PAYLOAD];
+  static inline size_t payloadLength_ = 0;
+  static inline bool staged_ = false;
+
+  static void send(FrameType type, int channel, const uint8_t* data, size_t length) {
+    const uint8_t header[HEADER_SIZE] = {SYNC, static_cast<uint8_t>(type), static_cast<uint8_t>(channel),
+                                         static_cast<uint8_t>(length)};
+    Serial1.write(header, sizeof(header));
+    if (length > 0) {
+      Serial1.write(data, length);
+    }
+  }
+
+  // Never blocks. A full ring leaves the rest in the UART buffer.
+  static void pump() {
+    while ((!staged_ || deliver()) && readFrame()) {
+    }
+  }
+
+  static bool readFrame() {
+    while (Serial1.available() > 0) {
+      const uint8_t byte = static_cast<uint8_t>(Serial1.read());
+      if (headerLength_ < HEADER_SIZE) {
+        if (headerLength_ == 0 && byte != SYNC) {
+          continue;  // Resynchronize
+        }
+        header_[headerLength_++] = byte;
+        payloadLength_ = 0;
+      } else {
+        payload_[payloadLength_++] = byte;
+      }
+      if (headerLength_ == HEADER_SIZE && payloadLength_ == header_[3]) {
+        headerLength_ = 0;
+        staged_ = true;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // False while the staged frame's channel has no room for it
+  static bool deliver() {
+    const FrameType type = static_cast<FrameType>(header_[1]);
+    const uint8_t channel = header_[2];
+    if (channel < CHANNELS) {
+      Channel& slot = channels_[channel];
+      if (type == FrameType::Opened && slot.state == State::Opening) {
+        slot.state = payloadLength_ == 1 && payload_[0] != 0 ? State::Connected : State::Closed;
+      } else if (type == FrameType::Data && slot.state == State::Connected) {
+        if (RING_SIZE - slot.count < payloadLength_) {
+          return false;
+        }
+        for (size_t i = 0; i < payloadLength_; ++i) {
+          slot.ring[(slot.head + slot.count) % RING_SIZE] = payload_[i];
+          ++slot.count;
+        }
+      } else if (type == FrameType::Closed && slot.state == State::Connected) {
+        slot.state = State::Closed;
+      }
+      // Anything else belongs to a connection this side already closed
+    }
+    staged_ = false;
+    return true;
+  }
+};
+
+// The subset of NonBlockingClient that LeanHttpClient uses. The host is an
+// address literal, and the channel opens inside startConnect(), which waits
+// for the host as WiFiClient::connect() would; fine for the emulator.
+class UartTunnelClient {
+public:
+  using ConnectStatus = NonBlockingClient::ConnectStatus;
+
+  ~UartTunnelClient() {
+    stop();
+  }
+
+  bool startConnect(const char* host, uint16_t port) {
+    stop();
+    IPAddress address;
+    if (!address.fromString(host)) {
+      return false;
+    }
+    channel_ = UartTunnel::open(address, port);
+    return channel_ >= 0;
+  }
+
+  ConnectStatus pollConnect() {
+    return channel_ >= 0 ? ConnectStatus::Connected : ConnectStatus::Failed;
+  }
+
+  uint8_t connected() {
+    return channel_ >= 0 && UartTunnel::connected(channel_) ? 1 : 0;
+  }
+
+  size_t write(const uint8_t* data, size_t length) {
+    return channel_ >= 0 ? UartTunnel::write(channel_, data, length) : 0;
+  }
+
+  int available() {
+    return channel_ >= 0 ? UartTunnel::available(channel_) : 0;
+  }
+
+  int read() {
+    uint8_t byte = 0;
+    return read(&byte, 1) == 1 ? byte : -1;
+  }
+
+  int read(uint8_t* buffer, size_t length) {
+    return channel_ >= 0 ? UartTunnel::read(channel_, buffer, length) : -1;
+  }
+
+  void stop() {
+    if (channel_ >= 0) {
+      UartTunnel::close(channel_);
+      channel_ = -1;
+    }
+  }
+
+  void setNoDelay(bool) {}
+
+private:
+  int channel_ = -1;
+};
+
+class QemuHarness {
+public:
+  static void begin() {
+    UartTunnel::begin();
+    SerialConsole::addCommand("pin", "<gpio> <0|1> drive a sensor input", onPinCommand, nullptr);
+    Serial.println("[QEMU] Harness ready");
+  }
+
+  // Stands in for the LEDC or GPIO output QEMU does not model. value is
+  // the pulse width in us for "pwm", the level for "gpio".
+  static void captureOutput(const char* kind, int pin, uint32_t value) {
+    Serial.printf("[QEMU] out %s pin=%d value=%u t_us=%llu\n", kind, pin, static_cast<unsigned>(value),
+                  static_cast<unsigned long long>(esp_timer_get_time()));
+  }
+
+private:
+  static void onPinCommand(void*, const char* args, Print& out) {
+    char* end = nullptr;
+    const long pin = strtol(args, &end, 10);
+    if (end == args || *end != ' ' || pin < 0 || pin >= 40) {
+      out.println("[QEMU] Usage: pin <gpio> <0|1>");
+      return;
+    }
+    const int level = atoi(end + 1) != 0 ? HIGH : LOW;
+    GpioStimulus::set(static_cast<int>(pin), level);
+    out.printf("[QEMU] pin %ld=%d t_us=%llu\n", pin, level, static_cast<unsigned long long>(esp_timer_get_time()));
+  }
+};
+
+#endif
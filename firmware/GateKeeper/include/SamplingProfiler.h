@@ -0,0 +1,178 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "Config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SAMPLING PROFILER
+// ═══════════════════════════════════════════════════════════════════════════
+// A hardware timer per core interrupts at the configured rate and records
+// the interrupted PC and the task running on that core into a preallocated
+// buffer; sampling stops when it is full. `prof dump` prints the samples and a
+// task-name table, which tools/profile_symbolize.py turns into folded stacks
+// for flamegraph.pl / speedscope.
+//
+// On ESP32 FreeRTOS the level-1 interrupt entry saves the interrupted
+// context as an exception frame on the task stack and stores that stack
+// pointer in pxCurrentTCB[core]->pxTopOfStack, so the PC is read from the
+// frame (XT_STK_PC). EPC1 is not used because window overflows taken inside
+// the ISR overwrite it.
+
+extern "C" void* volatile pxCurrentTCB[portNUM_PROCESSORS];
+
+class SamplingProfiler {
+public:
+  static bool start(uint32_t hz) {
+    if (running_ || hz == 0 || hz > Config::PROFILER_MAX_HZ) {
+      return false;
+    }
+
+    hz_ = hz;
+    next_.store(0, std::memory_order_relaxed);
+    dropped_ = 0;
+    for (BaseType_t core = 0; core < portNUM_PROCESSORS; ++core) {
+      runOnCore(core, attachTimer);
+    }
+    running_ = true;
+    return true;
+  }
+
+  static void stop() {
+    if (!running_) {
+      return;
+    }
+    for (BaseType_t core = 0; core < portNUM_PROCESSORS; ++core) {
+      runOnCore(core, detachTimer);
+    }
+    running_ = false;
+  }
+
+  static bool running() {
+    return running_;
+  }
+
+  static void dump(Print& out) {
+    stop();
+
+    const uint32_t count = recordedCount();
+    out.printf("# gatekeeper-profile v1 hz=%u samples=%u dropped=%u\n", static_cast<unsigned>(hz_),
+               static_cast<unsigned>(count), static_cast<unsigned>(dropped_));
+    dumpTaskNames(out, count);
+    for (uint32_t i = 0; i < count; ++i) {
+      out.printf("S %u %08x %08x\n", static_cast<unsigned>(samples_[i].task & 1),
+                 static_cast<unsigned>(samples_[i].pc), static_cast<unsigned>(samples_[i].task & ~1U));
+    }
+    out.println("# end");
+  }
+
+private:
+  // Interrupted PC plus TCB address with the core number in bit 0 (TCBs are
+  // word aligned), 8 bytes per sample.
+  struct Sample {
+    uint32_t pc;
+    uint32_t task;
+  };
+
+  static constexpr uint32_t FRAME_PC_WORD = 1;  // XT_STK_PC / 4
+  static constexpr uint32_t TIMER_DIVIDER = 80;  // 1 MHz timer ticks
+
+  static inline Sample samples_[Config::PROFILER_MAX_SAMPLES];
+  static inline std::atomic<uint32_t> next_{0};
+  static inline volatile uint32_t dropped_ = 0;
+  static inline hw_timer_t* timers_[portNUM_PROCESSORS] = {};
+  static inline uint32_t hz_ = 0;
+  static inline bool running_ = false;
+
+  static uint32_t recordedCount() {
+    const uint32_t next = next_.load(std::memory_order_acquire);
+    return next < Config::PROFILER_MAX_SAMPLES ? next : Config::PROFILER_MAX_SAMPLES;
+  }
+
+  static void IRAM_ATTR onTimer() {
+    const uint32_t index = next_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= Config::PROFILER_MAX_SAMPLES) {
+      dropped_ = dropped_ + 1;
+      return;
+    }
+
+    const BaseType_t core = xPortGetCoreID();
+    void* tcb = pxCurrentTCB[core];
+    uint32_t pc = 0;
+    if (tcb != nullptr) {
+      const uint32_t* frame = *static_cast<uint32_t* const*>(tcb);
+      pc = frame[FRAME_PC_WORD];
+    }
+    samples_[index] = {pc, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(tcb)) | static_cast<uint32_t>(core)};
+  }
+
+  static void attachTimer() {
+    const BaseType_t core = xPortGetCoreID();
+    hw_timer_t* timer = timerBegin(Config::PROFILER_TIMER_BASE + core, TIMER_DIVIDER, true);
+    timerAttachInterrupt(timer, &onTimer, true);
+    timerAlarmWrite(timer, 1000000UL / hz_, true);
+    timerAlarmEnable(timer);
+    timers_[core] = timer;
+  }
+
+  // Interrupts must be freed on the core that allocated them.
+  static void detachTimer() {
+    const BaseType_t core = xPortGetCoreID();
+    if (timers_[core] != nullptr) {
+      timerEnd(timers_[core]);
+      timers_[core] = nullptr;
+    }
+  }
+
+  struct CoreJob {
+    void (*function)();
+    TaskHandle_t caller;
+  };
+
+  static void runOnCore(BaseType_t core, void (*function)()) {
+    CoreJob job = {function, xTaskGetCurrentTaskHandle()};
+    xTaskCreatePinnedToCore(coreJobTask, "prof", 2048, &job, configMAX_PRIORITIES - 1, nullptr, core);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+
+  static void coreJobTask(void* arg) {
+    CoreJob* job = static_cast<CoreJob*>(arg);
+    job->function();
+    xTaskNotifyGive(job->caller);
+    vTaskDelete(nullptr);
+  }
+
+  static void dumpTaskNames(Print& out, uint32_t count) {
+    uint32_t seen[24];
+    size_t seenCount = 0;
+    for (uint32_t i = 0; i < count && seenCount < 24; ++i) {
+      const uint32_t handle = samples_[i].task & ~1U;
+      bool known = handle == 0;
+      for (size_t j = 0; j < seenCount && !known; ++j) {
+        known = seen[j] == handle;
+      }
+      if (!known) {
+        seen[seenCount++] = handle;
+        // Handles of tasks deleted since sampling are printed as "?"
+        out.printf("T %08x %s\n", static_cast<unsigned>(handle), taskName(handle));
+      }
+    }
+  }
+
+  static const char* taskName(uint32_t handle) {
+#if configUSE_TRACE_FACILITY
+    static TaskStatus_t tasks[24];
+    const UBaseType_t total = uxTaskGetSystemState(tasks, 24, nullptr);
+    for (UBaseType_t i = 0; i < total; ++i) {
+      if (static_cast<uint32_t>(reinterpret_cast<uintptr_t>(tasks[i].xHandle)) == handle) {
+        return tasks[i].pcTaskName;
+      }
+    }
+#endif
+    (void)handle;
+    return "?";
+  }
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "AllowlistImage.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ACCESS SCHEDULE FORMAT
+// ═══════════════════════════════════════════════════════════════════════════
+// Time-based access is split in two so that neither part is rebuilt for a
+// change to the other:
+//
+// - Each allowlist entry carries a profile number (AllowlistImage.h), fixed
+//   when the image is built. Profile 0 is unrestricted.
+// - The schedule, synced from the server (src/api/schedule.py), holds one
+//   weekly bitmap per profile and a list of dated overrides.
+//
+// A bitmap has one bit per 15-minute slot of the week, Sunday first:
+// bit (weekday * 96 + slot), 84 bytes per profile. An override applies to
+// the profiles in its mask on one date and either substitutes another
+// weekday's windows (a holiday run as a Sunday) or closes or opens the
+// whole day. Changing hours, holidays or exceptions therefore touches a
+// few hundred bytes, never the per-entry table.
+//
+// Layout, all little-endian:
+//   ScheduleHeader
+//   uint8_t bitmap[profileCount][BITMAP_BYTES]   profiles 1..profileCount
+//   Override override[overrideCount]              sorted by day
+// The generation is the CRC-32 of everything after the header.
+//
+// Pure C++, shared by the firmware and the host tools.
+
+namespace ScheduleImage {
+  constexpr uint32_t MAGIC = 0x43534B47;  // "GKSC"
+  constexpr uint16_t SLOT_MINUTES = 15;
+  constexpr uint32_t SLOTS_PER_DAY = 24 * 60 / SLOT_MINUTES;
+  constexpr uint32_t BITMAP_BYTES = 7 * SLOTS_PER_DAY / 8;
+  constexpr uint32_t MAX_PROFILES = 16;  // Width of Override::profileMask
+  constexpr uint32_t MAX_OVERRIDES = 64;
+
+  // Override::action values beyond a weekday (0 = Sunday .. 6 = Saturday)
+  constexpr uint8_t CLOSED = 7;
+  constexpr uint8_t OPEN = 8;
+
+  struct Header {
+    uint32_t magic;
+    uint32_t generation;
+    uint16_t profileCount;
+    uint16_t overrideCount;
+    uint16_t slotMinutes;
+    uint16_t reserved;
+  };
+
+  struct Override {
+    uint16_t day;          // Days since 1970-01-01, local date
+    uint8_t action;        // Weekday whose windows apply, CLOSED or OPEN
+    uint8_t reserved;
+    uint16_t profileMask;  // Bit p-1 for profile p
+    uint16_t reserved2;
+  };
+
+  static_assert(sizeof(Header) == 16, "Header layout is shared with src/api/schedule.py");
+  static_assert(sizeof(Override) == 8, "Override layout is shared with src/api/schedule.py");
+  static_assert(BITMAP_BYTES == 84, "One week of 15-minute slots");
+
+  constexpr size_t MAX_BYTES = sizeof(Header) + MAX_PROFILES * BITMAP_BYTES + MAX_OVERRIDES * sizeof(Override);
+
+  inline size_t bytesFor(const Header& header) {
+    return sizeof(Header) + header.profileCount * BITMAP_BYTES + header.overrideCount * sizeof(Override);
+  }
+
+  inline bool valid(const uint8_t* data, size_t length) {
+    if (length < sizeof(Header)) {
+      return false;
+    }
+    Header header;
+    memcpy(&header, data, sizeof(header));
+    return header.magic == MAGIC && header.slotMinutes == SLOT_MINUTES && header.profileCount <= MAX_PROFILES &&
+           header.overrideCount <= MAX_OVERRIDES && bytesFor(header) == length &&
+           AllowlistImage::crc32(data + sizeof(header), length - sizeof(header)) == header.generation;
+  }
+
+  // Days since 1970-01-01 for a proleptic Gregorian date (month 1..12),
+  // Howard Hinnant's days_from_civil
+  inline int32_t dayNumber(int32_t year, uint32_t month, uint32_t day) {
+    year -= month <= 2 ? 1 : 0;
+    const int32_t era = (year >= 0 ? year : year - 399) / 400;
+    const uint32_t yearOfEra = static_cast<uint32_t>(year - era * 400);
+    const uint32_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<int32_t>(dayOfEra) - 719468;
+  }
+
+  // Evaluates a validated schedule in place. The day's overrides are
+  // resolved once per date into one row per profile; after that a check is
+  // a single bit test.
+  class Evaluator {
+  public:
+    void attach(const uint8_t* data) {
+      memcpy(&header_, data, sizeof(header_));
+      bitmaps_ = data + sizeof(Header);
+      overrides_ = bitmaps_ + header_.profileCount * BITMAP_BYTES;
+      day_ = -1;
+    }
+
+    uint16_t profileCount() const {
+      return header_.profileCount;
+    }
+
+    uint32_t generation() const {
+      return header_.generation;
+    }
+
+    // weekday 0 = Sunday; minute of the local day
+    bool permits(uint8_t profile, int32_t day, uint8_t weekday, uint32_t minute) {
+      if (profile == 0) {
+        return true;
+      }
+      if (profile > header_.profileCount) {
+        return false;
+      }
+      if (day != day_) {
+        resolve(day, weekday);
+      }
+      const uint8_t row = rows_[profile - 1];
+      if (row == CLOSED || row == OPEN) {
+        return row == OPEN;
+      }
+      const uint32_t bit = row * SLOTS_PER_DAY + minute / SLOT_MINUTES;
+      return (bitmaps_[(profile - 1) * BITMAP_BYTES + bit / 8] >> (bit % 8)) & 1;
+    }
+
+  private:
+    Header header_ = {};
+    const uint8_t* bitmaps_ = nullptr;
+    const uint8_t* overrides_ = nullptr;
+    int32_t day_ = -1;
+    uint8_t rows_[MAX_PROFILES] = {};
+
+    void resolve(int32_t day, uint8_t weekday) {
+      uint16_t pending = 0xFFFF;
+      memset(rows_, weekday, sizeof(rows_));
+      for (uint32_t i = 0; i < header_.overrideCount; ++i) {
+        Override entry;
+        memcpy(&entry, overrides_ + i * sizeof(Override), sizeof(entry));
+        if (entry.day != day || entry.action > OPEN) {
+          continue;
+        }
+        // The first override naming a profile wins
+        const uint16_t applies = entry.profileMask & pending;
+        for (uint32_t p = 0; p < MAX_PROFILES; ++p) {
+          if (applies & (1u << p)) {
+            rows_[p] = entry.action;
+          }
+        }
+        pending &= ~applies;
+      }
+      day_ = day;
+    }
+  };
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SERIAL CONSOLE
+// ═══════════════════════════════════════════════════════════════════════════
+// Line-based command interface on the monitor port. Polled from the loop and
+// never blocks: bytes are consumed as they arrive into a fixed line buffer,
+// and a complete line is dispatched to the registered handler by its first
+// word. `help` lists the commands. Lines starting with '#' are comments,
+// so a file of commands (e.g. a site profile) can be pasted in whole.
+
+class SerialConsole {
+public:
+  using Handler = void (*)(void* context, const char* args, Print& out);
+
+  static bool addCommand(const char* name, const char* help, Handler handler, void* context) {
+    if (commandCount_ >= MAX_COMMANDS) {
+      return false;
+    }
+    commands_[commandCount_++] = {name, help, handler, context};
+    return true;
+  }
+
+  static void poll(Stream& io) {
+    while (io.available() > 0) {
+      const int ch = io.read();
+      if (ch == '\r' || ch == '\n') {
+        if (length_ > 0) {
+          line_[length_] = '\0';
+          dispatch(io);
+          length_ = 0;
+        }
+      } else if (length_ < sizeof(line_) - 1) {
+        line_[length_++] = static_cast<char>(ch);
+      }
+    }
+  }
+
+private:
+  struct Command {
+    const char* name;
+    const char* help;
+    Handler handler;
+    void* context;
+  };
+
+  static constexpr size_t MAX_COMMANDS = 20;
+
+  static inline Command commands_[MAX_COMMANDS];
+  static inline size_t commandCount_ = 0;
+  static inline char line_[96];
+  static inline size_t length_ = 0;
+
+  static void dispatch(Print& out) {
+    if (line_[0] == '#') {
+      return;
+    }
+    char* args = line_;
+    while (*args != '\0' && *args != ' ') {
+      ++args;
+    }
+    if (*args == ' ') {
+      *args++ = '\0';
+    }
+
+    if (strcmp(line_, "help") == 0) {
+      for (size_t i = 0; i < commandCount_; ++i) {
+        out.printf("  %-10s %s\n", commands_[i].name, commands_[i].help);
+      }
+      return;
+    }
+
+    for (size_t i = 0; i < commandCount_; ++i) {
+      if (strcmp(line_, commands_[i].name) == 0) {
+        commands_[i].handler(commands_[i].context, args, out);
+        return;
+      }
+    }
+    out.printf("[Console] Unknown command '%s', try help\n", line_);
+  }
+};
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <atomic>
+#include <esp_attr.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <mdns.h>
+
+#include "Config.h"
+#include "Metrics.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// RECOGNITION SERVER DISCOVERY (mDNS / DNS-SD)
+// ═══════════════════════════════════════════════════════════════════════════
+// Finds the server by browsing DISCOVERY_SERVICE instead of trusting the
+// address in WEBHOOK_URL, so a new DHCP lease does not need a reflash.
+//
+// Queries block for up to DISCOVERY_QUERY_TIMEOUT_MS, so they run only in a
+// low-priority background task. The vehicle path just reads the cached
+// endpoint. The cache lives in three places:
+//   * RAM. The task re-queries at half the record TTL (clamped). If a query
+//     fails the last address is kept, since a stale address beats none.
+//   * RTC memory, which survives a software reset or watchdog reboot.
+//   * NVS, which survives power loss and is written only when the address
+//     changes, to spare flash.
+// On boot the RTC copy, then the NVS copy, is used right away and refreshed
+// in the background. With neither, the WEBHOOK_URL host stays in use.
+//
+// Advertise the service from the server host with
+// config/gatekeeper-lpr.service (Avahi).
+
+class ServerDiscovery {
+public:
+  struct Endpoint {
+    uint32_t address;  // IPv4, network byte order as in IPAddress
+    uint16_t port;
+  };
+
+  // Loads a cached endpoint. Safe before Wi-Fi is up.
+  static void loadCache() {
+    Endpoint endpoint = {};
+    if (rtcCache_.magic == CACHE_MAGIC && rtcCache_.check == checksum(rtcCache_.endpoint)) {
+      endpoint = rtcCache_.endpoint;
+    } else if (!loadFromNvs(endpoint)) {
+      return;
+    }
+    // Serve right away, but refresh at the first chance
+    publish(endpoint, false);
+    Serial.printf("[Discovery] Cached server %s:%u\n", IPAddress(endpoint.address).toString().c_str(),
+                  endpoint.port);
+  }
+
+  // Starts mDNS and the refresh task once Wi-Fi is up. Idempotent.
+  static void start() {
+    if (started_) {
+      return;
+    }
+    if (mdns_init() != ESP_OK) {
+      Serial.println("[Discovery] mDNS init failed");
+      return;
+    }
+    started_ = true;
+    xTaskCreatePinnedToCore(taskMain, "discovery", 4096, nullptr, 1, nullptr, 0);
+  }
+
+  // Increments whenever the endpoint changes; cheap to poll every loop.
+  static uint32_t generation() {
+    return generation_.load(std::memory_order_acquire);
+  }
+
+  static bool endpoint(Endpoint& out) {
+    portENTER_CRITICAL(&lock_);
+    out = endpoint_;
+    portEXIT_CRITICAL(&lock_);
+    return out.address != 0;
+  }
+
+private:
+  static constexpr uint32_t CACHE_MAGIC = 0x47444331;  // "GDC1"
+
+  struct RtcCache {
+    uint32_t magic;
+    Endpoint endpoint;
+    uint32_t check;
+  };
+
+  static inline RTC_NOINIT_ATTR RtcCache rtcCache_;
+  static inline portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+  static inline Endpoint endpoint_ = {};
+  static inline std::atomic<uint32_t> generation_{0};
+  static inline bool started_ = false;
+
+  static void taskMain(void*) {
+    for (;;) {
+      if (WiFi.status() != WL_CONNECTED) {
+        vTaskDelay(pdMS_TO_TICKS(1000));
+        continue;
+      }
+
+      uint32_t ttlS = 0;
+      Endpoint found = {};
+      Metrics::add(Metric::DiscoveryQueries);
+      if (query(found, ttlS)) {
+        Endpoint previous;
+        endpoint(previous);
+        const bool changed = found.address != previous.address || found.port != previous.port;
+        publish(found, changed);
+        if (changed) {
+          Serial.printf("[Discovery] Server now %s:%u (ttl %us)\n", IPAddress(found.address).toString().c_str(),
+                        found.port, static_cast<unsigned>(ttlS));
+        }
+        // Re-query at half the TTL so the entry never actually expires
+        vTaskDelay(pdMS_TO_TICKS(ttlS * 500));
+      } else {
+        Metrics::add(Metric::DiscoveryFailures);
+        vTaskDelay(pdMS_TO_TICKS(Config::DISCOVERY_RETRY_MS));
+      }
+    }
+  }
+
+  static bool query(Endpoint& found, uint32_t& ttlS) {
+    mdns_result_t* results = nullptr;
+    if (mdns_query_ptr(Config::DISCOVERY_SERVICE, Config::DISCOVERY_PROTOCOL, Config::DISCOVERY_QUERY_TIMEOUT_MS,
+                       4, &results) != ESP_OK) {
+      return false;
+    }
+
+    bool ok = false;
+    for (const mdns_result_t* result = results; result != nullptr && !ok; result = result->next) {
+      for (const mdns_ip_addr_t* addr = result->addr; addr != nullptr; addr = addr->next) {
+        if (addr->addr.type == ESP_IPADDR_TYPE_V4 && result->port != 0) {
+          found = {addr->addr.u_addr.ip4.addr, result->port};
+          ttlS = clampTtl(result->ttl);
+          ok = true;
+          break;
+        }
+      }
+    }
+    mdns_query_results_free(results);
+    return ok;
+  }
+
+  static uint32_t clampTtl(uint32_t ttlS) {
+    if (ttlS < Config::DISCOVERY_MIN_TTL_S) {
+      return Config::DISCOVERY_MIN_TTL_S;
+    }
+    return ttlS > Config::DISCOVERY_MAX_TTL_S ? Config::DISCOVERY_MAX_TTL_S : ttlS;
+  }
+
+  // `changed` (a query found a new server) also persists it. The
+  // generation moves whenever the served endpoint differs, which includes
+  // the first one loaded from a cache.
+  static void publish(const Endpoint& found, bool changed) {
+    portENTER_CRITICAL(&lock_);
+    const bool differs = found.address != endpoint_.address || found.port != endpoint_.port;
+    endpoint_ = found;
+    portEXIT_CRITICAL(&lock_);
+
+    rtcCache_ = {CACHE_MAGIC, found, checksum(found)};
+    if (changed) {
+      saveToNvs(found);
+      Metrics::add(Metric::DiscoveryChanges);
+    }
+    if (differs) {
+      generation_.fetch_add(1, std::memory_order_release);
+    }
+  }
+
+  static uint32_t checksum(const Endpoint& endpoint) {
+    return (endpoint.address ^ (static_cast<uint32_t>(endpoint.port) << 16) ^ 0xA5A5A5A5) * 2654435761U;
+  }
+
+  static bool loadFromNvs(Endpoint& endpoint) {
+    Preferences preferences;
+    if (!preferences.begin("discovery", true)) {
+      return false;
+    }
+    endpoint.address = preferences.getUInt("address", 0);
+    endpoint.port = preferences.getUShort("port", 0);
+    preferences.end();
+    return endpoint.address != 0 && endpoint.port != 0;
+  }
+
+  static void saveToNvs(const Endpoint& endpoint) {
+    Preferences preferences;
+    if (preferences.begin("discovery", false)) {
+      preferences.putUInt("address", endpoint.address);
+      preferences.putUShort("port", endpoint.port);
+      preferences.end();
+    }
+  }
+};
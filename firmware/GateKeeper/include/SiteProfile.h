@@ -0,0 +1,137 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+#include "Config.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SITE PROFILE
+// ═══════════════════════════════════════════════════════════════════════════
+// The lane timings that depend on the site, kept in NVS over the Config
+// defaults so one image serves every lane. tools/sim/sweep_sim chooses
+// them from recorded or synthetic traffic and writes them as key=value
+// lines, which the `profile` console command takes as they are:
+//
+//   debounce_ms    RestartWindow debounce window (DEBOUNCE_DELAY_MS)
+//   timeout_ms     decision request timeout (HTTP_TIMEOUT_MS)
+//   retries        requests repeated after one gets no answer (DECISION_RETRIES)
+//   hold_open_ms   close delay after the vehicle leaves (HOLD_OPEN_MS)
+//
+// The sensors read debounce_ms when they are set up, so it takes effect
+// at the next boot; the others apply from the next vehicle.
+
+struct SiteSettings {
+  unsigned long debounceMs = Config::DEBOUNCE_DELAY_MS;
+  unsigned long timeoutMs = Config::HTTP_TIMEOUT_MS;
+  uint8_t retries = Config::DECISION_RETRIES;
+  unsigned long holdOpenMs = Config::HOLD_OPEN_MS;
+};
+
+class SiteProfile {
+public:
+  static void begin() {
+    Preferences preferences;
+    if (!preferences.begin(NAMESPACE, true)) {
+      return;  // Nothing stored yet
+    }
+    values_.debounceMs = preferences.getULong("debounce_ms", values_.debounceMs);
+    values_.timeoutMs = preferences.getULong("timeout_ms", values_.timeoutMs);
+    values_.retries = preferences.getUChar("retries", values_.retries);
+    values_.holdOpenMs = preferences.getULong("hold_open_ms", values_.holdOpenMs);
+    preferences.end();
+  }
+
+  static unsigned long debounceMs() {
+    return values_.debounceMs;
+  }
+
+  static unsigned long timeoutMs() {
+    return values_.timeoutMs;
+  }
+
+  static uint8_t retries() {
+    return values_.retries;
+  }
+
+  static unsigned long holdOpenMs() {
+    return values_.holdOpenMs;
+  }
+
+  // `profile`, `profile clear` or `profile key=value ...`
+  static void onCommand(void*, const char* args, Print& out) {
+    if (strcmp(args, "clear") == 0) {
+      Preferences preferences;
+      if (preferences.begin(NAMESPACE, false)) {
+        preferences.clear();
+        preferences.end();
+      }
+      values_ = SiteSettings{};
+      out.println("[Profile] Cleared, Config defaults apply");
+    } else if (args[0] != '\0' && !apply(args, out)) {
+      out.println("[Profile] Usage: profile [clear | debounce_ms=N timeout_ms=N retries=N hold_open_ms=N]");
+      return;
+    }
+    out.printf("[Profile] debounce_ms=%lu timeout_ms=%lu retries=%u hold_open_ms=%lu\n", values_.debounceMs,
+               values_.timeoutMs, static_cast<unsigned>(values_.retries), values_.holdOpenMs);
+  }
+
+private:
+  static constexpr const char* NAMESPACE = "profile";
+  static constexpr unsigned long MAX_RETRIES = 5;
+
+  static inline SiteSettings values_;
+
+  // Parses every pair before storing any, so a typo changes nothing
+  static bool apply(const char* args, Print& out) {
+    SiteSettings next = values_;
+    const char* cursor = args;
+    while (*cursor != '\0') {
+      if (*cursor == ' ') {
+        ++cursor;
+        continue;
+      }
+      const char* equals = strchr(cursor, '=');
+      if (equals == nullptr) {
+        return false;
+      }
+      char* end = nullptr;
+      const unsigned long value = strtoul(equals + 1, &end, 10);
+      if (end == equals + 1 || (*end != ' ' && *end != '\0')) {
+        return false;
+      }
+
+      const size_t keyLength = equals - cursor;
+      if (keyMatches(cursor, keyLength, "debounce_ms")) {
+        next.debounceMs = value;
+      } else if (keyMatches(cursor, keyLength, "timeout_ms") && value > 0) {
+        next.timeoutMs = value;
+      } else if (keyMatches(cursor, keyLength, "retries") && value <= MAX_RETRIES) {
+        next.retries = static_cast<uint8_t>(value);
+      } else if (keyMatches(cursor, keyLength, "hold_open_ms")) {
+        next.holdOpenMs = value;
+      } else {
+        out.printf("[Profile] Bad setting %.*s\n", static_cast<int>(end - cursor), cursor);
+        return false;
+      }
+      cursor = end;
+    }
+
+    values_ = next;
+    Preferences preferences;
+    if (!preferences.begin(NAMESPACE, false)) {
+      out.println("[Profile] NVS unavailable, applied until reboot");
+      return true;
+    }
+    preferences.putULong("debounce_ms", next.debounceMs);
+    preferences.putULong("timeout_ms", next.timeoutMs);
+    preferences.putUChar("retries", next.retries);
+    preferences.putULong("hold_open_ms", next.holdOpenMs);
+    preferences.end();
+    return true;
+  }
+
+  static bool keyMatches(const char* key, size_t length, const char* name) {
+    return strlen(name) == length && strncmp(key, name, length) == 0;
+  }
+};
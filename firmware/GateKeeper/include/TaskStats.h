@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "Config.h"
+#include "Metrics.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TASK STATISTICS
+// ═══════════════════════════════════════════════════════════════════════════
+// Snapshots every task with uxTaskGetSystemState() into static storage and
+// reports each task's priority, core and stack headroom. One snapshot
+// briefly suspends the scheduler and costs well under a millisecond, so at
+// the metrics interval it can stay on in production. Stack headroom is the
+// high-water mark in bytes (ESP-IDF counts bytes).
+//
+// There is no CPU share: the prebuilt arduino-esp32 FreeRTOS is built
+// without configGENERATE_RUN_TIME_STATS, so the run-time counters are never
+// filled in. `prof` (SamplingProfiler.h) shows where CPU time goes.
+
+class TaskStats {
+public:
+  static void collect(Print& out) {
+#if configUSE_TRACE_FACILITY
+    const UBaseType_t count = uxTaskGetSystemState(tasks_, MAX_TASKS, nullptr);
+
+    uint32_t minHeadroom = UINT32_MAX;
+    for (UBaseType_t i = 0; i < count; ++i) {
+      const TaskStatus_t& task = tasks_[i];
+      const uint32_t headroom = task.usStackHighWaterMark;
+      out.printf("[Tasks] %-16s prio=%2u core=%s stack_free=%u\n", task.pcTaskName,
+                 static_cast<unsigned>(task.uxCurrentPriority), coreName(task), static_cast<unsigned>(headroom));
+
+      if (headroom < Config::STACK_WARNING_BYTES) {
+        out.printf("[Tasks] WARNING %s stack headroom %u bytes\n", task.pcTaskName,
+                   static_cast<unsigned>(headroom));
+      }
+      if (headroom < minHeadroom) {
+        minHeadroom = headroom;
+      }
+    }
+
+    Metrics::set(Metric::TaskCount, count);
+    Metrics::set(Metric::StackMinHeadroom, minHeadroom);
+#else
+    // Without the trace facility only the calling task can be inspected
+    (void)out;
+    Metrics::set(Metric::StackMinHeadroom, uxTaskGetStackHighWaterMark(nullptr));
+#endif
+  }
+
+private:
+#if configUSE_TRACE_FACILITY
+  static constexpr UBaseType_t MAX_TASKS = 24;
+
+  static inline TaskStatus_t tasks_[MAX_TASKS];
+
+  static const char* coreName(const TaskStatus_t& task) {
+#ifdef configTASKLIST_INCLUDE_COREID
+    switch (task.xCoreID) {
+      case 0:
+        return "0";
+      case 1:
+        return "1";
+      default:
+        return "*";
+    }
+#else
+    (void)task;
+    return "?";
+#endif
+  }
+#endif
+};
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lwip/sockets.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/x509_crt.h>
+
+#include "Config.h"
+#include "Metrics.h"
+#include "NonBlockingClient.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TLS CLIENT WITH SESSION RESUMPTION
+// ═══════════════════════════════════════════════════════════════════════════
+// mbedTLS over a NonBlockingClient connection, exposing the transport API
+// LeanHttpClient expects. A full handshake (ECDHE plus certificate chain
+// verification) costs hundreds of milliseconds on the ESP32. To keep that
+// off the vehicle path:
+//   * the SSL context is set up once and only reset between connections,
+//   * the negotiated session (ID or ticket) is kept and offered on every
+//     reconnect, so the server can resume with an abbreviated handshake,
+//   * WebhookClient::warmUp() connects right after boot and Wi-Fi
+//     reconnects, so a vehicle normally finds the connection already open.
+// Like NonBlockingClient, startConnect() only begins the lookup and the
+// TCP connect; each pollConnect() then runs whatever handshake steps the
+// socket allows without waiting, and the caller owns the deadline. A write
+// still waits for the socket, bounded by TLS_WRITE_TIMEOUT_MS, after which
+// the connection is dropped well before the task watchdog.
+
+class TlsClient {
+public:
+  ~TlsClient() {
+    stop();
+  }
+
+  void setHostname(const char* hostname) {
+    hostname_ = hostname;
+  }
+
+  // PEM CA certificate for the server; empty disables verification.
+  void setCaCert(const char* pem) {
+    caPem_ = pem;
+  }
+
+  using ConnectStatus = NonBlockingClient::ConnectStatus;
+
+  bool startConnect(const char* host, uint16_t port) {
+    stop();
+    if (!setupOnce() || !tcp_.startConnect(host, port)) {
+      return false;
+    }
+    phase_ = Phase::Connecting;
+    return true;
+  }
+
+  ConnectStatus pollConnect() {
+    if (phase_ == Phase::Connecting) {
+      const ConnectStatus status = tcp_.pollConnect();
+      if (status != ConnectStatus::Connected) {
+        if (status == ConnectStatus::Failed) {
+          Serial.println("[TLS] TCP connect failed");
+          stop();
+        }
+        return status;
+      }
+      startHandshake();
+    }
+    if (phase_ == Phase::Handshake) {
+      return stepHandshake();
+    }
+    return phase_ == Phase::Open ? ConnectStatus::Connected : ConnectStatus::Failed;
+  }
+
+  int setNoDelay(bool enabled) {
+    return tcp_.setNoDelay(enabled);
+  }
+
+  size_t write(const uint8_t* data, size_t length) {
+    const uint32_t startMs = millis();
+    size_t written = 0;
+    while (written < length && phase_ == Phase::Open) {
+      const int ret = mbedtls_ssl_write(&ssl_, data + written, length - written);
+      if (ret > 0) {
+        written += ret;
+      } else if (ret != MBEDTLS_ERR_SSL_WANT_WRITE && ret != MBEDTLS_ERR_SSL_WANT_READ) {
+        stop();
+      } else if (!waitReady(ret == MBEDTLS_ERR_SSL_WANT_WRITE, startMs, Config::TLS_WRITE_TIMEOUT_MS)) {
+        Serial.println("[TLS] Write timed out, peer not reading");
+        stop();
+      }
+    }
+    return written;
+  }
+
+  int available() {
+    fill();
+    return static_cast<int>(rxLength_ - rxPosition_);
+  }
+
+  int read() {
+    uint8_t byte;
+    return read(&byte, 1) == 1 ? byte : -1;
+  }
+
+  int read(uint8_t* buffer, size_t length) {
+    fill();
+    const size_t buffered = rxLength_ - rxPosition_;
+    const size_t count = buffered < length ? buffered : length;
+    memcpy(buffer, rx_ + rxPosition_, count);
+    rxPosition_ += count;
+    return static_cast<int>(count);
+  }
+
+  // Also notices a close_notify or FIN on an idle kept-alive connection.
+  uint8_t connected() {
+    if (phase_ == Phase::Open && rxPosition_ == rxLength_) {
+      fill();
+    }
+    return phase_ == Phase::Open || rxPosition_ < rxLength_;
+  }
+
+  void stop() {
+    if (phase_ == Phase::Open) {
+      mbedtls_ssl_close_notify(&ssl_);
+    }
+    tcp_.stop();
+    phase_ = Phase::Closed;
+    rxLength_ = rxPosition_ = 0;
+  }
+
+  // Drops the cached session so the next connect does a full handshake.
+  void forgetSession() {
+    if (hasSession_) {
+      mbedtls_ssl_session_free(&session_);
+      mbedtls_ssl_session_init(&session_);
+      hasSession_ = false;
+    }
+  }
+
+  uint32_t lastHandshakeUs() const {
+    return lastHandshakeUs_;
+  }
+
+  // The server accepted the offered session on the last connect
+  bool lastHandshakeResumed() const {
+    return lastResumed_;
+  }
+
+private:
+  enum class Phase : uint8_t { Closed, Connecting, Handshake, Open };
+
+  const char* hostname_ = "";
+  const char* caPem_ = "";
+  NonBlockingClient tcp_;
+  Phase phase_ = Phase::Closed;
+  bool ready_ = false;
+  bool fullHandshake_ = false;
+  uint32_t handshakeStartUs_ = 0;
+  bool hasSession_ = false;
+  bool lastResumed_ = false;
+  uint32_t lastHandshakeUs_ = 0;
+
+  mbedtls_entropy_context entropy_;
+  mbedtls_ctr_drbg_context drbg_;
+  mbedtls_ssl_config config_;
+  mbedtls_x509_crt ca_;
+  mbedtls_ssl_context ssl_;
+  mbedtls_ssl_session session_;
+
+  uint8_t rx_[128];
+  size_t rxLength_ = 0;
+  size_t rxPosition_ = 0;
+
+  bool setupOnce() {
+    if (ready_) {
+      return true;
+    }
+
+    mbedtls_entropy_init(&entropy_);
+    mbedtls_ctr_drbg_init(&drbg_);
+    mbedtls_ssl_config_init(&config_);
+    mbedtls_x509_crt_init(&ca_);
+    mbedtls_ssl_init(&ssl_);
+    mbedtls_ssl_session_init(&session_);
+
+    if (mbedtls_ctr_drbg_seed(&drbg_, mbedtls_entropy_func, &entropy_, nullptr, 0) != 0 ||
+        mbedtls_ssl_config_defaults(&config_, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                    MBEDTLS_SSL_PRESET_DEFAULT) != 0) {
+      Serial.println("[TLS] mbedTLS setup failed");
+      return false;
+    }
+
+    mbedtls_ssl_conf_rng(&config_, mbedtls_ctr_drbg_random, &drbg_);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&config_, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+    if (caPem_[0] != '\0') {
+      if (mbedtls_x509_crt_parse(&ca_, reinterpret_cast<const unsigned char*>(caPem_), strlen(caPem_) + 1) != 0) {
+        Serial.println("[TLS] Invalid CA certificate");
+        return false;
+      }
+      mbedtls_ssl_conf_ca_chain(&config_, &ca_, nullptr);
+      mbedtls_ssl_conf_authmode(&config_, MBEDTLS_SSL_VERIFY_REQUIRED);
+    } else {
+      Serial.println("[TLS] WARNING no CA certificate, server is not verified");
+      mbedtls_ssl_conf_authmode(&config_, MBEDTLS_SSL_VERIFY_NONE);
+    }
+
+    if (mbedtls_ssl_setup(&ssl_, &config_) != 0) {
+      Serial.println("[TLS] SSL context setup failed");
+      return false;
+    }
+    mbedtls_ssl_set_bio(&ssl_, &tcp_, sendCallback, receiveCallback, nullptr);
+
+    ready_ = true;
+    return true;
+  }
+
+  // Blocks in select() until the socket is readable (or writable) or
+  // timeoutMs has passed since startMs; false once it has passed
+  bool waitReady(bool forWrite, uint32_t startMs, uint32_t timeoutMs) {
+    const uint32_t elapsedMs = millis() - startMs;
+    if (elapsedMs >= timeoutMs) {
+      return false;
+    }
+    const uint32_t remainingMs = timeoutMs - elapsedMs;
+    const int socket = tcp_.socket();
+    fd_set sockets;
+    FD_ZERO(&sockets);
+    FD_SET(socket, &sockets);
+    timeval wait = {static_cast<time_t>(remainingMs / 1000),
+                    static_cast<suseconds_t>((remainingMs % 1000) * 1000)};
+    return lwip_select(socket + 1, forWrite ? nullptr : &sockets, forWrite ? &sockets : nullptr, nullptr, &wait) >
+           0;
+  }
+
+  void startHandshake() {
+    handshakeStartUs_ = micros();
+    fullHandshake_ = false;
+    mbedtls_ssl_session_reset(&ssl_);
+    mbedtls_ssl_set_hostname(&ssl_, hostname_);
+    if (hasSession_) {
+      mbedtls_ssl_set_session(&ssl_, &session_);
+    }
+    phase_ = Phase::Handshake;
+  }
+
+  // Runs handshake steps until one would wait for the peer. Stepped by hand
+  // to see whether the server sent its certificate: a resumed handshake
+  // goes from ServerHello straight to ChangeCipherSpec. ssl_.state is a
+  // public field in the mbedTLS 2.x the core ships.
+  ConnectStatus stepHandshake() {
+    while (ssl_.state != MBEDTLS_SSL_HANDSHAKE_OVER) {
+      const int ret = mbedtls_ssl_handshake_step(&ssl_);
+      fullHandshake_ = fullHandshake_ || ssl_.state == MBEDTLS_SSL_SERVER_CERTIFICATE;
+      if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+        return ConnectStatus::Pending;
+      }
+      if (ret != 0) {
+        Serial.printf("[TLS] Handshake failed: -0x%04x\n", static_cast<unsigned>(-ret));
+        forgetSession();
+        stop();
+        return ConnectStatus::Failed;
+      }
+    }
+
+    // Wall time from the TCP connection to the end of the handshake
+    lastHandshakeUs_ = micros() - handshakeStartUs_;
+    lastResumed_ = !fullHandshake_;
+    Metrics::set(Metric::TlsHandshakeUs, lastHandshakeUs_);
+    Metrics::add(lastResumed_ ? Metric::TlsResumedHandshakes : Metric::TlsFullHandshakes);
+
+    // Keep the (possibly refreshed) session for the next reconnect
+    forgetSession();
+    hasSession_ = mbedtls_ssl_get_session(&ssl_, &session_) == 0;
+    phase_ = Phase::Open;
+    return ConnectStatus::Connected;
+  }
+
+  void fill() {
+    if (phase_ != Phase::Open || rxPosition_ < rxLength_) {
+      return;
+    }
+    rxLength_ = rxPosition_ = 0;
+
+    const int ret = mbedtls_ssl_read(&ssl_, rx_, sizeof(rx_));
+    if (ret > 0) {
+      rxLength_ = ret;
+    } else if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+      stop();  // close_notify, EOF or a fatal alert
+    }
+  }
+
+  static int sendCallback(void* context, const unsigned char* data, size_t length) {
+    const int ret = lwip_send(static_cast<NonBlockingClient*>(context)->socket(), data, length, 0);
+    if (ret >= 0) {
+      return ret;
+    }
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? MBEDTLS_ERR_SSL_WANT_WRITE : MBEDTLS_ERR_NET_SEND_FAILED;
+  }
+
+  static int receiveCallback(void* context, unsigned char* data, size_t length) {
+    const int ret = lwip_recv(static_cast<NonBlockingClient*>(context)->socket(), data, length, 0);
+    if (ret >= 0) {
+      return ret;
+    }
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? MBEDTLS_ERR_SSL_WANT_READ : MBEDTLS_ERR_NET_RECV_FAILED;
+  }
+};
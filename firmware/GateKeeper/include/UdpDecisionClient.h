@@ -0,0 +1,382 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include <mbedtls/sha256.h>
+#include <mbedtls/version.h>
+
+#include "Config.h"
+#include "FixedString.h"
+#include "Watchdog.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// UDP DECISION PROTOCOL
+// ═══════════════════════════════════════════════════════════════════════════
+// Compact trigger/decision exchange for sites where the recognition server
+// sits on the same switch. A trigger is one 32-byte datagram and the answer
+// one 48-byte datagram, with no connection to set up or keep alive.
+//
+// All integers are little-endian. Every packet ends with the first 16 bytes
+// of HMAC-SHA256(key, preceding bytes), and packets with a bad MAC are
+// dropped silently.
+//
+//   Trigger  (32): 'G' 'K' ver=1 type=1 | request_id u32 | attempt u8
+//                  | 3 x 0 | client_ms u32 | mac[16]
+//   Decision (48): 'G' 'K' ver=1 type=2 | request_id u32 | verdict u8
+//                  | plate_len u8 | plate[16] | capture_ms u16
+//                  | detect_ms u16 | ocr_ms u16 | mac[16]
+//
+// Retransmission is idempotent. The server keys work and cached answers on
+// the request ID, so a repeated trigger never starts a second recognition.
+// Until the first answer arrives the trigger is resent with a short,
+// doubling RTO, which recovers a lost datagram in tens of milliseconds. A
+// Pending verdict confirms receipt; after that the client only re-asks
+// every UDP_PENDING_RETRY_MS until the decision arrives.
+//
+// The server side is src/api/udp_server.py.
+
+namespace DecisionPacket {
+  constexpr uint8_t VERSION = 1;
+  constexpr uint8_t TYPE_TRIGGER = 1;
+  constexpr uint8_t TYPE_DECISION = 2;
+  constexpr size_t HEADER_SIZE = 4;
+  constexpr size_t MAC_SIZE = 16;
+  constexpr size_t PLATE_SIZE = 16;
+  constexpr size_t TRIGGER_SIZE = 32;
+  constexpr size_t DECISION_SIZE = 48;
+
+  enum class Verdict : uint8_t { Deny = 0, Accept = 1, Pending = 2, Error = 3 };
+
+  inline void put16(uint8_t* out, uint16_t value) {
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+  }
+
+  inline void put32(uint8_t* out, uint32_t value) {
+    put16(out, static_cast<uint16_t>(value));
+    put16(out + 2, static_cast<uint16_t>(value >> 16));
+  }
+
+  inline uint16_t get16(const uint8_t* in) {
+    return static_cast<uint16_t>(in[0] | (in[1] << 8));
+  }
+
+  inline uint32_t get32(const uint8_t* in) {
+    return get16(in) | (static_cast<uint32_t>(get16(in + 2)) << 16);
+  }
+
+  inline void putHeader(uint8_t* out, uint8_t type) {
+    out[0] = 'G';
+    out[1] = 'K';
+    out[2] = VERSION;
+    out[3] = type;
+  }
+
+  inline bool hasHeader(const uint8_t* in, uint8_t type) {
+    return in[0] == 'G' && in[1] == 'K' && in[2] == VERSION && in[3] == type;
+  }
+}
+
+// HMAC-SHA256 with the inner and outer pads hashed once at setup, so signing
+// a packet is two context copies and two short SHA-256 finishes, no heap.
+class PacketAuthenticator {
+public:
+  void setKey(const uint8_t* key, size_t length) {
+    uint8_t block[BLOCK_SIZE] = {};
+    if (length > BLOCK_SIZE) {
+      sha256(key, length, block);
+    } else {
+      memcpy(block, key, length);
+    }
+
+    uint8_t pad[BLOCK_SIZE];
+    for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+      pad[i] = block[i] ^ 0x36;
+    }
+    start(inner_);
+    update(inner_, pad, BLOCK_SIZE);
+    for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+      pad[i] = block[i] ^ 0x5c;
+    }
+    start(outer_);
+    update(outer_, pad, BLOCK_SIZE);
+  }
+
+  // Writes MAC_SIZE bytes of HMAC(data) to mac.
+  void sign(const uint8_t* data, size_t length, uint8_t* mac) const {
+    uint8_t digest[32];
+    mbedtls_sha256_context context;
+    mbedtls_sha256_init(&context);
+    mbedtls_sha256_clone(&context, &inner_);
+    update(context, data, length);
+    finish(context, digest);
+
+    mbedtls_sha256_clone(&context, &outer_);
+    update(context, digest, sizeof(digest));
+    finish(context, digest);
+    mbedtls_sha256_free(&context);
+
+    memcpy(mac, digest, DecisionPacket::MAC_SIZE);
+  }
+
+  // Constant-time check of the trailing MAC of a packet.
+  bool verify(const uint8_t* packet, size_t length) const {
+    if (length <= DecisionPacket::MAC_SIZE) {
+      return false;
+    }
+    const size_t bodyLength = length - DecisionPacket::MAC_SIZE;
+    uint8_t expected[DecisionPacket::MAC_SIZE];
+    sign(packet, bodyLength, expected);
+
+    uint8_t difference = 0;
+    for (size_t i = 0; i < DecisionPacket::MAC_SIZE; ++i) {
+      difference |= expected[i] ^ packet[bodyLength + i];
+    }
+    return difference == 0;
+  }
+
+private:
+  static constexpr size_t BLOCK_SIZE = 64;
+
+  mbedtls_sha256_context inner_;
+  mbedtls_sha256_context outer_;
+
+  // mbedTLS 3 dropped the _ret suffix that 2.x (Arduino core 2.x) needs
+#if MBEDTLS_VERSION_MAJOR >= 3
+  static void start(mbedtls_sha256_context& context) {
+    mbedtls_sha256_init(&context);
+    mbedtls_sha256_starts(&context, 0);
+  }
+  static void update(mbedtls_sha256_context& context, const uint8_t* data, size_t length) {
+    mbedtls_sha256_update(&context, data, length);
+  }
+  static void finish(mbedtls_sha256_context& context, uint8_t* digest) {
+    mbedtls_sha256_finish(&context, digest);
+  }
+  static void sha256(const uint8_t* data, size_t length, uint8_t* digest) {
+    mbedtls_sha256(data, length, digest, 0);
+  }
+#else
+  static void start(mbedtls_sha256_context& context) {
+    mbedtls_sha256_init(&context);
+    mbedtls_sha256_starts_ret(&context, 0);
+  }
+  static void update(mbedtls_sha256_context& context, const uint8_t* data, size_t length) {
+    mbedtls_sha256_update_ret(&context, data, length);
+  }
+  static void finish(mbedtls_sha256_context& context, uint8_t* digest) {
+    mbedtls_sha256_finish_ret(&context, digest);
+  }
+  static void sha256(const uint8_t* data, size_t length, uint8_t* digest) {
+    mbedtls_sha256_ret(data, length, digest, 0);
+  }
+#endif
+};
+
+class UdpDecisionClient {
+public:
+  enum class Status { Idle, Pending, Done, Failed };
+
+  struct Timings {
+    uint16_t captureMs;
+    uint16_t detectMs;
+    uint16_t ocrMs;
+  };
+
+  ~UdpDecisionClient() {
+    if (socket_ >= 0) {
+      lwip_close(socket_);
+    }
+  }
+
+  bool configure(const char* host, uint16_t port, const char* key) {
+    if (strlen(host) >= sizeof(host_)) {
+      return false;
+    }
+    strcpy(host_, host);
+    port_ = port;
+    address_ = IPAddress();
+    authenticator_.setKey(reinterpret_cast<const uint8_t*>(key), strlen(key));
+    // Start from a random ID so a reboot does not replay cached answers
+    nextRequestId_ = esp_random();
+    return true;
+  }
+
+  // Points the client at a discovered server; the next request reconnects.
+  void setAddress(IPAddress address) {
+    if (static_cast<uint32_t>(address) == static_cast<uint32_t>(address_)) {
+      return;
+    }
+    address_ = address;
+    if (socket_ >= 0) {
+      lwip_close(socket_);
+      socket_ = -1;
+    }
+  }
+
+  bool begin(unsigned long nowMs) {
+    accepted_ = false;
+    plate_.clear();
+    timings_ = {};
+    requestId_ = nextRequestId_++;
+    attempt_ = 0;
+    acknowledged_ = false;
+    rtoMs_ = Config::UDP_RTO_MS;
+    startedMs_ = nowMs;
+
+    if (!open() || !sendTrigger(nowMs)) {
+      status_ = Status::Failed;
+      return false;
+    }
+    status_ = Status::Pending;
+    return true;
+  }
+
+  Status poll(unsigned long nowMs, unsigned long timeoutMs) {
+    if (status_ != Status::Pending) {
+      return status_;
+    }
+
+    uint8_t packet[DecisionPacket::DECISION_SIZE + 1];
+    int length;
+    while ((length = lwip_recv(socket_, packet, sizeof(packet), 0)) > 0) {
+      if (handleDecision(packet, static_cast<size_t>(length))) {
+        return status_;
+      }
+    }
+
+    if ((nowMs - startedMs_) >= timeoutMs) {
+      status_ = Status::Failed;
+      return status_;
+    }
+
+    const unsigned long interval = acknowledged_ ? Config::UDP_PENDING_RETRY_MS : rtoMs_;
+    if ((nowMs - lastSendMs_) >= interval) {
+      if (!acknowledged_) {
+        rtoMs_ = rtoMs_ * 2 < Config::UDP_RTO_MAX_MS ? rtoMs_ * 2 : Config::UDP_RTO_MAX_MS;
+      }
+      sendTrigger(nowMs);
+    }
+    return status_;
+  }
+
+  // Blocking exchange. Returns Done or Failed.
+  Status decide(unsigned long timeoutMs) {
+    if (!begin(millis())) {
+      return status_;
+    }
+    Status status;
+    while ((status = poll(millis(), timeoutMs)) == Status::Pending) {
+      Watchdog::feed();
+      delay(1);
+    }
+    return status;
+  }
+
+  bool accepted() const {
+    return accepted_;
+  }
+
+  const PlateText& plate() const {
+    return plate_;
+  }
+
+  const Timings& timings() const {
+    return timings_;
+  }
+
+  // Triggers sent for the last request, including the first.
+  uint8_t transmissions() const {
+    return attempt_;
+  }
+
+private:
+  char host_[64] = {};
+  uint16_t port_ = 0;
+  IPAddress address_;
+  int socket_ = -1;
+  PacketAuthenticator authenticator_;
+
+  Status status_ = Status::Idle;
+  uint32_t nextRequestId_ = 0;
+  uint32_t requestId_ = 0;
+  uint8_t attempt_ = 0;
+  bool acknowledged_ = false;
+  unsigned long rtoMs_ = 0;
+  unsigned long startedMs_ = 0;
+  unsigned long lastSendMs_ = 0;
+
+  bool accepted_ = false;
+  PlateText plate_;
+  Timings timings_ = {};
+
+  bool open() {
+    if (static_cast<uint32_t>(address_) == 0 && !address_.fromString(host_) &&
+        WiFi.hostByName(host_, address_) != 1) {
+      return false;
+    }
+    if (socket_ >= 0) {
+      return true;
+    }
+    socket_ = lwip_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (socket_ < 0) {
+      return false;
+    }
+
+    // Connecting a UDP socket filters out datagrams from other peers
+    sockaddr_in server = {};
+    server.sin_family = AF_INET;
+    server.sin_port = htons(port_);
+    server.sin_addr.s_addr = static_cast<uint32_t>(address_);
+    if (lwip_connect(socket_, reinterpret_cast<sockaddr*>(&server), sizeof(server)) != 0) {
+      lwip_close(socket_);
+      socket_ = -1;
+      return false;
+    }
+    lwip_fcntl(socket_, F_SETFL, lwip_fcntl(socket_, F_GETFL, 0) | O_NONBLOCK);
+    return true;
+  }
+
+  bool sendTrigger(unsigned long nowMs) {
+    using namespace DecisionPacket;
+
+    uint8_t packet[TRIGGER_SIZE] = {};
+    putHeader(packet, TYPE_TRIGGER);
+    put32(packet + 4, requestId_);
+    packet[8] = ++attempt_;
+    put32(packet + 12, static_cast<uint32_t>(nowMs));
+    authenticator_.sign(packet, TRIGGER_SIZE - MAC_SIZE, packet + TRIGGER_SIZE - MAC_SIZE);
+
+    lastSendMs_ = nowMs;
+    return lwip_send(socket_, packet, sizeof(packet), 0) == static_cast<int>(sizeof(packet));
+  }
+
+  // Returns true when the packet finished the request.
+  bool handleDecision(const uint8_t* packet, size_t length) {
+    using namespace DecisionPacket;
+
+    if (length != DECISION_SIZE || !hasHeader(packet, TYPE_DECISION) || get32(packet + 4) != requestId_ ||
+        !authenticator_.verify(packet, length)) {
+      return false;  // Stale answer to an earlier request, or not ours
+    }
+
+    switch (static_cast<Verdict>(packet[8])) {
+      case Verdict::Pending:
+        acknowledged_ = true;
+        return false;
+      case Verdict::Accept:
+      case Verdict::Deny: {
+        accepted_ = static_cast<Verdict>(packet[8]) == Verdict::Accept;
+        const size_t plateLength = packet[9] < PLATE_SIZE ? packet[9] : PLATE_SIZE;
+        plate_.assign(reinterpret_cast<const char*>(packet + 10), plateLength);
+        timings_ = {get16(packet + 26), get16(packet + 28), get16(packet + 30)};
+        status_ = Status::Done;
+        return true;
+      }
+      default:
+        status_ = Status::Failed;
+        return true;
+    }
+  }
+};
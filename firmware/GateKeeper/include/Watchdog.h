@@ -0,0 +1,173 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <esp_task_wdt.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "Config.h"
+#include "Metrics.h"
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TASK WATCHDOG AND STALL BREADCRUMBS
+// ═══════════════════════════════════════════════════════════════════════════
+// The loop and display tasks are subscribed to the ESP-IDF task watchdog
+// with panic enabled. A task that stops feeding for WATCHDOG_TIMEOUT_S
+// therefore resets the chip. Before this, a hung HTTP read, I2C transfer
+// or Wi-Fi call left the barrier where it was until someone power-cycled
+// the gate. After the reset, setup() drives the barrier to
+// GATE_SAFE_STATE before anything that can block.
+//
+// Each watched task marks the span of work it is in. A mark is a few
+// stores into RTC memory, which survives the watchdog reset. The timeout
+// hook also stamps the time it fired. On the next boot the report names,
+// for each task, the span it was stuck in and for how long. The report
+// goes to Serial and to the `wdt` console command.
+//
+// Bounded waits that poll (blocking HTTP and UDP requests, Wi-Fi connect)
+// feed the watchdog while they wait. Only a single call that blocks past
+// the timeout counts as a stall.
+
+#define GATEKEEPER_SPANS(X)          \
+  X(Idle, "idle")                    \
+  X(Setup, "setup")                  \
+  X(WiFi, "wifi_connect")            \
+  X(Presence, "presence")            \
+  X(Decision, "decision")            \
+  X(Servo, "servo")                  \
+  X(DenylistAlert, "denylist_alert") \
+  X(DenylistSync, "denylist_sync")   \
+  X(Transport, "transport_maintain") \
+  X(Remote, "remote_commands")       \
+  X(Console, "console")              \
+  X(Metrics, "metrics_report")       \
+  X(OledRender, "oled_render")       \
+  X(OledFlush, "oled_flush")         \
+  X(Trace, "trace_flush")
+
+enum class Span : uint8_t {
+#define GATEKEEPER_SPAN_ENUM(id, name) id,
+  GATEKEEPER_SPANS(GATEKEEPER_SPAN_ENUM)
+#undef GATEKEEPER_SPAN_ENUM
+  Count
+};
+
+// One breadcrumb slot each
+enum class WatchedTask : uint8_t { Loop, Display, Count };
+
+class Watchdog {
+public:
+  // First thing in setup(): reports a previous stall, then arms the
+  // watchdog with panic so the next one resets.
+  static void begin() {
+    const esp_reset_reason_t reason = esp_reset_reason();
+    stalled_ = (reason == ESP_RST_TASK_WDT || reason == ESP_RST_INT_WDT || reason == ESP_RST_WDT) &&
+               record_.magic == RECORD_MAGIC;
+    if (record_.magic != RECORD_MAGIC) {
+      record_.stallResets = 0;
+    } else if (stalled_) {
+      ++record_.stallResets;
+      last_ = record_;
+    }
+    Metrics::set(Metric::WatchdogResets, record_.stallResets);
+    if (stalled_) {
+      printReport(Serial);
+    }
+
+    const uint32_t resets = record_.stallResets;
+    memset(&record_, 0, sizeof(record_));
+    record_.magic = RECORD_MAGIC;
+    record_.stallResets = resets;
+    esp_task_wdt_init(Config::WATCHDOG_TIMEOUT_S, true);
+  }
+
+  // Subscribes a task; it must feed from now on
+  static void watch(WatchedTask task, TaskHandle_t handle) {
+    handles_[index(task)] = handle;
+    record_.slots[index(task)].fedMs = millis();
+    esp_task_wdt_add(handle);
+  }
+
+  // Resets the calling task's timer; harmless from an unwatched task
+  static void feed() {
+    const TaskHandle_t current = xTaskGetCurrentTaskHandle();
+    for (size_t i = 0; i < TASK_COUNT; ++i) {
+      if (handles_[i] == current) {
+        record_.slots[i].fedMs = millis();
+        esp_task_wdt_reset();
+        return;
+      }
+    }
+  }
+
+  static void mark(WatchedTask task, Span span) {
+    Breadcrumb& slot = record_.slots[index(task)];
+    slot.span = static_cast<uint8_t>(span);
+    slot.sinceMs = millis();
+  }
+
+  // From the timeout interrupt: stamp the time before the panic resets
+  static void onTimeout() {
+    record_.firedMs = millis();
+  }
+
+  static void printReport(Print& out) {
+    if (!stalled_) {
+      out.printf("[Watchdog] No stall since power-up (%u stall resets)\n",
+                 static_cast<unsigned>(record_.stallResets));
+      return;
+    }
+    out.printf("[Watchdog] Reset after a stall (%u since power-up)\n", static_cast<unsigned>(last_.stallResets));
+    for (size_t i = 0; i < TASK_COUNT; ++i) {
+      const Breadcrumb& slot = last_.slots[i];
+      const char* span = slot.span < SPAN_COUNT ? SPAN_NAMES[slot.span] : "?";
+      if (last_.firedMs == 0) {
+        out.printf("[Watchdog] %-8s last in %s\n", TASK_NAMES[i], span);
+      } else {
+        out.printf("[Watchdog] %-8s in %s for %u ms, last fed %u ms before the reset\n", TASK_NAMES[i], span,
+                   static_cast<unsigned>(last_.firedMs - slot.sinceMs),
+                   static_cast<unsigned>(last_.firedMs - slot.fedMs));
+      }
+    }
+  }
+
+private:
+  static constexpr uint32_t RECORD_MAGIC = 0x47575031;  // "GWP1"
+  static constexpr size_t SPAN_COUNT = static_cast<size_t>(Span::Count);
+  static constexpr size_t TASK_COUNT = static_cast<size_t>(WatchedTask::Count);
+
+  static constexpr const char* SPAN_NAMES[SPAN_COUNT] = {
+#define GATEKEEPER_SPAN_NAME(id, name) name,
+      GATEKEEPER_SPANS(GATEKEEPER_SPAN_NAME)
+#undef GATEKEEPER_SPAN_NAME
+  };
+  static constexpr const char* TASK_NAMES[TASK_COUNT] = {"loop", "display"};
+
+  // Blocking calls that do not feed must fit well inside the timeout
+  static_assert(Config::WATCHDOG_TIMEOUT_S * 1000 > Config::TLS_WRITE_TIMEOUT_MS + 2000,
+                "WATCHDOG_TIMEOUT_S must outlast a TLS write to a peer that is not reading");
+
+  struct Breadcrumb {
+    uint32_t sinceMs;  // Entered the span
+    uint32_t fedMs;
+    uint8_t span;
+  };
+
+  struct Record {
+    uint32_t magic;
+    uint32_t firedMs;  // 0 when the timeout hook did not run
+    uint32_t stallResets;
+    Breadcrumb slots[TASK_COUNT];
+  };
+
+  static inline RTC_NOINIT_ATTR Record record_;
+  static inline TaskHandle_t handles_[TASK_COUNT] = {};
+  static inline Record last_ = {};
+  static inline bool stalled_ = false;
+
+  static constexpr size_t index(WatchedTask task) {
+    return static_cast<size_t>(task);
+  }
+};
@@ -0,0 +1,109 @@
+#ifdef GATEKEEPER_HEAP_TRIPWIRE
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <new>
+
+#include "HeapMonitor.h"
+
+namespace {
+
+constexpr size_t SLOTS = 16;
+
+struct Allocation {
+  uint32_t caller;
+  uint32_t size;
+};
+
+// Written by the app task inside the allocator, read by the same task in
+// report(), so plain volatile indices are enough.
+Allocation allocations[SLOTS];
+volatile uint32_t written = 0;
+uint32_t reported = 0;
+TaskHandle_t appTask = nullptr;
+volatile bool armed = false;
+
+// Windowed-ABI return addresses carry the call size in the top two bits.
+uint32_t callerAddress(void* returnAddress) {
+  return (static_cast<uint32_t>(reinterpret_cast<uintptr_t>(returnAddress)) & 0x3FFFFFFF) | 0x40000000;
+}
+
+void record(size_t size, void* returnAddress) {
+  if (!armed || xTaskGetCurrentTaskHandle() != appTask) {
+    return;
+  }
+  Allocation& slot = allocations[written % SLOTS];
+  slot.caller = callerAddress(returnAddress);
+  slot.size = size;
+  written = written + 1;
+}
+
+}  // namespace
+
+void HeapTripwire::arm() {
+  appTask = xTaskGetCurrentTaskHandle();
+  armed = true;
+  Serial.println("[Heap] Tripwire armed");
+}
+
+uint32_t HeapTripwire::allocationCount() {
+  return written;
+}
+
+void HeapTripwire::report(Print& out) {
+  const uint32_t end = written;
+  if (end - reported > SLOTS) {
+    out.printf("[Heap] %u allocations lost\n", static_cast<unsigned>(end - reported - SLOTS));
+    reported = end - SLOTS;
+  }
+
+  for (; reported != end; ++reported) {
+    const Allocation& slot = allocations[reported % SLOTS];
+    out.printf("[Heap] %u bytes after setup from 0x%08x\n", static_cast<unsigned>(slot.size),
+               static_cast<unsigned>(slot.caller));
+    Metrics::add(Metric::HeapAllocsAfterSetup);
+  }
+}
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+  record(size, __builtin_return_address(0));
+  return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+  record(count * size, __builtin_return_address(0));
+  return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+  record(size, __builtin_return_address(0));
+  return __real_realloc(ptr, size);
+}
+}
+
+// Replaced so the recorded caller is the code doing `new`, not libstdc++.
+void* operator new(size_t size) {
+  record(size, __builtin_return_address(0));
+  void* ptr = __real_malloc(size);
+  if (ptr == nullptr) {
+    abort();
+  }
+  return ptr;
+}
+
+void* operator new[](size_t size) {
+  record(size, __builtin_return_address(0));
+  void* ptr = __real_malloc(size);
+  if (ptr == nullptr) {
+    abort();
+  }
+  return ptr;
+}
+
+#endif  // GATEKEEPER_HEAP_TRIPWIRE
@@ -9,47 +9,39 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <HTTPClient.h>
 #include <Servo.h>
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
-
-// ═══════════════════════════════════════════════════════════════════════════
-// CONFIGURATION
-// ═══════════════════════════════════════════════════════════════════════════
-
-namespace Config {
-  // WiFi Credentials
-  constexpr char WIFI_SSID[] = "TP-Link_4736";
-  constexpr char WIFI_PASSWORD[] = "QuakQuak@1238";
-  constexpr unsigned long WIFI_TIMEOUT_MS = 20000;
-  
-  // Webhook Configuration
-  constexpr char WEBHOOK_URL[] = "http://192.168.10.213:8000/lpr";
-  constexpr unsigned long HTTP_TIMEOUT_MS = 60000;
-  
-  // Hardware Pins
-  constexpr int LM393_SENSOR_PIN = 4;
-  constexpr int SERVO_CONTROL_PIN = 5;
-  
-  // Servo Settings
-  constexpr int SERVO_MIN_PULSE_US = 500;
-  constexpr int SERVO_MAX_PULSE_US = 2400;
-  constexpr int SERVO_CLOSED_ANGLE = 0;
-  constexpr int SERVO_OPEN_ANGLE = 90;
-
-  // OLED Display Settings
-  constexpr int OLED_WIDTH = 128;
-  constexpr int OLED_HEIGHT = 64;
-  constexpr int OLED_RESET_PIN = -1;
-  constexpr uint8_t OLED_I2C_ADDRESS = 0x3C;
-  
-  // Timing
-  constexpr unsigned long DEBOUNCE_DELAY_MS = 50;
-  constexpr unsigned long LOOP_DELAY_MS = 10;
-  constexpr int SERIAL_BAUD_RATE = 115200;
-}
+#include <type_traits>
+
+#include "AccessSchedule.h"
+#include "Config.h"
+#include "DecisionTransport.h"
+#include "Denylist.h"
+#include "FieldTrace.h"
+#include "FixedString.h"
+#include "FlashAllowlist.h"
+#include "HeapMonitor.h"
+#include "HttpBenchmark.h"
+#include "LeanHttpClient.h"
+#include "LockFreeQueue.h"
+#include "Metrics.h"
+#include "MqttDecisionTransport.h"
+#include "NonBlockingClient.h"
+#include "OledBus.h"
+#include "PlateRenderer.h"
+#include "PresenceSources.h"
+#include "Protothread.h"
+#include "QemuHarness.h"
+#include "SamplingProfiler.h"
+#include "SerialConsole.h"
+#include "ServerDiscovery.h"
+#include "SiteProfile.h"
+#include "TaskStats.h"
+#include "TlsClient.h"
+#include "UdpDecisionClient.h"
+#include "Watchdog.h"
 
 // ═══════════════════════════════════════════════════════════════════════════
 // WIFI MANAGER
@@ -69,6 +61,7 @@ public:
     const unsigned long startTime = millis();
     
     while (!isConnected() && !isTimeout(startTime)) {
+      Watchdog::feed();
       delay(500);
       Serial.print('.');
     }
@@ -83,8 +76,9 @@ public:
     }
   }
 
+  // The QEMU build has no radio; its server link is the UART tunnel
   static bool isConnected() {
-    return WiFi.status() == WL_CONNECTED;
+    return Config::QEMU_BUILD || WiFi.status() == WL_CONNECTED;
   }
 
 private:
@@ -97,122 +91,225 @@ private:
 // HTTP CLIENT
 // ═══════════════════════════════════════════════════════════════════════════
 
-class WebhookClient {
+// Webhook and denylist requests go to the same server, over TLS when
+// WEBHOOK_URL is https://.
+#ifdef GATEKEEPER_QEMU
+using ServerTransport = UartTunnelClient;
+
+void configureServerTransport(UartTunnelClient&, const char*) {}
+#else
+using ServerTransport = std::conditional_t<Config::WEBHOOK_USE_TLS, TlsClient, NonBlockingClient>;
+#endif
+
+void configureServerTransport(NonBlockingClient&, const char*) {}
+
+void configureServerTransport(TlsClient& tls, const char* host) {
+  tls.setHostname(host);
+  tls.setCaCert(Config::WEBHOOK_CA_CERT);
+}
+
+class WebhookClient final : public DecisionTransport {
 public:
-  static bool shouldOpenGate(String& plateOut) {
-    plateOut = "";
+  const char* name() const override {
+    return Config::UDP_DECISION_ENABLED ? "UDP" : "HTTP";
+  }
+
+  void initialize() override {
+    if (!http_.configure(Config::WEBHOOK_URL)) {
+      Serial.printf("[HTTP] Invalid webhook URL %s\n", Config::WEBHOOK_URL);
+    }
+    configureServerTransport(http_.transport(), http_.host());
+    if (Config::UDP_DECISION_ENABLED) {
+      udp_.configure(http_.host(), Config::UDP_DECISION_PORT, Config::UDP_DECISION_KEY);
+    }
+    if (Config::DISCOVERY_ENABLED) {
+      ServerDiscovery::loadCache();
+      applyDiscoveredEndpoint();
+    }
+  }
+
+  // Starts opening the connection (and for HTTPS the handshake) while no
+  // vehicle is waiting; maintain() steps it. Called after boot, after Wi-Fi
+  // reconnects and periodically while idle, so a server-side keep-alive
+  // timeout is repaired early too.
+  void warmUp() override {
+    if (Config::DISCOVERY_ENABLED && WiFiManager::isConnected()) {
+      ServerDiscovery::start();
+    }
+    if (Config::UDP_DECISION_ENABLED || !WiFiManager::isConnected() || warming_ ||
+        state_ == DecisionState::Pending || http_.transport().connected()) {
+      return;
+    }
+    if (http_.startConnect(millis())) {
+      warming_ = true;
+    } else {
+      warmUpFailed();
+    }
+  }
+
+  void maintain(unsigned long nowMs) override {
+    if (Config::DISCOVERY_ENABLED) {
+      applyDiscoveredEndpoint();
+    }
+    if (warming_) {
+      const ConnectStatus status = http_.pollConnect(nowMs);
+      if (status == ConnectStatus::Connected) {
+        warming_ = false;
+        warmUpIntervalMs_ = Config::CONNECTION_WARMUP_INTERVAL_MS;
+        Serial.printf("[HTTP] Connection to %s:%u ready\n", http_.host(), http_.port());
+      } else if (status == ConnectStatus::Failed) {
+        warming_ = false;
+        warmUpFailed();
+      }
+    }
+    if ((nowMs - lastWarmUpMs_) >= warmUpIntervalMs_) {
+      lastWarmUpMs_ = nowMs;
+      warmUp();
+    }
+  }
+
+  void startDecision(unsigned long nowMs) override {
+    startUs_ = micros();
     if (!WiFiManager::isConnected()) {
       Serial.println("[HTTP] Skipping GET - WiFi not connected");
-      return false;
+      state_ = DecisionState::Failed;
+      return;
+    }
+    state_ = DecisionState::Pending;
+    if (Config::UDP_DECISION_ENABLED) {
+      udp_.begin(nowMs);  // A failed send shows up in the first poll
+      return;
     }
-
-    HTTPClient http;
     Serial.printf("[HTTP] GET %s\n", Config::WEBHOOK_URL);
+    warming_ = false;  // The request takes over a warm-up connect still in progress
+    http_.begin(body_, sizeof(body_), nowMs);
+  }
 
-    if (!http.begin(Config::WEBHOOK_URL)) {
-      Serial.println("[HTTP] Unable to begin connection");
+  DecisionState pollDecision(unsigned long nowMs, PlateText& plateOut) override {
+    if (state_ == DecisionState::Pending) {
+      state_ = Config::UDP_DECISION_ENABLED ? pollUdp(nowMs, plateOut) : pollHttp(nowMs, plateOut);
+    }
+    return state_;
+  }
+
+  // Uses the warm keep-alive connection even in UDP mode, since alerts need
+  // delivery, not just low latency. The server's exact verdict is logged.
+  bool sendAlert(const char* plate) override {
+    char path[64];
+    snprintf(path, sizeof(path), "/denylist/alert?gate=%s&plate=%s", Config::GATE_ID, plate);
+    http_.setPath(path);
+    const int responseCode = http_.get(body_, sizeof(body_), Config::DENYLIST_REQUEST_TIMEOUT_MS);
+    http_.setPath(nullptr);
+    if (responseCode != HTTP_STATUS_OK) {
       return false;
     }
+    Serial.printf("[HTTP] Alert for %s: %s\n", plate, body_);
+    return true;
+  }
 
-    http.setTimeout(Config::HTTP_TIMEOUT_MS);
-    const int responseCode = http.GET();
+private:
+  using HttpStatus = LeanHttpClient<ServerTransport>::Status;
+  using ConnectStatus = LeanHttpClient<ServerTransport>::ConnectStatus;
+
+  static constexpr int HTTP_STATUS_OK = 200;
+
+  LeanHttpClient<ServerTransport> http_;
+  UdpDecisionClient udp_;
+  unsigned long lastWarmUpMs_ = 0;
+  unsigned long warmUpIntervalMs_ = Config::CONNECTION_WARMUP_INTERVAL_MS;
+  bool warming_ = false;
+  uint32_t discoveryGeneration_ = 0;
+  DecisionState state_ = DecisionState::Denied;
+  unsigned long startUs_ = 0;
+
+  // Responses are tiny JSON objects and are read into this buffer.
+  char body_[Config::HTTP_BODY_BUFFER_SIZE];
+
+  DecisionState pollHttp(unsigned long nowMs, PlateText& plateOut) {
+    const HttpStatus status = http_.poll(nowMs, SiteProfile::timeoutMs());
+    if (status == HttpStatus::Pending) {
+      return DecisionState::Pending;
+    }
+    Metrics::set(Metric::HttpRequestUs, micros() - startUs_);
+    Metrics::add(Metric::HttpRequests);
 
-    if (responseCode <= 0) {
-      Serial.printf("[HTTP] Request failed: %s\n",
-                    http.errorToString(responseCode).c_str());
-      http.end();
-      return false;
+    if (status != HttpStatus::Done) {
+      Serial.println("[HTTP] Request failed");
+      Metrics::add(Metric::HttpFailures);
+      return DecisionState::Failed;
     }
 
+    const int responseCode = http_.statusCode();
     Serial.printf("[HTTP] Response code: %d\n", responseCode);
 
     bool gateStatus = false;
 
-    if (responseCode == HTTP_CODE_OK) {
-      const String payload = http.getString();
-      Serial.printf("[HTTP] Payload: %s\n", payload.c_str());
+    if (responseCode == HTTP_STATUS_OK) {
+      Serial.print("[HTTP] Payload: ");
+      Serial.write(reinterpret_cast<const uint8_t*>(body_), http_.bodyLength());
+      Serial.println();
 
       bool parsedStatus = false;
-      if (parseStatusField(payload, parsedStatus)) {
+      if (DecisionJson::parseStatusField(body_, parsedStatus)) {
         gateStatus = parsedStatus;
       } else {
         Serial.println("[HTTP] Unable to parse status field");
       }
 
-      String parsedPlate;
-      if (parsePlateField(payload, parsedPlate)) {
-        plateOut = parsedPlate;
-      }
+      DecisionJson::parsePlateField(body_, plateOut);
     }
 
-    http.end();
-    return gateStatus;
+    return gateStatus ? DecisionState::Accepted : DecisionState::Denied;
   }
 
-private:
-  static bool parseStatusField(const String& payload, bool& status) {
-    const int statusIndex = payload.indexOf("\"status\"");
-    if (statusIndex < 0) {
-      return false;
-    }
-
-    int colonIndex = payload.indexOf(':', statusIndex);
-    if (colonIndex < 0) {
-      return false;
+  DecisionState pollUdp(unsigned long nowMs, PlateText& plateOut) {
+    const UdpDecisionClient::Status status = udp_.poll(nowMs, SiteProfile::timeoutMs());
+    if (status == UdpDecisionClient::Status::Pending) {
+      return DecisionState::Pending;
     }
-
-    colonIndex = skipWhitespace(payload, colonIndex + 1);
-    if (colonIndex < 0) {
-      return false;
-    }
-
-    if (payload.startsWith("true", colonIndex)) {
-      status = true;
-      return true;
+    Metrics::set(Metric::UdpRequestUs, micros() - startUs_);
+    Metrics::add(Metric::UdpRequests);
+    if (udp_.transmissions() > 1) {
+      Metrics::add(Metric::UdpRetransmits, udp_.transmissions() - 1);
     }
 
-    if (payload.startsWith("false", colonIndex)) {
-      status = false;
-      return true;
+    if (status != UdpDecisionClient::Status::Done) {
+      Serial.println("[UDP] Decision request failed");
+      Metrics::add(Metric::UdpFailures);
+      return DecisionState::Failed;
     }
 
-    return false;
+    const UdpDecisionClient::Timings& timings = udp_.timings();
+    // In pieces: a printf line over 64 bytes would allocate
+    Serial.print(udp_.accepted() ? "[UDP] Accept plate=" : "[UDP] Deny plate=");
+    Serial.print(udp_.plate().c_str());
+    Serial.printf(" capture=%u ms detect=%u ms ocr=%u ms\n", timings.captureMs, timings.detectMs, timings.ocrMs);
+    plateOut = udp_.plate();
+    return udp_.accepted() ? DecisionState::Accepted : DecisionState::Denied;
   }
 
-  static int skipWhitespace(const String& text, int index) {
-    while (index < text.length()) {
-      const char ch = text.charAt(index);
-      if (ch != ' ' && ch != '\n' && ch != '\r' && ch != '\t') {
-        return index;
-      }
-      ++index;
+  // Picks up a new server address between vehicles, never during a request.
+  void applyDiscoveredEndpoint() {
+    const uint32_t generation = ServerDiscovery::generation();
+    ServerDiscovery::Endpoint endpoint;
+    if (generation == discoveryGeneration_ || !ServerDiscovery::endpoint(endpoint)) {
+      return;
     }
-    return -1;
+    discoveryGeneration_ = generation;
+    http_.setEndpoint(IPAddress(endpoint.address), endpoint.port);
+    udp_.setAddress(IPAddress(endpoint.address));
+    warming_ = false;  // setEndpoint() dropped the connection being opened
+    warmUpIntervalMs_ = Config::CONNECTION_WARMUP_INTERVAL_MS;
+    lastWarmUpMs_ = 0;  // Reconnect to the new address right away
   }
 
-  static bool parsePlateField(const String& payload, String& plate) {
-    const int plateIndex = payload.indexOf("\"plate\"");
-    if (plateIndex < 0) {
-      return false;
-    }
-
-    int colonIndex = payload.indexOf(':', plateIndex);
-    if (colonIndex < 0) {
-      return false;
-    }
-
-    colonIndex = skipWhitespace(payload, colonIndex + 1);
-    if (colonIndex < 0 || payload.charAt(colonIndex) != '"') {
-      return false;
-    }
-
-    const int endQuoteIndex = payload.indexOf('"', colonIndex + 1);
-    if (endQuoteIndex < 0) {
-      return false;
-    }
-
-    plate = payload.substring(colonIndex + 1, endQuoteIndex);
-    return true;
+  // Retries less often while the server stays unreachable, so a down server
+  // does not cost a lookup and connect attempt every few seconds.
+  void warmUpFailed() {
+    Serial.println("[HTTP] Warm-up connection failed");
+    warmUpIntervalMs_ = warmUpIntervalMs_ * 2 < Config::CONNECTION_WARMUP_MAX_INTERVAL_MS
+                            ? warmUpIntervalMs_ * 2
+                            : Config::CONNECTION_WARMUP_MAX_INTERVAL_MS;
   }
 };
 
@@ -220,6 +317,13 @@ private:
 // OLED DISPLAY MANAGER
 // ═══════════════════════════════════════════════════════════════════════════
 
+// The SSD1306 belongs to a display task on core 0. The show* calls only
+// copy a small command into a queue and wake the task, so the loop never
+// waits for rendering or I2C before it moves the servo or talks to the
+// server. While a plate is being checked, the task animates a spinner and
+// the elapsed time at up to OLED_ANIMATION_FPS, and each frame pushes only
+// the columns that changed on each page.
+
 class DisplayManager {
 public:
   void initialize() {
@@ -227,77 +331,341 @@ public:
       return;
     }
 
-    if (!display_.begin(SSD1306_SWITCHCAPVCC, Config::OLED_I2C_ADDRESS)) {
+    // OledBus owns Wire; the library only sends its init sequence
+    if (!OledBus::begin() || !display_.begin(SSD1306_SWITCHCAPVCC, Config::OLED_I2C_ADDRESS, true, false)) {
       Serial.println("[OLED] Initialization failed");
       return;
     }
 
-    initialized_ = true;
     display_.clearDisplay();
-    display_.display();
     display_.setTextColor(SSD1306_WHITE);
     display_.setTextSize(2);
+    initialized_ = true;
+    xTaskCreatePinnedToCore(taskMain, "display", 4096, this, 1, &task_, 0);
+    Watchdog::watch(WatchedTask::Display, task_);
     showWelcome();
   }
 
   void showWelcome() {
-    showLines("Welcome");
+    post(Screen::Welcome);
   }
 
   void showCarChecking() {
-    showLines("CAR", "", "checking");
+    post(Screen::Checking);
   }
 
-  void showAccept(const String& plate = String()) {
-    showStatusWithPlate("ACCEPT", plate);
+  void showAccept(const char* plate = "") {
+    post(Screen::Accept, plate);
   }
 
-  void showDeny(const String& plate = String()) {
-    showStatusWithPlate("DENY", plate);
+  void showDeny(const char* plate = "") {
+    post(Screen::Deny, plate);
+  }
+
+  // Runs on the display task, which owns the buffer: times building the
+  // plate screen in RAM with each path, then a full push and two animation
+  // frames over I2C.
+  void bench(Print& out) {
+    if (!initialized_) {
+      out.println("[OLED] Not initialized");
+      return;
+    }
+    post(Screen::Bench, "", &out);
   }
 
 private:
-  Adafruit_SSD1306 display_{Config::OLED_WIDTH, Config::OLED_HEIGHT, &Wire, Config::OLED_RESET_PIN};
+  enum class Screen : uint8_t { Welcome, Checking, Accept, Deny, Bench };
+
+  struct Command {
+    Screen screen = Screen::Welcome;
+    uint32_t atMs = 0;
+    PlateText plate;
+    Print* out = nullptr;
+  };
+
+  // Below the size-2 status line
+  static constexpr int16_t PLATE_AREA_TOP = 20;
+  static constexpr int16_t PLATE_AREA_HEIGHT = Config::OLED_HEIGHT - PLATE_AREA_TOP;
+  // Checking screen: elapsed time and spinner below two size-2 lines
+  static constexpr int16_t ELAPSED_TOP = 44;
+  static constexpr uint8_t ELAPSED_SIZE = 4;  // PlateFont::SIZES index, 16 px
+  static constexpr int16_t SPINNER_X = Config::OLED_WIDTH - 11;
+  static constexpr int16_t SPINNER_Y = 52;
+  static constexpr uint32_t SPINNER_STEP_MS = 125;
+  static constexpr uint32_t FRAME_MS = 1000 / Config::OLED_ANIMATION_FPS;
+  static constexpr uint8_t PAGES = Config::OLED_HEIGHT / 8;
+  // Start, address byte and stop, in bus bytes
+  static constexpr size_t TRANSACTION_OVERHEAD = OledBus::HEADER_BYTES + 2;
+
+  Adafruit_SSD1306 display_{Config::OLED_WIDTH, Config::OLED_HEIGHT, &Wire, Config::OLED_RESET_PIN,
+                            Config::OLED_I2C_CLOCK_HZ, Config::OLED_I2C_CLOCK_HZ};
   bool initialized_ = false;
-
-  void showLines(const char* line1, const char* line2 = nullptr, const char* line3 = nullptr) {
+  TaskHandle_t task_ = nullptr;
+  SpscQueue<Command, 8> commands_;
+  // Display task only
+  Command screen_;
+  uint8_t shown_[Config::OLED_WIDTH * PAGES];  // What the panel holds
+  bool fullFrame_ = true;                      // Panel contents unknown
+
+  // Never blocks: when the task is stalled the queue fills and later
+  // screens are dropped instead of holding up the caller.
+  void post(Screen screen, const char* plate = "", Print* out = nullptr) {
     if (!initialized_) {
       return;
     }
+    const uint32_t startUs = micros();
+    Command command;
+    command.screen = screen;
+    command.atMs = millis();
+    command.plate.assign(plate);
+    command.out = out;
+    if (commands_.push(command)) {
+      xTaskNotifyGive(task_);
+    } else {
+      Metrics::add(Metric::DisplayDropped);
+    }
+    const uint32_t postUs = micros() - startUs;
+    if (postUs > Metrics::get(Metric::DisplayPostMaxUs)) {
+      Metrics::set(Metric::DisplayPostMaxUs, postUs);
+    }
+  }
 
-    display_.clearDisplay();
-    display_.setCursor(0, 0);
+  static void taskMain(void* context) {
+    DisplayManager& self = *static_cast<DisplayManager*>(context);
+    for (;;) {
+      // Commands wake the task at once; the animation and retries after a
+      // bus error pace themselves. Idle, it still wakes to feed the watchdog.
+      const bool again = self.screen_.screen == Screen::Checking || self.fullFrame_;
+      Watchdog::mark(WatchedTask::Display, Span::Idle);
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(again ? FRAME_MS : Config::WATCHDOG_TIMEOUT_S * 500));
+      Watchdog::feed();
+
+      // A burst of commands collapses into the last screen
+      Command command;
+      while (self.commands_.pop(command)) {
+        if (command.screen == Screen::Bench) {
+          self.runBench(*command.out);
+        } else {
+          self.screen_ = command;
+        }
+      }
+      Watchdog::mark(WatchedTask::Display, Span::OledRender);
+      self.render(self.screen_);
+      Watchdog::mark(WatchedTask::Display, Span::OledFlush);
+      self.pushChanged();
+    }
+  }
 
-    if (line1 != nullptr) {
-      display_.println(line1);
+  void render(const Command& command) {
+    switch (command.screen) {
+      case Screen::Welcome:
+        drawLines("Welcome");
+        break;
+      case Screen::Checking:
+        drawChecking(millis() - command.atMs);
+        break;
+      case Screen::Accept:
+        drawStatusWithPlate("ACCEPT", command.plate.c_str());
+        break;
+      case Screen::Deny:
+        drawStatusWithPlate("DENY", command.plate.c_str());
+        break;
+      case Screen::Bench:
+        break;
     }
+  }
 
+  void drawLines(const char* line1, const char* line2 = nullptr) {
+    display_.clearDisplay();
+    display_.setCursor(0, 0);
+    display_.println(line1);
     if (line2 != nullptr) {
       display_.println(line2);
     }
+  }
 
-    if (line3 != nullptr) {
-      display_.println(line3);
+  // Everything is redrawn each frame; pushChanged() finds what moved.
+  // The spinner position follows the clock, not the frame count, so a
+  // late frame skips ahead instead of slowing down.
+  void drawChecking(uint32_t elapsedMs) {
+    static constexpr int8_t DOTS[8][2] = {{0, -8}, {6, -6}, {8, 0}, {6, 6}, {0, 8}, {-6, 6}, {-8, 0}, {-6, -6}};
+
+    drawLines("CAR", "checking");
+
+    char elapsed[16];
+    snprintf(elapsed, sizeof(elapsed), "%u ms", static_cast<unsigned>(elapsedMs));
+    PlateRenderer::draw(display_.getBuffer(), Config::OLED_WIDTH, Config::OLED_HEIGHT, 0, ELAPSED_TOP, elapsed,
+                        PlateFont::SIZES[ELAPSED_SIZE]);
+
+    const uint32_t head = (elapsedMs / SPINNER_STEP_MS) % 8;
+    for (uint32_t i = 0; i < 8; ++i) {
+      const int16_t x = SPINNER_X + DOTS[i][0];
+      const int16_t y = SPINNER_Y + DOTS[i][1];
+      if (i == head) {
+        display_.fillCircle(x, y, 2, SSD1306_WHITE);
+      } else if (i == (head + 7) % 8) {
+        display_.fillCircle(x, y, 1, SSD1306_WHITE);
+      } else {
+        display_.drawPixel(x, y, SSD1306_WHITE);
+      }
     }
-
-    display_.display();
   }
 
-  void showStatusWithPlate(const char* status, const String& plate) {
-    if (!initialized_) {
-      return;
+  // The plate gets the largest PlateFont size that fits one line below the
+  // status, centred in that area.
+  void drawStatusWithPlate(const char* status, const char* plate) {
+    display_.clearDisplay();
+    display_.setCursor(0, 0);
+    display_.println(status);
+
+    if (plate[0] != '\0') {
+      const PlateFont::Size& size = PlateRenderer::fit(plate, Config::OLED_WIDTH, PLATE_AREA_HEIGHT);
+      const int16_t x = (Config::OLED_WIDTH - static_cast<int16_t>(PlateRenderer::textWidth(plate, size))) / 2;
+      const int16_t y = PLATE_AREA_TOP + (PLATE_AREA_HEIGHT - size.height) / 2;
+      PlateRenderer::draw(display_.getBuffer(), Config::OLED_WIDTH, Config::OLED_HEIGHT, x < 0 ? 0 : x, y, plate,
+                          size);
     }
+  }
 
+  // The previous plate path: the 5x7 GFX font at size 2, wrapping
+  void drawStatusWithPlateGfx(const char* status, const char* plate) {
     display_.clearDisplay();
     display_.setCursor(0, 0);
     display_.println(status);
     display_.println();
+    display_.println(plate);
+  }
+
+  // Sends what differs from the panel: each changed page's span between
+  // its first and last changed column, or one region covering all of them
+  // when that costs fewer bus bytes than a transaction per page. Returns
+  // the data bytes sent.
+  size_t pushChanged() {
+    const uint8_t* buffer = display_.getBuffer();
+    uint8_t firsts[PAGES];
+    uint8_t lasts[PAGES];
+    uint8_t firstPage = PAGES;
+    uint8_t lastPage = 0;
+    uint8_t left = Config::OLED_WIDTH - 1;
+    uint8_t right = 0;
+    size_t separate = 0;
+    for (uint8_t page = 0; page < PAGES; ++page) {
+      const uint8_t* row = buffer + page * Config::OLED_WIDTH;
+      const uint8_t* shownRow = shown_ + page * Config::OLED_WIDTH;
+      int16_t first = 0;
+      int16_t last = Config::OLED_WIDTH - 1;
+      if (!fullFrame_) {
+        while (first < Config::OLED_WIDTH && row[first] == shownRow[first]) {
+          ++first;
+        }
+        if (first == Config::OLED_WIDTH) {
+          firsts[page] = 1;
+          lasts[page] = 0;  // Unchanged
+          continue;
+        }
+        while (row[last] == shownRow[last]) {
+          --last;
+        }
+      }
+      firsts[page] = first;
+      lasts[page] = last;
+      firstPage = page < firstPage ? page : firstPage;
+      lastPage = page;
+      left = first < left ? first : left;
+      right = last > right ? last : right;
+      separate += last - first + 1 + TRANSACTION_OVERHEAD;
+    }
+    if (firstPage == PAGES) {
+      return 0;
+    }
+
+    const uint32_t startUs = micros();
+    const size_t merged = (lastPage - firstPage + 1) * (right - left + 1);
+    size_t sent = 0;
+    bool ok = true;
+    if (merged + TRANSACTION_OVERHEAD <= separate) {
+      ok = OledBus::writeRegion(firstPage, lastPage, left, right, buffer);
+      sent = merged;
+    } else {
+      for (uint8_t page = firstPage; ok && page <= lastPage; ++page) {
+        if (firsts[page] <= lasts[page]) {
+          ok = OledBus::writeRegion(page, page, firsts[page], lasts[page], buffer);
+          sent += lasts[page] - firsts[page] + 1;
+        }
+      }
+    }
+    if (!ok) {
+      // The panel may hold part of a write; resend everything next frame
+      fullFrame_ = true;
+      return 0;
+    }
+
+    memcpy(shown_, buffer, sizeof(shown_));
+    fullFrame_ = false;
+    Metrics::set(Metric::DisplayFlushUs, micros() - startUs);
+    Metrics::add(Metric::DisplayFrames);
+    Metrics::add(Metric::DisplayBytes, sent);
+    return sent;
+  }
 
-    if (plate.length() > 0) {
-      display_.println(plate);
+  // Leaves the panel showing the current screen again
+  void runBench(Print& out) {
+    static constexpr const char* PLATES[] = {"51A12345", "59X1-23456", "29LD-345.67"};
+    static constexpr uint32_t RENDERS = 200;
+    for (const char* plate : PLATES) {
+      uint32_t startUs = micros();
+      for (uint32_t i = 0; i < RENDERS; ++i) {
+        drawStatusWithPlateGfx("ACCEPT", plate);
+      }
+      const uint32_t gfxUs = micros() - startUs;
+      startUs = micros();
+      for (uint32_t i = 0; i < RENDERS; ++i) {
+        drawStatusWithPlate("ACCEPT", plate);
+      }
+      const uint32_t fontUs = micros() - startUs;
+      out.printf("[OLED] %-12s gfx=%u us plate font=%u us (%upx)\n", plate, static_cast<unsigned>(gfxUs / RENDERS),
+                 static_cast<unsigned>(fontUs / RENDERS),
+                 static_cast<unsigned>(PlateRenderer::fit(plate, Config::OLED_WIDTH, PLATE_AREA_HEIGHT).height));
     }
 
-    display_.display();
+    // Fast mode and fast-mode plus; a failure here shows as an I2C error
+    // and a bus clear, after which the configured clock is restored
+    static constexpr uint32_t CLOCKS[] = {400000, 1000000};
+    for (uint32_t hz : CLOCKS) {
+      OledBus::setClock(hz);
+      fullFrame_ = true;
+      const size_t bytes = pushChanged();
+      out.printf("[OLED] full frame at %u kHz: %u us (%u bytes)\n", static_cast<unsigned>(hz / 1000),
+                 static_cast<unsigned>(Metrics::get(Metric::DisplayFlushUs)), static_cast<unsigned>(bytes));
+    }
+    OledBus::setClock(Config::OLED_I2C_CLOCK_HZ);
+
+    drawChecking(1234);
+    pushChanged();
+    drawChecking(1234 + FRAME_MS);
+    const size_t bytes = pushChanged();
+    out.printf("[OLED] checking frame: %u us (%u bytes), %u fps cap\n",
+               static_cast<unsigned>(Metrics::get(Metric::DisplayFlushUs)), static_cast<unsigned>(bytes),
+               static_cast<unsigned>(Config::OLED_ANIMATION_FPS));
+    out.printf("[OLED] slowest post from the loop=%u us\n",
+               static_cast<unsigned>(Metrics::get(Metric::DisplayPostMaxUs)));
+
+    render(screen_);
+    pushChanged();
+  }
+};
+
+// Headless units: every screen is dropped
+class NullDisplay {
+public:
+  void initialize() {}
+  void showWelcome() {}
+  void showCarChecking() {}
+  void showAccept(const char* = "") {}
+  void showDeny(const char* = "") {}
+
+  void bench(Print& out) {
+    out.println("[OLED] Not fitted in this variant");
   }
 };
 
@@ -311,8 +679,17 @@ public:
     servo_.attach(Config::SERVO_CONTROL_PIN, 
                   Config::SERVO_MIN_PULSE_US, 
                   Config::SERVO_MAX_PULSE_US);
-    close();
-    delay(500);
+    moveToSafeState();
+    delay(Config::SERVO_TRAVEL_MS);
+  }
+
+  // Where the barrier rests after a boot, including a watchdog reset
+  void moveToSafeState() {
+    if (Config::GATE_SAFE_STATE == Config::GateSafeState::Open) {
+      open();
+    } else {
+      close();
+    }
   }
 
   void open() {
@@ -323,94 +700,379 @@ public:
     moveTo(Config::SERVO_CLOSED_ANGLE);
   }
 
+  // The hobby servo reports no position, so the last move is taken to be
+  // complete once a full swing's time has passed.
+  bool settled(unsigned long nowMs) const {
+    return (nowMs - movedMs_) >= Config::SERVO_TRAVEL_MS;
+  }
+
 private:
   Servo servo_;
+  unsigned long movedMs_ = 0;
 
   void moveTo(int angle) {
     servo_.write(angle);
+    movedMs_ = millis();
     Serial.printf("[Servo] Moving to %d degrees\n", angle);
+#ifdef GATEKEEPER_QEMU
+    QemuHarness::captureOutput("pwm", Config::SERVO_CONTROL_PIN,
+                               Config::SERVO_MIN_PULSE_US +
+                                   angle * (Config::SERVO_MAX_PULSE_US - Config::SERVO_MIN_PULSE_US) / 180);
+#endif
   }
 };
 
 // ═══════════════════════════════════════════════════════════════════════════
-// SENSOR READER WITH DEBOUNCING
+// RELAY ACTUATOR
 // ═══════════════════════════════════════════════════════════════════════════
 
-class DebouncedSensor {
+// For barriers with their own controller: the relay holds the controller's
+// open input for as long as the gate should be open. The controller runs
+// the motor, so a move is done once the contacts have settled.
+class RelayActuator {
 public:
-  void initialize(int pin) {
-    pin_ = pin;
-    pinMode(pin_, INPUT);
-    
-    // Initialize debounced state
-    int initialValue = digitalRead(pin_);
-    rawValue_ = initialValue;
-    stableValue_ = initialValue;
-    lastBounceTime_ = millis();
+  void initialize() {
+    // Level first, so an active-low relay does not pull in at boot
+    moveToSafeState();
+    pinMode(Config::RELAY_PIN, OUTPUT);
   }
 
-  bool hasChanged() {
-    updateRawValue();
-    
-    if (isDebounceDelayElapsed() && hasStableValueChanged()) {
-      stableValue_ = rawValue_;
-      Serial.printf("[Sensor] LM393 state changed: %d\n", stableValue_);
+  void moveToSafeState() {
+    if (Config::GATE_SAFE_STATE == Config::GateSafeState::Open) {
+      open();
+    } else {
+      close();
+    }
+  }
+
+  void open() {
+    drive(true);
+  }
+
+  void close() {
+    drive(false);
+  }
+
+  bool settled(unsigned long nowMs) const {
+    return (nowMs - switchedMs_) >= Config::RELAY_SETTLE_MS;
+  }
+
+private:
+  unsigned long switchedMs_ = 0;
+
+  void drive(bool energized) {
+    digitalWrite(Config::RELAY_PIN, energized == Config::RELAY_ACTIVE_HIGH ? HIGH : LOW);
+    switchedMs_ = millis();
+    Serial.printf("[Relay] %s\n", energized ? "Open" : "Closed");
+#ifdef GATEKEEPER_QEMU
+    QemuHarness::captureOutput("gpio", Config::RELAY_PIN, energized == Config::RELAY_ACTIVE_HIGH ? 1 : 0);
+#endif
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SITE POLICIES
+// ═══════════════════════════════════════════════════════════════════════════
+// GateKeeperApp takes one type per subsystem. The choices for a slot share
+// member functions but no base class, so every call is direct, and code
+// for a subsystem that a variant leaves out is never instantiated.
+//
+//   Presence   initialize, update(nowMs), isPresent, printVote(out)
+//   Actuator   initialize, open, close, settled(nowMs)
+//   Display    initialize, showWelcome, showCarChecking, showAccept(plate),
+//              showDeny(plate), bench(out)
+//   Transport  a DecisionTransport; marked final so calls devirtualize
+//   Decisions  initialize, maintain(nowMs), permits(plate),
+//              afterMove(plate, transport), invalidate,
+//              registerConsoleCommands
+
+// The presence sources enabled in Config, fused by k-of-n voting
+class FusedPresence {
+public:
+  void initialize() {
+    fusion_.addSource(lm393_);
+    if (Config::ULTRASONIC_ENABLED) {
+      fusion_.addSource(ultrasonic_);
+    }
+    if (Config::LOOP_DETECTOR_ENABLED) {
+      fusion_.addSource(loopDetector_);
+    }
+    if (Config::CAMERA_MOTION_ENABLED) {
+      fusion_.addSource(cameraMotion_);
+    }
+    fusion_.initialize();
+  }
+
+  bool update(unsigned long nowMs) {
+    return fusion_.update(nowMs);
+  }
+
+  bool isPresent() const {
+    return fusion_.isPresent();
+  }
+
+  void printVote(Print& out) const {
+    out.print("[Presence] Vehicle detected by:");
+    for (size_t i = 0; i < fusion_.sourceCount(); ++i) {
+      const PresenceSource& source = fusion_.source(i);
+      if (source.isPresent()) {
+        out.printf(" %s(%u)", source.name(), source.confidence());
+      }
+    }
+    out.println();
+  }
+
+private:
+  Lm393Source lm393_;
+  UltrasonicSource ultrasonic_;
+  LoopDetectorSource loopDetector_;
+  CameraMotionSource cameraMotion_;
+  PresenceFusion<4> fusion_{Config::FUSION_MIN_VOTES, Config::FUSION_MIN_CONFIDENCE, Config::FUSION_ALIGN_WINDOW_MS};
+};
+
+// One source on its own, without voting
+template <typename Source>
+class SinglePresence {
+public:
+  void initialize() {
+    source_.initialize();
+    present_ = source_.isPresent();
+  }
+
+  bool update(unsigned long nowMs) {
+    source_.update(nowMs);
+    if (source_.isPresent() == present_) {
+      return false;
+    }
+    present_ = !present_;
+    return true;
+  }
+
+  bool isPresent() const {
+    return present_;
+  }
+
+  void printVote(Print& out) const {
+    out.printf("[Presence] Vehicle detected by: %s\n", source_.name());
+  }
+
+private:
+  Source source_;
+  bool present_ = false;
+};
+
+// Server accepts checked against the flash allowlist and access schedules;
+// denylist alerts once the gate has moved.
+class ListedDecisions {
+public:
+  void initialize() {
+    FlashAllowlist::begin();
+    AccessSchedule::begin();
+    Denylist::begin();
+    denylistSync_.configure(Config::WEBHOOK_URL);
+    configureServerTransport(denylistSync_.transport(), denylistSync_.host());
+  }
+
+  // Between vehicles only
+  void maintain(unsigned long nowMs) {
+    denylistSync_.maintain(nowMs);
+  }
+
+  // With ALLOWLIST_ENFORCED, a server accept still needs the plate in the
+  // local image; with SCHEDULE_ENFORCED, a plate with a schedule profile
+  // also needs to be inside its time windows. Without a mapped image the
+  // server decides alone.
+  bool permits(const PlateText& plate) {
+    if (!FlashAllowlist::ready()) {
       return true;
     }
-    
-    return false;
+    uint8_t profile = 0;
+    if (!FlashAllowlist::lookup(plate.c_str(), profile) && Config::ALLOWLIST_ENFORCED) {
+      Serial.printf("[Allowlist] %s not listed, denying\n", plate.c_str());
+      Metrics::add(Metric::AllowlistRejects);
+      return false;
+    }
+    if (Config::SCHEDULE_ENFORCED && !AccessSchedule::permits(profile)) {
+      Serial.printf("[Schedule] %s outside profile %u windows, denying\n", plate.c_str(),
+                    static_cast<unsigned>(profile));
+      Metrics::add(Metric::ScheduleRejects);
+      return false;
+    }
+    return true;
   }
 
-  int getStableValue() const {
-    return stableValue_;
+  // Runs after the gate has moved, so the vehicle path is not slowed. The
+  // display and gate stay as they are: a filter hit may be a false
+  // positive, and a real one should not tip off the driver.
+  template <typename Transport>
+  void afterMove(const PlateText& plate, Transport& transport) {
+    if (plate.empty() || !Denylist::mightContain(plate.c_str())) {
+      return;
+    }
+    Metrics::add(Metric::DenylistHits);
+    Serial.printf("[Denylist] Probable hit %s, alerting over %s\n", plate.c_str(), transport.name());
+    if (!transport.sendAlert(plate.c_str())) {
+      Serial.println("[Denylist] Alert failed");
+      Metrics::add(Metric::DenylistAlertsFailed);
+    }
+  }
+
+  void invalidate() {
+    FlashAllowlist::reload();
+  }
+
+  void registerConsoleCommands() {
+    SerialConsole::addCommand("allow", "<plate> | bench | reload", onAllowlistCommand, this);
+    SerialConsole::addCommand("deny", "<plate> | stats | bench | sync", onDenylistCommand, this);
+    SerialConsole::addCommand("sched", "[plate]", onScheduleCommand, nullptr);
   }
 
 private:
-  int pin_;
-  int rawValue_ = -1;
-  int stableValue_ = -1;
-  unsigned long lastBounceTime_ = 0;
+  DenylistSync<ServerTransport> denylistSync_;
+
+  static void onAllowlistCommand(void*, const char* args, Print& out) {
+    if (strcmp(args, "bench") == 0) {
+      FlashAllowlist::bench(out);
+    } else if (strcmp(args, "reload") == 0) {
+      FlashAllowlist::reload();
+      out.printf("[Allowlist] %u plates\n", static_cast<unsigned>(FlashAllowlist::count()));
+    } else if (args[0] != '\0') {
+      out.printf("[Allowlist] %s: %s\n", args, FlashAllowlist::contains(args) ? "listed" : "not listed");
+    } else {
+      out.println("[Allowlist] Usage: allow <plate> | bench | reload");
+    }
+  }
 
-  void updateRawValue() {
-    const int currentRaw = digitalRead(pin_);
-    
-    if (currentRaw != rawValue_) {
-      rawValue_ = currentRaw;
-      lastBounceTime_ = millis();
+  static void onDenylistCommand(void* context, const char* args, Print& out) {
+    if (strcmp(args, "stats") == 0) {
+      Denylist::printStats(out);
+    } else if (strcmp(args, "bench") == 0) {
+      Denylist::bench(out);
+    } else if (strcmp(args, "sync") == 0) {
+      static_cast<ListedDecisions*>(context)->denylistSync_.requestSync();
+      out.println("[Denylist] Sync requested");
+    } else if (args[0] != '\0') {
+      out.printf("[Denylist] %s: %s\n", args, Denylist::mightContain(args) ? "probably listed" : "not listed");
+    } else {
+      out.println("[Denylist] Usage: deny <plate> | stats | bench | sync");
     }
   }
 
-  bool isDebounceDelayElapsed() const {
-    return (millis() - lastBounceTime_) >= Config::DEBOUNCE_DELAY_MS;
+  static void onScheduleCommand(void*, const char* args, Print& out) {
+    AccessSchedule::printStatus(out);
+    if (args[0] == '\0') {
+      return;
+    }
+    uint8_t profile = 0;
+    if (!FlashAllowlist::lookup(args, profile)) {
+      out.printf("[Schedule] %s: not listed\n", args);
+      return;
+    }
+    out.printf("[Schedule] %s: profile %u, %s now\n", args, static_cast<unsigned>(profile),
+               AccessSchedule::permits(profile) ? "permitted" : "outside its windows");
   }
+};
 
-  bool hasStableValueChanged() const {
-    return rawValue_ != stableValue_;
+// The server's verdict alone. The allowlist, schedule and denylist
+// partitions are never mapped and the denylist is never synced.
+class ServerDecisions {
+public:
+  void initialize() {}
+
+  void maintain(unsigned long) {}
+
+  bool permits(const PlateText&) {
+    return true;
   }
+
+  template <typename Transport>
+  void afterMove(const PlateText&, Transport&) {}
+
+  void invalidate() {}
+
+  void registerConsoleCommands() {}
 };
 
+using ConfiguredTransport = std::conditional_t<Config::DECISION_TRANSPORT == Config::DecisionTransportKind::Mqtt,
+                                               MqttDecisionTransport, WebhookClient>;
+
 // ═══════════════════════════════════════════════════════════════════════════
 // MAIN APPLICATION
 // ═══════════════════════════════════════════════════════════════════════════
 
+template <typename Presence, typename Actuator, typename Display, typename Transport, typename Decisions>
 class GateKeeperApp {
+  static_assert(std::is_base_of_v<DecisionTransport, Transport>, "Transport must implement DecisionTransport");
+
 public:
+  explicit GateKeeperApp(const char* variant) : variant_(variant) {}
+
   void setup() {
     initializeSerial();
+    // Before anything that can block, so a stall reset ends in the safe state
+    actuator_.initialize();
+    Watchdog::begin();
+    Watchdog::watch(WatchedTask::Loop, xTaskGetCurrentTaskHandle());
+    Watchdog::mark(WatchedTask::Loop, Span::Setup);
+#ifdef GATEKEEPER_QEMU
+    QemuHarness::begin();
+#endif
+#ifdef GATEKEEPER_GPIO_BENCH
+    runGpioBenchmark<Config::LM393_SENSOR_PIN>();
+#endif
     initializeHardware();
+    registerConsoleCommands();
     WiFiManager::connect();
+    transport_.warmUp();
+    HeapMonitor::sample();
+    bootMs_ = millis();
+    Metrics::set(Metric::BootMs, bootMs_);
+    printVariant(Serial);
+    HeapTripwire::arm();
   }
 
   void loop() {
+    Watchdog::feed();
+    Watchdog::mark(WatchedTask::Loop, Span::WiFi);
     ensureWiFiConnected();
+    Watchdog::mark(WatchedTask::Loop, Span::Presence);
     processSensorInput();
+    Watchdog::mark(WatchedTask::Loop, Span::Transport);
+    transport_.maintain(millis());
+    if (!presence_.isPresent()) {
+      Watchdog::mark(WatchedTask::Loop, Span::DenylistSync);
+      decisions_.maintain(millis());
+    }
+    Watchdog::mark(WatchedTask::Loop, Span::Remote);
+    handleRemoteCommands();
+    Watchdog::mark(WatchedTask::Loop, Span::Console);
+    SerialConsole::poll(Serial);
+    Watchdog::mark(WatchedTask::Loop, Span::Metrics);
+    reportMetrics();
+    Watchdog::mark(WatchedTask::Loop, Span::Trace);
+    FieldTrace::flush(millis());
+    Watchdog::mark(WatchedTask::Loop, Span::Idle);
     delay(Config::LOOP_DELAY_MS);
   }
 
 private:
-  DebouncedSensor sensor_;
-  ServoController servo_;
-  DisplayManager display_;
+  Presence presence_;
+  Actuator actuator_;
+  Display display_;
+  Transport transport_;
+  Decisions decisions_;
+  const char* variant_;
+  unsigned long bootMs_ = 0;
+  unsigned long lastMetricsReportMs_ = 0;
+  // Recognition flow
+  Protothread flow_;
+  PlateText plate_;
+  DecisionState decision_ = DecisionState::Pending;
+  uint8_t retries_ = 0;
+  bool accepted_ = false;
+  // Close deferred by the site's hold-open window
+  bool closePending_ = false;
+  unsigned long departedMs_ = 0;
 
   void initializeSerial() {
     Serial.begin(Config::SERIAL_BAUD_RATE);
@@ -418,51 +1080,257 @@ private:
   }
 
   void initializeHardware() {
+    SiteProfile::begin();
+    if (Config::TRACE_ENABLED) {
+      FieldTrace::begin();
+    }
+    transport_.initialize();
+    Serial.printf("[Decision] Using %s transport\n", transport_.name());
+    decisions_.initialize();
     display_.initialize();
-    sensor_.initialize(Config::LM393_SENSOR_PIN);
-    servo_.initialize();
+    presence_.initialize();
+  }
+
+  void registerConsoleCommands() {
+    SerialConsole::addCommand("metrics", "print the metrics table", onMetricsCommand, this);
+    SerialConsole::addCommand("tasks", "print task priority, core and stack headroom", onTasksCommand, this);
+    SerialConsole::addCommand("prof", "start [hz] | stop | dump", onProfilerCommand, this);
+    decisions_.registerConsoleCommands();
+    SerialConsole::addCommand("oled", "bench | <plate>", onDisplayCommand, this);
+    SerialConsole::addCommand("wdt", "last stall report", onWatchdogCommand, nullptr);
+    SerialConsole::addCommand("variant", "site variant, image size, RAM and boot time", onVariantCommand, this);
+    SerialConsole::addCommand("profile", "[clear | key=value ...] site timings", SiteProfile::onCommand, nullptr);
+    if (Config::TRACE_ENABLED) {
+      SerialConsole::addCommand("trace", "start | stop | status field trace", onTraceCommand, nullptr);
+    }
+#ifdef GATEKEEPER_HTTP_BENCH
+    SerialConsole::addCommand("bench", "[n] HTTPClient vs LeanHttpClient", HttpBenchmark::onCommand, nullptr);
+    SerialConsole::addCommand("tls", "[n] full vs resumed TLS handshakes", HttpBenchmark::onTlsCommand, nullptr);
+    SerialConsole::addCommand("udp", "[n] HTTP keep-alive vs UDP decisions", HttpBenchmark::onUdpCommand, nullptr);
+    SerialConsole::addCommand("mqtt", "[n] HTTP keep-alive vs MQTT decisions", HttpBenchmark::onMqttCommand, nullptr);
+#endif
+  }
+
+  static void onMetricsCommand(void*, const char*, Print& out) {
+    HeapMonitor::sample();
+    Metrics::printTo(out);
+  }
+
+  static void onTasksCommand(void*, const char*, Print& out) {
+    TaskStats::collect(out);
+  }
+
+  static void onProfilerCommand(void*, const char* args, Print& out) {
+    if (strncmp(args, "start", 5) == 0) {
+      const uint32_t hz = args[5] == ' ' ? strtoul(args + 6, nullptr, 10) : Config::PROFILER_DEFAULT_HZ;
+      out.println(SamplingProfiler::start(hz) ? "[Prof] Sampling" : "[Prof] Already running or bad rate");
+    } else if (strcmp(args, "stop") == 0) {
+      SamplingProfiler::stop();
+      out.println("[Prof] Stopped");
+    } else if (strcmp(args, "dump") == 0) {
+      SamplingProfiler::dump(out);
+    } else {
+      out.println("[Prof] Usage: prof start [hz] | stop | dump");
+    }
+  }
+
+  static void onDisplayCommand(void* context, const char* args, Print& out) {
+    Display& display = static_cast<GateKeeperApp*>(context)->display_;
+    if (strcmp(args, "bench") == 0) {
+      display.bench(out);
+    } else if (args[0] != '\0') {
+      display.showAccept(args);
+    } else {
+      out.println("[OLED] Usage: oled bench | <plate>");
+    }
+  }
+
+  static void onWatchdogCommand(void*, const char*, Print& out) {
+    Watchdog::printReport(out);
+  }
+
+  static void onVariantCommand(void* context, const char*, Print& out) {
+    static_cast<GateKeeperApp*>(context)->printVariant(out);
+  }
+
+  static void onTraceCommand(void*, const char* args, Print& out) {
+    if (strcmp(args, "start") == 0) {
+      out.println(FieldTrace::start(out) ? "[Trace] Recording" : "[Trace] Already recording or no partition");
+    } else if (strcmp(args, "stop") == 0) {
+      FieldTrace::stop();
+      FieldTrace::printStatus(out);
+    } else if (strcmp(args, "status") == 0 || args[0] == '\0') {
+      FieldTrace::printStatus(out);
+    } else {
+      out.println("[Trace] Usage: trace start | stop | status");
+    }
+  }
+
+  // Flash is the whole app image. The app object holds every subsystem's
+  // state; the heap is what static data left over. Boot runs to the end
+  // of setup(), Wi-Fi connect and transport warm-up included.
+  void printVariant(Print& out) {
+    out.printf("[Variant] %s: image %u bytes, app %u bytes, heap %u bytes, boot %lu ms\n", variant_,
+               static_cast<unsigned>(ESP.getSketchSize()), static_cast<unsigned>(sizeof(*this)),
+               static_cast<unsigned>(ESP.getHeapSize()), bootMs_);
   }
 
   void ensureWiFiConnected() {
     if (!WiFiManager::isConnected()) {
       WiFiManager::connect();
+      transport_.warmUp();
+    }
+  }
+
+  void handleRemoteCommands() {
+    RemoteCommand command;
+    while (transport_.nextCommand(command)) {
+      switch (command) {
+        case RemoteCommand::OpenGate:
+          Serial.println("[Decision] Remote open");
+          display_.showAccept("REMOTE");
+          updateGatePosition(1);
+          break;
+        case RemoteCommand::CloseGate:
+          Serial.println("[Decision] Remote close");
+          display_.showWelcome();
+          updateGatePosition(0);
+          break;
+        case RemoteCommand::InvalidateAllowlist:
+          Serial.println("[Decision] Allowlist invalidated by server");
+          decisions_.invalidate();
+          break;
+      }
     }
   }
 
+  // Presence is not re-read while a vehicle is being handled, so a
+  // departure during the flow is acted on once it has finished. With a
+  // hold-open window the gate closes that long after the departure, unless
+  // another vehicle arrives first.
   void processSensorInput() {
-    if (sensor_.hasChanged()) {
-      const int sensorValue = sensor_.getStableValue();
-      if (sensorValue == 0) {
-        display_.showCarChecking();
-        String plate;
-        const bool shouldOpen = WebhookClient::shouldOpenGate(plate);
-        if (shouldOpen) {
-          display_.showAccept(plate);
-        } else {
-          display_.showDeny(plate);
-        }
-        updateServoPosition(shouldOpen ? 1 : 0);
-      } else {
-        display_.showWelcome();
-        updateServoPosition(0);
+    if (flow_.running()) {
+      recognitionFlow();
+      return;
+    }
+    const unsigned long nowMs = millis();
+    if (presence_.update(nowMs)) {
+      FieldTrace::record(TraceKind::Presence, 0, presence_.isPresent() ? 1 : 0);
+      closePending_ = !presence_.isPresent();
+      departedMs_ = nowMs;
+      if (presence_.isPresent()) {
+        recognitionFlow();
+        return;
       }
     }
+    if (closePending_ && (nowMs - departedMs_) >= SiteProfile::holdOpenMs()) {
+      closePending_ = false;
+      display_.showWelcome();
+      updateGatePosition(0);
+    }
+  }
+
+  // One vehicle, from detection to the denylist alert. Resumed by every
+  // loop pass until Done, so Wi-Fi, remote commands and the console keep
+  // running while the server works. State that outlives a wait lives in
+  // the members below (see Protothread.h).
+  PtState recognitionFlow() {
+    PT_BEGIN(flow_);
+    presence_.printVote(Serial);
+    display_.showCarChecking();
+    plate_.clear();
+    retries_ = 0;
+    transport_.startDecision(millis());
+    FieldTrace::record(TraceKind::Request, 0, 0);
+    PT_AWAIT(flow_, decisionReady());
+
+    accepted_ = decision_ == DecisionState::Accepted && decisions_.permits(plate_);
+    if (accepted_) {
+      display_.showAccept(plate_.c_str());
+    } else {
+      display_.showDeny(plate_.c_str());
+    }
+    Watchdog::mark(WatchedTask::Loop, Span::Servo);
+    updateGatePosition(accepted_ ? 1 : 0);
+    PT_AWAIT(flow_, actuator_.settled(millis()));
+
+    Watchdog::mark(WatchedTask::Loop, Span::DenylistAlert);
+    decisions_.afterMove(plate_, transport_);
+    PT_END(flow_);
+  }
+
+  bool decisionReady() {
+    Watchdog::mark(WatchedTask::Loop, Span::Decision);
+    decision_ = transport_.pollDecision(millis(), plate_);
+    if (decision_ == DecisionState::Pending) {
+      return false;
+    }
+    FieldTrace::record(TraceKind::Decision, 0, static_cast<uint16_t>(decision_));
+    if (decision_ == DecisionState::Failed && retries_ < SiteProfile::retries()) {
+      ++retries_;
+      Serial.printf("[Decision] No answer, retry %u of %u\n", static_cast<unsigned>(retries_),
+                    static_cast<unsigned>(SiteProfile::retries()));
+      Metrics::add(Metric::DecisionRetries);
+      transport_.startDecision(millis());
+      FieldTrace::record(TraceKind::Request, 0, 0);
+      return false;
+    }
+    return true;
+  }
+
+  void reportMetrics() {
+    HeapTripwire::report(Serial);
+
+    const unsigned long nowMs = millis();
+    if ((nowMs - lastMetricsReportMs_) < Config::METRICS_REPORT_INTERVAL_MS) {
+      return;
+    }
+    lastMetricsReportMs_ = nowMs;
+    HeapMonitor::sample();
+    TaskStats::collect(Serial);
+    Metrics::printTo(Serial);
   }
 
-  void updateServoPosition(int sensorValue) {
+  void updateGatePosition(int sensorValue) {
+    FieldTrace::record(TraceKind::Gate, 0, sensorValue == 1 ? 1 : 0);
     if (sensorValue == 1) {
-      servo_.open();
+      actuator_.open();
     } else {
-      servo_.close();
+      actuator_.close();
     }
   }
 };
 
+// ═══════════════════════════════════════════════════════════════════════════
+// SITE VARIANTS
+// ═══════════════════════════════════════════════════════════════════════════
+// One per build env in platformio.ini. Compare them with `variant` on a
+// bench unit; the image size is also in the PlatformIO build summary.
+
+#if defined(GATEKEEPER_VARIANT_HEADLESS)
+// No OLED, the LM393 alone
+using GateKeeper = GateKeeperApp<SinglePresence<Lm393Source>, ServoController, NullDisplay, ConfiguredTransport,
+                                 ListedDecisions>;
+constexpr char VARIANT_NAME[] = "headless";
+#elif defined(GATEKEEPER_VARIANT_RELAY)
+// A barrier controller on a relay instead of the servo, no OLED
+using GateKeeper = GateKeeperApp<FusedPresence, RelayActuator, NullDisplay, ConfiguredTransport, ListedDecisions>;
+constexpr char VARIANT_NAME[] = "relay";
+#elif defined(GATEKEEPER_VARIANT_CAMERA)
+// The camera's motion output triggers recognition; the server keeps the lists
+using GateKeeper = GateKeeperApp<SinglePresence<CameraMotionSource>, ServoController, DisplayManager,
+                                 ConfiguredTransport, ServerDecisions>;
+constexpr char VARIANT_NAME[] = "camera";
+#else
+using GateKeeper = GateKeeperApp<FusedPresence, ServoController, DisplayManager, ConfiguredTransport, ListedDecisions>;
+constexpr char VARIANT_NAME[] = "lane";
+#endif
+
 // ═══════════════════════════════════════════════════════════════════════════
 // ARDUINO ENTRY POINTS
 // ═══════════════════════════════════════════════════════════════════════════
 
-GateKeeperApp app;
+GateKeeper app(VARIANT_NAME);
 
 void setup() {
   app.setup();
@@ -472,6 +1340,11 @@ void loop() {
   app.loop();
 }
 
+// Called by ESP-IDF from the task watchdog interrupt, before the panic
+extern "C" void esp_task_wdt_isr_user_handler(void) {
+  Watchdog::onTimeout();
+}
+
 /*
  * ═══════════════════════════════════════════════════════════════════════════
  * HARDWARE WIRING GUIDE
@@ -512,6 +1385,12 @@ void loop() {
  *   Orange/Yellow →  Logic Level Shifter HV1
  * 
  * ───────────────────────────────────────────────────────────────────────────
+ * RELAY (relay variant, replaces the servo):
+ * ───────────────────────────────────────────────────────────────────────────
+ *   Relay module IN  →  ESP32 GPIO 27
+ *   Relay COM / NO   →  Barrier controller open input (dry contact)
+ * 
+ * ───────────────────────────────────────────────────────────────────────────
  * ⚠️  CRITICAL NOTES:
  * ───────────────────────────────────────────────────────────────────────────
  *   • ALL grounds must be connected together
@@ -0,0 +1,344 @@
+"""
+Build the allowlist partition image from a list of plates.
+
+    python tools/allowlist_image.py plates.csv -o allowlist.bin [--layout mph]
+    python -m esptool --chip esp32 write_flash 0x180000 allowlist.bin
+
+The input has one plate per line; with CSV, the first column is used (pass
+--header to skip a header row). An optional second column gives the
+plate's access schedule profile, 1-16 as numbered by the server's
+schedule (src/api/schedule.py); empty or 0 is unrestricted. With any
+profile set, the image gets a profile table. Plates are normalized
+like the server does it (letters and digits, upper case) and packed into
+PlateIds. The layouts are documented in include/AllowlistImage.h and
+include/PerfectHash.h, and the partition offset and size come from
+partitions.csv.
+
+The eytzinger layout (8 bytes per plate) stores the plates themselves. The
+mph layout (about 20 bits per plate) stores a minimal perfect hash and
+fingerprints instead, with a 2^-16 false-positive rate; a build retries
+with the next seed until it succeeds. Both are checked against every input
+plate before the image is written.
+
+The 1.44 MB partition holds about 188k plates as eytzinger, or 167k with a
+profile table (one more byte per plate), and about 600k as mph (430k with
+profiles). Larger lists need the mph layout.
+"""
+
+import argparse
+import csv
+import functools
+import logging
+import struct
+import sys
+import time
+import zlib
+from pathlib import Path
+
+logger = logging.getLogger(__name__)
+
+MAGIC = 0x4C414B47  # "GKAL"
+VERSION = 1
+LAYOUT_EYTZINGER = 1
+LAYOUT_PERFECT_HASH = 2
+HEADER = struct.Struct("<IHHIIIIII")
+MAX_CHARS = 12
+MAX_PROFILE = 16  # ScheduleImage::MAX_PROFILES
+MASK64 = (1 << 64) - 1
+
+# PerfectHash.h constants
+MPH_MAX_LEVELS = 24
+MPH_RANK_BLOCK_WORDS = 4
+MPH_TABLE = struct.Struct(f"<II{MPH_MAX_LEVELS + 1}II")
+PARTITION_NAME = "allowlist"
+DEFAULT_PARTITIONS = Path(__file__).resolve().parent.parent / "partitions.csv"
+
+
+def pack_plate(text):
+    """
+    Pack a plate into a PlateId (see include/PlateId.h)
+
+    Returns:
+        The 64-bit ID, or None if the plate has no characters or more than 12
+    """
+    digits = []
+    for ch in text.upper():
+        if "0" <= ch <= "9":
+            digits.append(1 + ord(ch) - ord("0"))
+        elif "A" <= ch <= "Z":
+            digits.append(11 + ord(ch) - ord("A"))
+    if not digits or len(digits) > MAX_CHARS:
+        return None
+
+    plate_id = 0
+    for digit in digits + [0] * (MAX_CHARS - len(digits)):
+        plate_id = plate_id * 37 + digit
+    return plate_id
+
+
+def eytzinger(sorted_ids):
+    """
+    Reorder sorted IDs into BFS order of the implicit search tree
+    """
+    count = len(sorted_ids)
+    out = [0] * count
+    position = 0
+    # Iterative in-order walk over nodes 1..count
+    stack = []
+    node = 1
+    while stack or node <= count:
+        while node <= count:
+            stack.append(node)
+            node *= 2
+        node = stack.pop()
+        out[node - 1] = sorted_ids[position]
+        position += 1
+        node = 2 * node + 1
+    return out
+
+
+def find_index(keys, plate_id):
+    """
+    Reference lookup, mirroring Eytzinger::find()
+
+    Returns:
+        The plate's index in keys, or None
+    """
+    node = 1
+    while node <= len(keys):
+        node = 2 * node + (1 if keys[node - 1] < plate_id else 0)
+    # Drop the trailing right turns and the last left turn
+    while node & 1:
+        node >>= 1
+    node >>= 1
+    return node - 1 if node != 0 and keys[node - 1] == plate_id else None
+
+
+def mph_hash(key, salt):
+    """
+    PerfectHash::hash(): murmur3 fmix64 of the salted key
+    """
+    key ^= (salt * 0x9E3779B97F4A7C15) & MASK64
+    key ^= key >> 33
+    key = (key * 0xFF51AFD7ED558CCD) & MASK64
+    key ^= key >> 33
+    key = (key * 0xC4CEB9FE1A85EC53) & MASK64
+    key ^= key >> 33
+    return key
+
+
+def mph_level_bit(key, seed, level, bits):
+    return ((mph_hash(key, (seed << 8) | level) >> 32) * bits) >> 32
+
+
+def mph_fingerprint(key, seed):
+    return mph_hash(key, (seed << 8) | 0xFF) >> 48
+
+
+def pad8(data):
+    return data + bytes(-len(data) % 8)
+
+
+class PerfectHashTable:
+    """
+    Port of PerfectHash::build() and View; produces byte-identical data
+    """
+
+    def __init__(self, plate_ids, seed, gamma):
+        self.seed = seed
+        self.count = len(plate_ids)
+        self.words = []
+        self.offsets = [0]
+        remaining = list(plate_ids)
+        while remaining:
+            if len(self.offsets) > MPH_MAX_LEVELS:
+                raise ValueError("keys left after the last level")
+            level = len(self.offsets) - 1
+            level_words = int(gamma * len(remaining) / 64) + 1
+            bits = level_words * 64
+            hits = bytearray(bits)
+            positions = [mph_level_bit(key, seed, level, bits) for key in remaining]
+            for bit in positions:
+                hits[bit] = min(hits[bit] + 1, 2)
+            single = int("".join("1" if count == 1 else "0" for count in reversed(hits)), 2)
+            self.words.extend((single >> (64 * w)) & MASK64 for w in range(level_words))
+            self.offsets.append(len(self.words))
+            remaining = [key for key, bit in zip(remaining, positions) if hits[bit] > 1]
+
+        self.ranks = []
+        set_bits = 0
+        for index, word in enumerate(self.words):
+            if index % MPH_RANK_BLOCK_WORDS == 0:
+                self.ranks.append(set_bits)
+            set_bits += bin(word).count("1")
+        if set_bits != self.count:
+            raise ValueError("rank total does not match the key count")
+
+        self.fingerprints = [0] * self.count
+        for key in plate_ids:
+            self.fingerprints[self.slot(key)] = mph_fingerprint(key, seed)
+
+    def slot(self, key):
+        for level in range(len(self.offsets) - 1):
+            first = self.offsets[level]
+            bit = first * 64 + mph_level_bit(key, self.seed, level, (self.offsets[level + 1] - first) * 64)
+            word = bit // 64
+            if (self.words[word] >> (bit % 64)) & 1:
+                block = word - word % MPH_RANK_BLOCK_WORDS
+                rank = self.ranks[word // MPH_RANK_BLOCK_WORDS]
+                rank += sum(bin(w).count("1") for w in self.words[block:word])
+                return rank + bin(self.words[word] & ((1 << (bit % 64)) - 1)).count("1")
+        return None
+
+    def find(self, key):
+        """Slot of a member, None otherwise (up to false positives)"""
+        slot = self.slot(key)
+        if slot is not None and slot < self.count and self.fingerprints[slot] == mph_fingerprint(key, self.seed):
+            return slot
+        return None
+
+    def serialize(self):
+        offsets = self.offsets + [0] * (MPH_MAX_LEVELS + 1 - len(self.offsets))
+        data = MPH_TABLE.pack(self.seed, len(self.offsets) - 1, *offsets, 0)
+        data += struct.pack(f"<{len(self.words)}Q", *self.words)
+        data += pad8(struct.pack(f"<{len(self.ranks)}I", *self.ranks))
+        data += pad8(struct.pack(f"<{self.count}H", *self.fingerprints))
+        return data
+
+
+def read_plates(path, skip_header):
+    """
+    Read (line number, plate, profile text) tuples from a text or CSV file
+    """
+    with open(path, newline="", encoding="utf-8") as handle:
+        reader = csv.reader(handle)
+        if skip_header:
+            next(reader, None)
+        for row in reader:
+            if row and row[0].strip():
+                yield reader.line_num, row[0].strip(), row[1].strip() if len(row) > 1 else ""
+
+
+def find_partition(partitions_path, name):
+    """
+    Look up (offset, size) of a partition in a PlatformIO partitions.csv
+    """
+    with open(partitions_path, encoding="utf-8") as handle:
+        for line in handle:
+            fields = [field.strip() for field in line.split("#", 1)[0].split(",")]
+            if len(fields) >= 5 and fields[0] == name:
+                return int(fields[3], 0), int(fields[4], 0)
+    return None
+
+
+def build_image(plate_ids, layout, generation, seed, gamma, profiles=None):
+    """
+    Serialize header, lookup structure and profile table, checking every
+    plate against them
+
+    Args:
+        plate_ids: Set of PlateIds
+        profiles: Optional dict of PlateId to profile; no table when empty
+
+    Returns:
+        Image bytes
+    """
+    if layout == "mph":
+        for attempt in range(16):
+            try:
+                table = PerfectHashTable(sorted(plate_ids), seed + attempt, gamma)
+                break
+            except ValueError as e:
+                logger.warning(f"Seed {seed + attempt}: {e}, retrying")
+        else:
+            raise ValueError("no seed produced a perfect hash")
+        data = table.serialize()
+        layout_id = LAYOUT_PERFECT_HASH
+        find = table.find
+        logger.info(f"Perfect hash: {len(table.offsets) - 1} levels, {len(data) * 8 / len(plate_ids):.2f} bits per plate")
+    else:
+        keys = eytzinger(sorted(plate_ids))
+        data = struct.pack(f"<{len(keys)}Q", *keys)
+        layout_id = LAYOUT_EYTZINGER
+        find = functools.partial(find_index, keys)
+
+    # Every input plate must be found by the on-device algorithm
+    indexes = {plate_id: find(plate_id) for plate_id in plate_ids}
+    missing = sum(1 for index in indexes.values() if index is None)
+    if missing:
+        raise ValueError(f"self-check failed for {missing} plates")
+
+    table = b""
+    if profiles:
+        entries = bytearray(len(plate_ids))
+        for plate_id, index in indexes.items():
+            entries[index] = profiles.get(plate_id, 0)
+        table = bytes(entries)
+
+    header = HEADER.pack(
+        MAGIC, VERSION, layout_id, len(plate_ids), len(data), zlib.crc32(data), generation, len(table),
+        zlib.crc32(table),
+    )
+    return header + data + table
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("plates", help="text or CSV file with one plate per line")
+    parser.add_argument("--header", action="store_true", help="skip the first row")
+    parser.add_argument("-o", "--output", default="allowlist.bin", help="image file to write")
+    parser.add_argument("--partitions", default=str(DEFAULT_PARTITIONS), help="partition table to size against")
+    parser.add_argument("--generation", type=int, default=None, help="image generation (default: Unix time)")
+    parser.add_argument("--layout", choices=["eytzinger", "mph"], default="eytzinger", help="lookup structure")
+    parser.add_argument("--seed", type=int, default=1, help="first perfect hash seed to try")
+    parser.add_argument("--gamma", type=float, default=2.0, help="perfect hash bits per key per level")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format="%(levelname)s - %(message)s")
+
+    plate_ids = set()
+    profiles = {}
+    rejected = 0
+    for line_number, plate, profile in read_plates(args.plates, args.header):
+        plate_id = pack_plate(plate)
+        if plate_id is None:
+            logger.warning(f"Line {line_number}: cannot pack {plate!r}")
+            rejected += 1
+            continue
+        if profile and (not profile.isdigit() or int(profile) > MAX_PROFILE):
+            logger.warning(f"Line {line_number}: bad profile {profile!r}")
+            rejected += 1
+            continue
+        plate_ids.add(plate_id)
+        if profile and int(profile) != 0:
+            profiles[plate_id] = int(profile)
+
+    if not plate_ids:
+        logger.error("No plates to write")
+        return 1
+
+    generation = args.generation if args.generation is not None else int(time.time())
+    try:
+        image = build_image(plate_ids, args.layout, generation, args.seed, args.gamma, profiles)
+    except ValueError as e:
+        logger.error(f"Cannot build image: {e}")
+        return 1
+
+    partition = find_partition(args.partitions, PARTITION_NAME) if Path(args.partitions).exists() else None
+    if partition is not None and len(image) > partition[1]:
+        hint = ", try --layout mph" if args.layout == "eytzinger" else ""
+        logger.error(f"Image is {len(image)} bytes but the partition holds {partition[1]}{hint}")
+        return 1
+
+    Path(args.output).write_bytes(image)
+    logger.info(
+        f"{len(plate_ids)} plates ({rejected} rejected, {len(profiles)} scheduled), {len(image)} bytes, "
+        f"generation {generation}"
+    )
+    if partition is not None:
+        logger.info(f"Flash with: python -m esptool --chip esp32 write_flash 0x{partition[0]:X} {args.output}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
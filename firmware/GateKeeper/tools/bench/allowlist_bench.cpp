@@ -0,0 +1,240 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// ALLOWLIST LOOKUP BENCHMARK
+// ═══════════════════════════════════════════════════════════════════════════
+// Times membership checks at 10k, 50k and 200k random plates for both
+// image layouts: Eytzinger (against std::lower_bound over the same keys in
+// sorted order) and the minimal perfect hash. Hits and misses are timed
+// separately, since a search miss walks the full depth. For the perfect
+// hash it also reports build throughput, size per key and the
+// false-positive rate, measured on 4M fresh random plates that are not
+// members. The host numbers are for relative cost; run `allow bench` on
+// the device for flash-cache timings.
+//
+// Given an image from tools/allowlist_image.py, it instead validates the
+// header and CRC and looks up every member, which checks the Python builder
+// against the firmware's lookup. Perfect hash images hold no keys, so the
+// plate list is read from stdin.
+//
+// Build: g++ -std=c++17 -O2 -I../../include allowlist_bench.cpp -o allowlist_bench
+// Usage: allowlist_bench [IMAGE [< PLATES]]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "AllowlistImage.h"
+#include "PerfectHash.h"
+#include "PlateId.h"
+
+namespace {
+
+constexpr size_t SIZES[] = {10000, 50000, 200000};
+constexpr size_t LOOKUPS = 1000000;
+constexpr size_t OUTSIDERS = 4000000;  // About 60 false positives at 2^-16
+constexpr uint32_t SEED = 1;
+constexpr double GAMMA = 2.0;
+
+// A random plate shaped like "51A12345": two digits, a letter, five digits
+uint64_t randomPlate(std::mt19937_64& rng) {
+  char text[9] = {};
+  const uint64_t r = rng();
+  snprintf(text, sizeof(text), "%02u%c%05u", static_cast<unsigned>(r % 100), static_cast<char>('A' + (r >> 8) % 26),
+           static_cast<unsigned>((r >> 16) % 100000));
+  return PlateId::pack(text, sizeof(text));
+}
+
+std::vector<uint64_t> makePlates(size_t count, std::mt19937_64& rng) {
+  std::vector<uint64_t> plates;
+  plates.reserve(count);
+  while (plates.size() < count) {
+    plates.push_back(randomPlate(rng));
+  }
+  std::sort(plates.begin(), plates.end());
+  plates.erase(std::unique(plates.begin(), plates.end()), plates.end());
+  return plates;
+}
+
+template <typename Lookup>
+double nsPerLookup(const std::vector<uint64_t>& queries, Lookup lookup, size_t& found) {
+  const auto start = std::chrono::steady_clock::now();
+  found = 0;
+  for (const uint64_t query : queries) {
+    found += lookup(query) ? 1 : 0;
+  }
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / queries.size();
+}
+
+struct Queries {
+  std::vector<uint64_t> sorted;
+  std::vector<uint64_t> hits;
+  std::vector<uint64_t> misses;     // Next to a member: full search depth, rarely a member
+  std::vector<uint64_t> outsiders;  // Fresh random plates that are not members
+};
+
+Queries makeQueries(size_t size, std::mt19937_64& rng) {
+  Queries queries;
+  queries.sorted = makePlates(size, rng);
+  const size_t n = queries.sorted.size();
+  queries.hits.resize(LOOKUPS);
+  queries.misses.resize(LOOKUPS);
+  for (size_t i = 0; i < LOOKUPS; ++i) {
+    queries.hits[i] = queries.sorted[rng() % n];
+    queries.misses[i] = queries.sorted[rng() % n] + 1;
+  }
+  queries.outsiders.reserve(OUTSIDERS);
+  while (queries.outsiders.size() < OUTSIDERS) {
+    const uint64_t plate = randomPlate(rng);
+    if (!std::binary_search(queries.sorted.begin(), queries.sorted.end(), plate)) {
+      queries.outsiders.push_back(plate);
+    }
+  }
+  return queries;
+}
+
+void benchSearch(const Queries& queries) {
+  const std::vector<uint64_t>& sorted = queries.sorted;
+  std::vector<uint64_t> eytzinger(sorted.size());
+  Eytzinger::build(sorted.data(), eytzinger.data(), sorted.size());
+  const uint32_t n = static_cast<uint32_t>(sorted.size());
+
+  const auto inEytzinger = [&](uint64_t key) { return Eytzinger::contains(eytzinger.data(), n, key); };
+  const auto inSorted = [&](uint64_t key) {
+    const auto it = std::lower_bound(sorted.begin(), sorted.end(), key);
+    return it != sorted.end() && *it == key;
+  };
+
+  size_t found[4];
+  const double eytzingerHit = nsPerLookup(queries.hits, inEytzinger, found[0]);
+  const double eytzingerMiss = nsPerLookup(queries.misses, inEytzinger, found[1]);
+  const double sortedHit = nsPerLookup(queries.hits, inSorted, found[2]);
+  const double sortedMiss = nsPerLookup(queries.misses, inSorted, found[3]);
+
+  printf("%7zu  %8.1f %8.1f  %8.1f %8.1f  %6.2f MB%s\n", sorted.size(), eytzingerHit, eytzingerMiss, sortedHit,
+         sortedMiss, sorted.size() * sizeof(uint64_t) / 1e6,
+         found[0] == LOOKUPS && found[1] == found[3] && found[2] == LOOKUPS ? "" : "  MISMATCH");
+}
+
+void benchPerfectHash(const Queries& queries) {
+  const std::vector<uint64_t>& sorted = queries.sorted;
+  const uint32_t n = static_cast<uint32_t>(sorted.size());
+
+  std::vector<uint8_t> data;
+  const auto start = std::chrono::steady_clock::now();
+  const bool built = PerfectHash::build(sorted.data(), n, SEED, GAMMA, data);
+  const std::chrono::duration<double> buildTime = std::chrono::steady_clock::now() - start;
+  PerfectHash::View view;
+  if (!built || !view.attach(data.data(), data.size(), n)) {
+    printf("%7u  build failed\n", static_cast<unsigned>(n));
+    return;
+  }
+
+  // Every member must map to a distinct slot
+  std::vector<bool> taken(n, false);
+  size_t collisions = 0;
+  for (const uint64_t key : sorted) {
+    const uint32_t slot = view.slot(key);
+    collisions += slot >= n || taken[slot] ? 1 : 0;
+    taken[slot < n ? slot : 0] = true;
+  }
+
+  const auto inTable = [&](uint64_t key) { return view.contains(key); };
+  size_t hits = 0;
+  size_t falsePositives = 0;
+  const double hitNs = nsPerLookup(queries.hits, inTable, hits);
+  const double missNs = nsPerLookup(queries.outsiders, inTable, falsePositives);
+
+  printf("%7u  %8.1f %8.1f  %8.2f %6u  %9.2f %9.2e%s\n", static_cast<unsigned>(n), hitNs, missNs,
+         n / buildTime.count() / 1e6, static_cast<unsigned>(view.levels()), data.size() * 8.0 / n,
+         static_cast<double>(falsePositives) / OUTSIDERS, hits == LOOKUPS && collisions == 0 ? "" : "  MISMATCH");
+}
+
+int checkImage(const char* path) {
+  std::ifstream file(path, std::ios::binary);
+  const std::vector<uint8_t> image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  AllowlistHeader header;
+  if (image.size() < sizeof(header)) {
+    fprintf(stderr, "%s: too short for a header\n", path);
+    return 1;
+  }
+  memcpy(&header, image.data(), sizeof(header));
+  if (header.magic != AllowlistImage::MAGIC || header.version != AllowlistImage::VERSION ||
+      sizeof(header) + header.dataBytes + header.profileBytes > image.size() ||
+      (header.profileBytes != 0 && header.profileBytes != header.count)) {
+    fprintf(stderr, "%s: bad header\n", path);
+    return 1;
+  }
+  const uint8_t* data = image.data() + sizeof(header);
+  if (AllowlistImage::crc32(data, header.dataBytes) != header.dataCrc ||
+      AllowlistImage::crc32(data + header.dataBytes, header.profileBytes) != header.profileCrc) {
+    fprintf(stderr, "%s: CRC mismatch\n", path);
+    return 1;
+  }
+
+  if (header.layout == static_cast<uint16_t>(AllowlistLayout::Eytzinger) &&
+      header.dataBytes == header.count * sizeof(uint64_t)) {
+    std::vector<uint64_t> keys(header.count);
+    memcpy(keys.data(), data, header.dataBytes);
+    size_t missing = 0;
+    for (const uint64_t key : keys) {
+      missing += Eytzinger::contains(keys.data(), header.count, key) ? 0 : 1;
+    }
+    printf("%s: eytzinger, %u plates, generation %u, %zu not found\n", path, static_cast<unsigned>(header.count),
+           static_cast<unsigned>(header.generation), missing);
+    return missing == 0 ? 0 : 1;
+  }
+
+  // Perfect hash images hold no keys; pass the plate list to check members
+  PerfectHash::View view;
+  if (header.layout != static_cast<uint16_t>(AllowlistLayout::PerfectHash) ||
+      !view.attach(data, header.dataBytes, header.count)) {
+    fprintf(stderr, "%s: bad layout\n", path);
+    return 1;
+  }
+  size_t missing = 0;
+  size_t plates = 0;
+  char line[64];
+  while (fgets(line, sizeof(line), stdin) != nullptr) {
+    const uint64_t key = PlateId::pack(line, strcspn(line, ",\r\n"));
+    if (key != PlateId::INVALID) {
+      ++plates;
+      missing += view.contains(key) ? 0 : 1;
+    }
+  }
+  printf("%s: perfect hash, %u plates, %u levels, %.2f bits each, generation %u, %zu of %zu stdin plates not found\n",
+         path, static_cast<unsigned>(header.count), static_cast<unsigned>(view.levels()),
+         header.dataBytes * 8.0 / header.count, static_cast<unsigned>(header.generation), missing, plates);
+  return missing == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc > 1) {
+    return checkImage(argv[1]);
+  }
+
+  std::mt19937_64 rng(42);
+  std::vector<Queries> queries;
+  for (const size_t size : SIZES) {
+    queries.push_back(makeQueries(size, rng));
+  }
+
+  printf("%7s  %17s  %17s  %9s\n", "", "eytzinger (ns)", "lower_bound (ns)", "");
+  printf("%7s  %8s %8s  %8s %8s  %9s\n", "plates", "hit", "miss", "hit", "miss", "image");
+  for (const Queries& q : queries) {
+    benchSearch(q);
+  }
+
+  printf("\n%7s  %17s  %8s %6s  %9s %9s\n", "", "perfect hash (ns)", "build", "", "", "");
+  printf("%7s  %8s %8s  %8s %6s  %9s %9s\n", "plates", "hit", "miss", "Mkeys/s", "levels", "bits/key", "fpr");
+  for (const Queries& q : queries) {
+    benchPerfectHash(q);
+  }
+  return 0;
+}
@@ -0,0 +1,171 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// DENYLIST FILTER BENCHMARK
+// ═══════════════════════════════════════════════════════════════════════════
+// Builds binary fuse filters over random plates and reports size per plate,
+// build throughput, lookup time and the measured false-positive rate, first
+// for single filters and then for the denylist as the firmware holds it:
+// DENYLIST_SHARDS filters of one flash sector each. The sharded run also
+// reports the fullest shard, which bounds how many plates the partition can
+// hold. The host numbers are for relative cost; run `deny bench` on the
+// device for flash-cache timings.
+//
+// Given a shard file (the body of GET /denylist/shard/<i>) and a plate list
+// on stdin, it instead validates the shard and looks up every plate that
+// maps to it, which checks src/api/denylist.py against the firmware.
+//
+// Build: g++ -std=c++17 -O2 -I../../include denylist_bench.cpp -o denylist_bench
+// Usage: denylist_bench [SHARD_COUNT SHARD_INDEX FILE < PLATES]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "DenylistImage.h"
+#include "FuseFilter.h"
+#include "PlateId.h"
+
+namespace {
+
+constexpr uint32_t SIZES[] = {1000, 3000, 10000, 100000, 1000000};
+constexpr uint32_t SHARDED_SIZES[] = {100000, 300000, 500000};
+constexpr uint32_t SHARDS = 192;  // Config::DENYLIST_SHARDS
+constexpr size_t LOOKUPS = 1000000;
+
+// Random plates shaped like "51A12345", as in allowlist_bench
+std::vector<uint64_t> makePlates(size_t count, std::mt19937_64& rng) {
+  std::vector<uint64_t> plates;
+  plates.reserve(count);
+  char text[9] = {};
+  while (plates.size() < count) {
+    const uint64_t r = rng();
+    snprintf(text, sizeof(text), "%02u%c%05u", static_cast<unsigned>(r % 100),
+             static_cast<char>('A' + (r >> 8) % 26), static_cast<unsigned>((r >> 16) % 100000));
+    plates.push_back(PlateId::pack(text, sizeof(text)));
+  }
+  std::sort(plates.begin(), plates.end());
+  plates.erase(std::unique(plates.begin(), plates.end()), plates.end());
+  return plates;
+}
+
+// Keys that are not plates at all, so none is a member
+std::vector<uint64_t> makeOutsiders(size_t count, std::mt19937_64& rng) {
+  std::vector<uint64_t> keys(count);
+  for (uint64_t& key : keys) {
+    key = rng() | (1ULL << 63);
+  }
+  return keys;
+}
+
+void benchFilter(uint32_t size, std::mt19937_64& rng) {
+  const std::vector<uint64_t> plates = makePlates(size, rng);
+  const uint32_t n = static_cast<uint32_t>(plates.size());
+  const std::vector<uint64_t> outsiders = makeOutsiders(LOOKUPS, rng);
+
+  FuseFilter::Params params;
+  std::vector<uint8_t> fingerprints;
+  const auto start = std::chrono::steady_clock::now();
+  const bool built = FuseFilter::build(plates.data(), n, rng(), params, fingerprints);
+  const std::chrono::duration<double> buildTime = std::chrono::steady_clock::now() - start;
+  if (!built) {
+    printf("%8u  build failed\n", static_cast<unsigned>(n));
+    return;
+  }
+
+  size_t missing = 0;
+  for (const uint64_t plate : plates) {
+    missing += FuseFilter::contains(params, fingerprints.data(), plate) ? 0 : 1;
+  }
+  size_t falsePositives = 0;
+  const auto lookupStart = std::chrono::steady_clock::now();
+  for (const uint64_t key : outsiders) {
+    falsePositives += FuseFilter::contains(params, fingerprints.data(), key) ? 1 : 0;
+  }
+  const std::chrono::duration<double, std::nano> lookupTime = std::chrono::steady_clock::now() - lookupStart;
+
+  printf("%8u  %9.2f  %8.2f  %8.1f  %9.2e%s\n", static_cast<unsigned>(n), fingerprints.size() * 8.0 / n,
+         n / buildTime.count() / 1e6, lookupTime.count() / LOOKUPS, static_cast<double>(falsePositives) / LOOKUPS,
+         missing == 0 ? "" : "  MISSING");
+}
+
+void benchSharded(uint32_t size, std::mt19937_64& rng) {
+  const std::vector<uint64_t> plates = makePlates(size, rng);
+  std::vector<std::vector<uint64_t>> buckets(SHARDS);
+  for (const uint64_t plate : plates) {
+    buckets[DenylistImage::shardOf(plate, SHARDS)].push_back(plate);
+  }
+
+  size_t bytes = 0;
+  size_t fullest = 0;
+  size_t overflow = 0;
+  size_t failed = 0;
+  for (const std::vector<uint64_t>& bucket : buckets) {
+    if (bucket.empty()) {
+      continue;
+    }
+    FuseFilter::Params params;
+    std::vector<uint8_t> fingerprints;
+    if (!FuseFilter::build(bucket.data(), static_cast<uint32_t>(bucket.size()), rng(), params, fingerprints)) {
+      ++failed;
+      continue;
+    }
+    bytes += sizeof(DenylistImage::ShardHeader) + fingerprints.size();
+    fullest = std::max(fullest, fingerprints.size());
+    overflow += fingerprints.size() > DenylistImage::MAX_FINGERPRINTS ? 1 : 0;
+  }
+
+  printf("%8zu  %9.2f  %8zu  %8zu  %6zu%s\n", plates.size(), bytes * 8.0 / plates.size(), bytes / 1024, fullest,
+         overflow, failed == 0 ? "" : "  BUILD FAILED");
+}
+
+int checkShard(uint32_t shardCount, uint32_t index, const char* path) {
+  std::ifstream file(path, std::ios::binary);
+  const std::vector<uint8_t> shard((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (!DenylistImage::shardValid(shard.data(), shard.size())) {
+    fprintf(stderr, "%s: bad header or CRC\n", path);
+    return 1;
+  }
+  DenylistImage::ShardHeader header;
+  memcpy(&header, shard.data(), sizeof(header));
+
+  size_t plates = 0;
+  size_t missing = 0;
+  char line[64];
+  while (fgets(line, sizeof(line), stdin) != nullptr) {
+    const uint64_t key = PlateId::pack(line, strcspn(line, "#\r\n"));
+    if (key != PlateId::INVALID && DenylistImage::shardOf(key, shardCount) == index) {
+      ++plates;
+      missing += DenylistImage::contains(shard.data(), key) ? 0 : 1;
+    }
+  }
+  printf("%s: shard %u, %u plates, generation %u, %zu bytes, %zu of %zu stdin plates not found\n", path,
+         static_cast<unsigned>(index), static_cast<unsigned>(header.keys), static_cast<unsigned>(header.generation),
+         shard.size(), missing, plates);
+  return missing == 0 && plates == header.keys ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc > 3) {
+    return checkShard(static_cast<uint32_t>(atoi(argv[1])), static_cast<uint32_t>(atoi(argv[2])), argv[3]);
+  }
+
+  std::mt19937_64 rng(42);
+  printf("%8s  %9s  %8s  %8s  %9s\n", "plates", "bits/key", "Mkeys/s", "ns/query", "fpr");
+  for (const uint32_t size : SIZES) {
+    benchFilter(size, rng);
+  }
+
+  printf("\n%u shards of %u bytes\n", static_cast<unsigned>(SHARDS), static_cast<unsigned>(DenylistImage::SHARD_BYTES));
+  printf("%8s  %9s  %8s  %8s  %6s\n", "plates", "bits/key", "KB", "fullest", "over");
+  for (const uint32_t size : SHARDED_SIZES) {
+    benchSharded(size, rng);
+  }
+  return 0;
+}
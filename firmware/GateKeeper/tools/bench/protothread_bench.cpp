@@ -0,0 +1,162 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// PROTOTHREAD BENCHMARK
+// ═══════════════════════════════════════════════════════════════════════════
+// Reports what a protothread costs next to the alternatives for the
+// recognition flow. Memory is the size of the Protothread itself and of a
+// flow shaped like GateKeeperApp::recognitionFlow with the state it keeps
+// across waits. Time is per resume: a flow parked at a PT_AWAIT whose
+// condition stays false, a flow stepping through a chain of PT_YIELDs, and
+// the same two written as a hand-rolled state enum, with a plain call as
+// the floor. A FreeRTOS task per flow, the other non-blocking option,
+// would need its own stack (4 KB for the display task) plus a TCB.
+// The host numbers are for relative cost; either way a resume is tiny
+// next to the loop's 10 ms pass.
+//
+// Build: g++ -std=c++17 -O2 -I../../include protothread_bench.cpp -o protothread_bench
+// Usage: protothread_bench [RESUMES]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "DecisionTransport.h"
+#include "FixedString.h"
+#include "Protothread.h"
+
+namespace {
+
+  volatile bool ready = false;
+  volatile uint32_t sink = 0;
+
+  // Shape of the firmware flow: the protothread plus what outlives a wait
+  struct RecognitionFlow {
+    Protothread pt;
+    PlateText plate;
+    DecisionState decision;
+    bool accepted;
+  };
+
+  struct ParkedFlow {
+    Protothread pt;
+
+    __attribute__((noinline)) PtState run() {
+      PT_BEGIN(pt);
+      sink = sink + 1;
+      PT_AWAIT(pt, ready);
+      sink = sink + 2;
+      PT_END(pt);
+    }
+  };
+
+  struct ParkedEnum {
+    enum class Step : uint8_t { Start, Waiting } step = Step::Start;
+
+    __attribute__((noinline)) bool run() {
+      switch (step) {
+        case Step::Start:
+          sink = sink + 1;
+          step = Step::Waiting;
+          [[fallthrough]];
+        case Step::Waiting:
+          if (!ready) {
+            return false;
+          }
+          sink = sink + 2;
+          step = Step::Start;
+          return true;
+      }
+      return true;
+    }
+  };
+
+  // Eight waits in a row, so every resume lands on a different case
+  struct SteppingFlow {
+    Protothread pt;
+
+    __attribute__((noinline)) PtState run() {
+      PT_BEGIN(pt);
+      PT_YIELD(pt);
+      sink = sink + 1;
+      PT_YIELD(pt);
+      sink = sink + 1;
+      PT_YIELD(pt);
+      sink = sink + 1;
+      PT_YIELD(pt);
+      sink = sink + 1;
+      PT_YIELD(pt);
+      sink = sink + 1;
+      PT_YIELD(pt);
+      sink = sink + 1;
+      PT_YIELD(pt);
+      sink = sink + 1;
+      PT_YIELD(pt);
+      sink = sink + 1;
+      PT_END(pt);
+    }
+  };
+
+  struct SteppingEnum {
+    uint8_t step = 0;
+
+    __attribute__((noinline)) bool run() {
+      if (step > 0) {
+        sink = sink + 1;
+      }
+      if (step == 8) {
+        step = 0;
+        return true;
+      }
+      ++step;
+      return false;
+    }
+  };
+
+  __attribute__((noinline)) void plainCall() {
+    sink = sink + 1;
+  }
+
+  template <typename Body>
+  double nsPer(uint32_t resumes, Body body) {
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < resumes; ++i) {
+      body();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / resumes;
+  }
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const uint32_t resumes = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 50000000;
+  if (resumes == 0) {
+    fprintf(stderr, "Usage: protothread_bench [RESUMES]\n");
+    return 1;
+  }
+
+  printf("Memory\n");
+  printf("  Protothread          %3zu bytes\n", sizeof(Protothread));
+  printf("  recognition flow     %3zu bytes (protothread, plate, decision)\n", sizeof(RecognitionFlow));
+  printf("  FreeRTOS task        4096 bytes stack + TCB, per flow\n");
+
+  ParkedFlow parkedFlow;
+  ParkedEnum parkedEnum;
+  SteppingFlow steppingFlow;
+  SteppingEnum steppingEnum;
+
+  printf("\nPer resume, %u resumes\n", static_cast<unsigned>(resumes));
+  printf("  plain call           %6.2f ns\n", nsPer(resumes, [] { plainCall(); }));
+  printf("  parked protothread   %6.2f ns\n", nsPer(resumes, [&] { parkedFlow.run(); }));
+  printf("  parked enum          %6.2f ns\n", nsPer(resumes, [&] { parkedEnum.run(); }));
+  printf("  stepping protothread %6.2f ns\n", nsPer(resumes, [&] { steppingFlow.run(); }));
+  printf("  stepping enum        %6.2f ns\n", nsPer(resumes, [&] { steppingEnum.run(); }));
+
+  // Release the parked flows so both finish
+  ready = true;
+  const bool finished = parkedFlow.run() == PtState::Done && parkedEnum.run();
+  if (!finished || parkedFlow.pt.running()) {
+    fprintf(stderr, "Parked flows did not finish\n");
+    return 1;
+  }
+  return 0;
+}
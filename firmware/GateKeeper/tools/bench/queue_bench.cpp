@@ -0,0 +1,117 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// LOCK-FREE QUEUE STRESS TEST AND BENCHMARK
+// ═══════════════════════════════════════════════════════════════════════════
+// Hammers SpscQueue and MpscQueue from real threads, checks that every item
+// arrives exactly once and in per-producer order, and reports ops/sec next to
+// a mutex-protected ring as the baseline. Run the TSan build to check the
+// memory ordering; run the -O2 build for numbers.
+//
+// Build: g++ -std=c++17 -O2 -pthread -I../../include queue_bench.cpp -o queue_bench
+//        g++ -std=c++17 -O1 -g -fsanitize=thread -pthread -I../../include queue_bench.cpp -o queue_bench_tsan
+// Usage: queue_bench [ITEMS_PER_PRODUCER] [PRODUCERS]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "LockFreeQueue.h"
+
+namespace {
+
+constexpr size_t CAPACITY = 256;
+
+struct Event {
+  uint32_t producer;
+  uint32_t sequence;
+};
+
+// Baseline with the same interface, standing in for a locked FreeRTOS queue.
+class MutexQueue {
+public:
+  bool push(const Event& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (count_ == CAPACITY) {
+      return false;
+    }
+    slots_[(head_ + count_) % CAPACITY] = value;
+    ++count_;
+    return true;
+  }
+
+  bool pop(Event& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (count_ == 0) {
+      return false;
+    }
+    out = slots_[head_];
+    head_ = (head_ + 1) % CAPACITY;
+    --count_;
+    return true;
+  }
+
+private:
+  std::mutex mutex_;
+  Event slots_[CAPACITY];
+  size_t head_ = 0;
+  size_t count_ = 0;
+};
+
+template <typename Queue>
+bool run(const char* label, uint32_t items, uint32_t producers) {
+  static Queue queue;
+  std::vector<uint32_t> expected(producers, 0);
+  bool ordered = true;
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (uint32_t p = 0; p < producers; ++p) {
+    threads.emplace_back([p, items] {
+      for (uint32_t i = 0; i < items; ++i) {
+        while (!queue.push(Event{p, i})) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  const uint64_t total = static_cast<uint64_t>(items) * producers;
+  for (uint64_t received = 0; received < total;) {
+    Event event;
+    if (!queue.pop(event)) {
+      std::this_thread::yield();
+      continue;
+    }
+    if (event.producer >= producers || event.sequence != expected[event.producer]) {
+      ordered = false;
+    } else {
+      ++expected[event.producer];
+    }
+    ++received;
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::printf("%-26s producers=%u items=%llu %-4s %.2f Mops/s\n", label, producers,
+              static_cast<unsigned long long>(total), ordered ? "ok" : "FAIL", total / seconds / 1e6);
+  return ordered;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const uint32_t items = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 2000000;
+  const uint32_t producers = argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 4;
+
+  bool ok = true;
+  ok &= run<SpscQueue<Event, CAPACITY>>("spsc", items, 1);
+  ok &= run<MutexQueue>("mutex ring (1 producer)", items, 1);
+  ok &= run<MpscQueue<Event, CAPACITY>>("mpsc", items, producers);
+  ok &= run<MutexQueue>("mutex ring", items, producers);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// ACCESS SCHEDULE BENCHMARK
+// ═══════════════════════════════════════════════════════════════════════════
+// Times Evaluator::permits on a full schedule (MAX_PROFILES profiles,
+// MAX_OVERRIDES overrides), both within one day, where a check is a bit
+// test, and with the date changing on every check, which pays for
+// resolving the day's overrides each time. The host numbers are for
+// relative cost.
+//
+// Given a schedule (the body of GET /schedule, or src/api/schedule.py run
+// as a script) and checks on stdin, it instead validates the schedule and
+// answers every check, which tests the Python compiler against the
+// firmware's evaluation: override order, windows past midnight and the day
+// numbering. A check is "YYYY-MM-DD HH:MM PROFILE open|closed"; blank lines
+// and lines starting with # are skipped. schedule_week.json and
+// schedule_week.txt are a known week to run it on:
+//
+//   python3 ../../../../src/api/schedule.py schedule_week.json --today 2026-12-20 -o week.bin
+//   schedule_bench week.bin < schedule_week.txt
+//
+// Build: g++ -std=c++17 -O2 -I../../include schedule_bench.cpp -o schedule_bench
+// Usage: schedule_bench [SCHEDULE < CHECKS]
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "ScheduleImage.h"
+
+namespace {
+
+constexpr size_t CHECKS = 1000000;
+constexpr int32_t FIRST_DAY = 20000;  // 2024-10-04
+
+// 1970-01-01 was a Thursday
+uint8_t weekdayOf(int32_t day) {
+  return static_cast<uint8_t>((day % 7 + 11) % 7);
+}
+
+// Random bitmaps, and overrides spread over the 64 days from FIRST_DAY
+std::vector<uint8_t> makeSchedule(std::mt19937_64& rng) {
+  using namespace ScheduleImage;
+  std::vector<uint8_t> image(MAX_BYTES);
+  uint8_t* body = image.data() + sizeof(Header);
+  for (size_t i = 0; i < MAX_PROFILES * BITMAP_BYTES; ++i) {
+    body[i] = static_cast<uint8_t>(rng());
+  }
+  for (uint32_t i = 0; i < MAX_OVERRIDES; ++i) {
+    const Override entry = {static_cast<uint16_t>(FIRST_DAY + i), static_cast<uint8_t>(rng() % (OPEN + 1)), 0,
+                            static_cast<uint16_t>(rng()), 0};
+    memcpy(body + MAX_PROFILES * BITMAP_BYTES + i * sizeof(Override), &entry, sizeof(entry));
+  }
+  const Header header = {MAGIC, AllowlistImage::crc32(body, image.size() - sizeof(Header)), MAX_PROFILES,
+                         MAX_OVERRIDES, SLOT_MINUTES, 0};
+  memcpy(image.data(), &header, sizeof(header));
+  return image;
+}
+
+void bench(std::mt19937_64& rng) {
+  const std::vector<uint8_t> image = makeSchedule(rng);
+  if (!ScheduleImage::valid(image.data(), image.size())) {
+    fprintf(stderr, "generated schedule invalid\n");
+    return;
+  }
+  ScheduleImage::Evaluator evaluator;
+  evaluator.attach(image.data());
+
+  std::vector<uint32_t> queries(CHECKS);
+  for (uint32_t& query : queries) {
+    query = static_cast<uint32_t>(rng());
+  }
+
+  for (const bool newDay : {false, true}) {
+    size_t open = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < CHECKS; ++i) {
+      const uint32_t query = queries[i];
+      const int32_t day = FIRST_DAY + (newDay ? static_cast<int32_t>(i % ScheduleImage::MAX_OVERRIDES) : 0);
+      const uint8_t profile = static_cast<uint8_t>(query % (ScheduleImage::MAX_PROFILES + 1));
+      open += evaluator.permits(profile, day, weekdayOf(day), (query >> 8) % (24 * 60)) ? 1 : 0;
+    }
+    const std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+    printf("%-10s  %8.1f  %6.1f%%\n", newDay ? "new day" : "same day", time.count() / CHECKS, 100.0 * open / CHECKS);
+  }
+}
+
+int checkSchedule(const char* path) {
+  std::ifstream file(path, std::ios::binary);
+  const std::vector<uint8_t> image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (!ScheduleImage::valid(image.data(), image.size())) {
+    fprintf(stderr, "%s: bad header or CRC\n", path);
+    return 1;
+  }
+  ScheduleImage::Header header;
+  memcpy(&header, image.data(), sizeof(header));
+  ScheduleImage::Evaluator evaluator;
+  evaluator.attach(image.data());
+
+  size_t checks = 0;
+  size_t wrong = 0;
+  char line[128];
+  for (unsigned number = 1; fgets(line, sizeof(line), stdin) != nullptr; ++number) {
+    int year;
+    unsigned month, date, hour, minute, profile;
+    char expected[8];
+    const size_t start = strspn(line, " \t");
+    if (line[start] == '#' || line[start] == '\n' || line[start] == '\r' || line[start] == '\0') {
+      continue;
+    }
+    if (sscanf(line, "%d-%u-%u %u:%u %u %7s", &year, &month, &date, &hour, &minute, &profile, expected) != 7 ||
+        (strcmp(expected, "open") != 0 && strcmp(expected, "closed") != 0) || hour >= 24 || minute >= 60) {
+      fprintf(stderr, "stdin:%u: cannot parse check\n", number);
+      return 1;
+    }
+    const int32_t day = ScheduleImage::dayNumber(year, month, date);
+    const bool open = evaluator.permits(static_cast<uint8_t>(profile), day, weekdayOf(day), hour * 60 + minute);
+    ++checks;
+    if (open != (strcmp(expected, "open") == 0)) {
+      ++wrong;
+      printf("stdin:%u: %04d-%02u-%02u %02u:%02u profile %u is %s, expected %s\n", number, year, month, date, hour,
+             minute, profile, open ? "open" : "closed", expected);
+    }
+  }
+  printf("%s: %u profiles, %u overrides, generation %u, %zu of %zu checks wrong\n", path,
+         static_cast<unsigned>(header.profileCount), static_cast<unsigned>(header.overrideCount),
+         static_cast<unsigned>(header.generation), wrong, checks);
+  return wrong == 0 && checks > 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc > 1) {
+    return checkSchedule(argv[1]);
+  }
+
+  std::mt19937_64 rng(42);
+  printf("%u profiles, %u overrides\n", static_cast<unsigned>(ScheduleImage::MAX_PROFILES),
+         static_cast<unsigned>(ScheduleImage::MAX_OVERRIDES));
+  printf("%-10s  %8s  %7s\n", "dates", "ns/check", "open");
+  bench(rng);
+  return 0;
+}
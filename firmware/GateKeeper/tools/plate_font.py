@@ -0,0 +1,234 @@
+"""
+Generate include/PlateFont.h, the OLED plate font, from stroke outlines.
+
+    python tools/plate_font.py [-o include/PlateFont.h] [--preview 16]
+
+Also runs as a PlatformIO pre-build script (extra_scripts in
+platformio.ini) and regenerates the header when this file is newer.
+
+Each glyph is a few polylines on a 4x6 design grid. For every target
+height they are drawn with a round pen of about height/8 pixels: a pixel
+is set when its centre lies within half a pen width of a stroke. There is
+no anti-aliasing, so every size is drawn for its own pixel grid instead of
+being a scaled 5x7 font. Glyphs are stored as columns of SSD1306 pages
+(one byte per 8 rows, least significant bit on top), the display's native
+buffer layout, so the renderer can copy them without per-pixel work.
+"""
+
+import argparse
+import logging
+import math
+import sys
+from pathlib import Path
+
+logger = logging.getLogger(__name__)
+
+OUTPUT = Path("include") / "PlateFont.h"  # Relative to the project
+HEIGHTS = [8, 10, 12, 14, 16, 20, 24, 28, 32, 40]
+WIDTH_RATIO = 0.6  # Glyph box width over height for a 4-unit glyph
+GRID_WIDTH = 4
+GRID_HEIGHT = 6
+
+# Polylines in design units, (0, 0) top left. A one-point line is a dot.
+O_RING = [(1, 0), (3, 0), (4, 1), (4, 5), (3, 6), (1, 6), (0, 5), (0, 1), (1, 0)]
+P_BOWL = [(0, 6), (0, 0), (3, 0), (4, 1), (4, 2), (3, 3), (0, 3)]
+GLYPHS = {
+    " ": (2, []),
+    "-": (3, [[(0.5, 3), (2.5, 3)]]),
+    ".": (1, [[(0.5, 6)]]),
+    "0": (4, [O_RING, [(3, 1.5), (1, 4.5)]]),
+    "1": (4, [[(1, 1), (2, 0), (2, 6)], [(1, 6), (3, 6)]]),
+    "2": (4, [[(0, 1), (1, 0), (3, 0), (4, 1), (4, 2), (0, 6), (4, 6)]]),
+    "3": (4, [[(0, 1), (1, 0), (3, 0), (4, 1), (4, 2), (3, 3), (1.5, 3)],
+              [(3, 3), (4, 4), (4, 5), (3, 6), (1, 6), (0, 5)]]),
+    "4": (4, [[(3, 6), (3, 0), (0, 4), (4, 4)]]),
+    "5": (4, [[(4, 0), (0, 0), (0, 3), (3, 3), (4, 4), (4, 5), (3, 6), (1, 6), (0, 5)]]),
+    "6": (4, [[(3, 0), (1, 0), (0, 1), (0, 5), (1, 6), (3, 6), (4, 5), (4, 4), (3, 3), (0, 3)]]),
+    "7": (4, [[(0, 0), (4, 0), (4, 1), (2, 4), (2, 6)]]),
+    "8": (4, [[(1, 0), (3, 0), (4, 1), (4, 2), (3, 3), (1, 3), (0, 2), (0, 1), (1, 0)],
+              [(1, 3), (0, 4), (0, 5), (1, 6), (3, 6), (4, 5), (4, 4), (3, 3)]]),
+    "9": (4, [[(4, 3), (1, 3), (0, 2), (0, 1), (1, 0), (3, 0), (4, 1), (4, 5), (3, 6), (1, 6)]]),
+    "A": (4, [[(0, 6), (0, 1), (1, 0), (3, 0), (4, 1), (4, 6)], [(0, 3), (4, 3)]]),
+    "B": (4, [P_BOWL, [(3, 3), (4, 4), (4, 5), (3, 6), (0, 6)]]),
+    "C": (4, [[(4, 1), (3, 0), (1, 0), (0, 1), (0, 5), (1, 6), (3, 6), (4, 5)]]),
+    "D": (4, [[(0, 0), (3, 0), (4, 1), (4, 5), (3, 6), (0, 6), (0, 0)]]),
+    "E": (4, [[(4, 0), (0, 0), (0, 6), (4, 6)], [(0, 3), (3, 3)]]),
+    "F": (4, [[(4, 0), (0, 0), (0, 6)], [(0, 3), (3, 3)]]),
+    "G": (4, [[(4, 1), (3, 0), (1, 0), (0, 1), (0, 5), (1, 6), (3, 6), (4, 5), (4, 3), (2, 3)]]),
+    "H": (4, [[(0, 0), (0, 6)], [(4, 0), (4, 6)], [(0, 3), (4, 3)]]),
+    "I": (4, [[(1, 0), (3, 0)], [(2, 0), (2, 6)], [(1, 6), (3, 6)]]),
+    "J": (4, [[(4, 0), (4, 5), (3, 6), (1, 6), (0, 5)]]),
+    "K": (4, [[(0, 0), (0, 6)], [(4, 0), (0, 4)], [(1.5, 2.5), (4, 6)]]),
+    "L": (4, [[(0, 0), (0, 6), (4, 6)]]),
+    "M": (4, [[(0, 6), (0, 0), (2, 3), (4, 0), (4, 6)]]),
+    "N": (4, [[(0, 6), (0, 0), (4, 6), (4, 0)]]),
+    "O": (4, [O_RING]),
+    "P": (4, [P_BOWL]),
+    "Q": (4, [O_RING, [(2.5, 4.5), (4, 6)]]),
+    "R": (4, [P_BOWL, [(2, 3), (4, 6)]]),
+    "S": (4, [[(4, 1), (3, 0), (1, 0), (0, 1), (0, 2), (1, 3), (3, 3), (4, 4), (4, 5), (3, 6), (1, 6), (0, 5)]]),
+    "T": (4, [[(0, 0), (4, 0)], [(2, 0), (2, 6)]]),
+    "U": (4, [[(0, 0), (0, 5), (1, 6), (3, 6), (4, 5), (4, 0)]]),
+    "V": (4, [[(0, 0), (0, 3), (2, 6), (4, 3), (4, 0)]]),
+    "W": (4, [[(0, 0), (0, 6), (2, 3), (4, 6), (4, 0)]]),
+    "X": (4, [[(0, 0), (0, 1), (4, 5), (4, 6)], [(4, 0), (4, 1), (0, 5), (0, 6)]]),
+    "Y": (4, [[(0, 0), (0, 1), (2, 3), (4, 1), (4, 0)], [(2, 3), (2, 6)]]),
+    "Z": (4, [[(0, 0), (4, 0), (4, 1), (0, 5), (0, 6), (4, 6)]]),
+}
+CHARSET = "".join(GLYPHS)
+
+
+def segment_distance(px, py, ax, ay, bx, by):
+    dx, dy = bx - ax, by - ay
+    length = dx * dx + dy * dy
+    t = 0.0 if length == 0 else max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / length))
+    return math.hypot(px - ax - t * dx, py - ay - t * dy)
+
+
+def rasterize(char, height):
+    """
+    Returns:
+        Rows of 0/1 pixels for one glyph at a pixel height
+    """
+    units, lines = GLYPHS[char]
+    pen = max(1, round(height / 8))
+    full_width = max(3, round(height * WIDTH_RATIO))
+    width = max(1, round(full_width * units / GRID_WIDTH)) if units < GRID_WIDTH else full_width
+    # Stroke centres span the box minus one pen width
+    scale_x = (width - pen) / units if units else 0
+    scale_y = (height - pen) / GRID_HEIGHT
+    offset = (pen - 1) / 2
+
+    rows = [[0] * width for _ in range(height)]
+    for line in lines:
+        points = [(offset + x * scale_x, offset + y * scale_y) for x, y in line]
+        segments = list(zip(points, points[1:])) or [(points[0], points[0])]
+        for y in range(height):
+            for x in range(width):
+                if any(segment_distance(x, y, ax, ay, bx, by) <= pen / 2 for (ax, ay), (bx, by) in segments):
+                    rows[y][x] = 1
+    return rows
+
+
+def to_columns(rows):
+    """
+    Returns:
+        Page bytes, column by column (ceil(height / 8) bytes per column)
+    """
+    height = len(rows)
+    pages = (height + 7) // 8
+    data = []
+    for x in range(len(rows[0])):
+        for page in range(pages):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and rows[y][x]:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def generate():
+    """
+    Returns:
+        Text of PlateFont.h
+    """
+    out = [
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        "// Generated by tools/plate_font.py; edit the outlines there, not this file.",
+        "//",
+        "// Plate glyphs at several pixel heights, stored as columns of SSD1306",
+        "// pages (least significant bit on top). See PlateRenderer.h.",
+        "",
+        "namespace PlateFont {",
+        f'  inline constexpr char CHARSET[] = "{CHARSET}";',
+        f"  constexpr uint8_t GLYPH_COUNT = {len(CHARSET)};",
+        "",
+        "  struct Glyph {",
+        "    uint16_t offset;  // Into the size's columns",
+        "    uint8_t width;",
+        "  };",
+        "",
+        "  struct Size {",
+        "    uint8_t height;",
+        "    uint8_t gap;  // Columns between glyphs",
+        "    const Glyph* glyphs;",
+        "    const uint8_t* columns;",
+        "  };",
+        "",
+    ]
+    sizes = []
+    total = 0
+    for height in HEIGHTS:
+        columns = []
+        glyphs = []
+        for char in CHARSET:
+            rows = rasterize(char, height)
+            glyphs.append((len(columns), len(rows[0])))
+            columns.extend(to_columns(rows))
+        total += len(columns) + 3 * len(glyphs)
+        gap = max(1, round(height / 8))
+        out.append(f"  inline constexpr uint8_t COLUMNS_{height}[] = {{")
+        for start in range(0, len(columns), 16):
+            out.append("      " + ", ".join(f"0x{byte:02X}" for byte in columns[start:start + 16]) + ",")
+        out.append("  };")
+        out.append(f"  inline constexpr Glyph GLYPHS_{height}[] = {{")
+        for start in range(0, len(glyphs), 8):
+            out.append("      " + " ".join(f"{{{offset}, {width}}}," for offset, width in glyphs[start:start + 8]))
+        out.append("  };")
+        out.append("")
+        sizes.append(f"      {{{height}, {gap}, GLYPHS_{height}, COLUMNS_{height}}},")
+
+    out.append("  // Ascending height")
+    out.append("  inline constexpr Size SIZES[] = {")
+    out.extend(sizes)
+    out.append("  };")
+    out.append(f"  constexpr uint8_t SIZE_COUNT = {len(HEIGHTS)};")
+    out.append("}")
+    out.append("")
+    logger.info(f"{len(CHARSET)} glyphs at {len(HEIGHTS)} sizes, {total} bytes of flash")
+    return "\n".join(out)
+
+
+def write_if_stale(project):
+    """Regenerate when the header is missing or older than this script"""
+    output = project / OUTPUT
+    script = project / "tools" / "plate_font.py"
+    if output.exists() and output.stat().st_mtime >= script.stat().st_mtime:
+        return
+    output.write_text(generate(), encoding="utf-8")
+    logger.info(f"Wrote {output}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    default_output = Path(__file__).resolve().parent.parent / OUTPUT
+    parser.add_argument("-o", "--output", default=str(default_output), help="header to write")
+    parser.add_argument("--preview", type=int, metavar="HEIGHT", help="print the glyphs at HEIGHT instead")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format="%(levelname)s - %(message)s")
+
+    if args.preview:
+        glyphs = [rasterize(char, args.preview) for char in CHARSET]
+        for y in range(args.preview):
+            print(" ".join("".join("#" if pixel else "." for pixel in rows[y]) for rows in glyphs))
+        return 0
+
+    Path(args.output).write_text(generate(), encoding="utf-8")
+    logger.info(f"Wrote {args.output}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
+else:
+    # PlatformIO runs extra_scripts through SCons, which provides Import()
+    # (and no __file__)
+    Import("env")  # noqa: F821
+    logging.basicConfig(level=logging.INFO, format="%(levelname)s - %(message)s")
+    write_if_stale(Path(env.subst("$PROJECT_DIR")))  # noqa: F821
@@ -0,0 +1,138 @@
+"""
+Symbolize a GateKeeper sampling-profiler dump into folded stacks.
+
+Capture the output of the `prof dump` console command (a serial log with
+other lines mixed in is fine), then:
+
+    python tools/profile_symbolize.py monitor.log \
+        --elf .pio/build/upesy_wroom/firmware.elf > gate.folded
+    flamegraph.pl gate.folded > gate.svg      # or load gate.folded in speedscope
+
+Each sample is only the interrupted PC, so a "stack" is
+core;task;function[;file:line]. Functions are resolved with
+xtensa-esp32-elf-addr2line from the PlatformIO toolchain.
+"""
+
+import argparse
+import collections
+import logging
+import shutil
+import subprocess
+import sys
+
+logger = logging.getLogger(__name__)
+
+DEFAULT_ADDR2LINE = "xtensa-esp32-elf-addr2line"
+ADDR2LINE_BATCH = 500
+
+
+def parse_dump(lines):
+    """
+    Parse the profiler dump
+
+    Args:
+        lines: Iterable of text lines, possibly with unrelated log output
+
+    Returns:
+        (header, task names by handle, list of (core, pc, handle) samples)
+    """
+    header = ""
+    tasks = {}
+    samples = []
+    in_dump = False
+
+    for raw in lines:
+        line = raw.strip()
+        if line.startswith("# gatekeeper-profile"):
+            header, tasks, samples, in_dump = line, {}, [], True
+            continue
+        if not in_dump:
+            continue
+        if line == "# end":
+            in_dump = False
+            continue
+
+        fields = line.split()
+        if len(fields) >= 3 and fields[0] == "T":
+            tasks[int(fields[1], 16)] = " ".join(fields[2:])
+        elif len(fields) == 4 and fields[0] == "S":
+            samples.append((int(fields[1]), int(fields[2], 16), int(fields[3], 16)))
+
+    return header, tasks, samples
+
+
+def symbolize(elf, addresses, addr2line, with_lines):
+    """
+    Resolve addresses to function names (and optionally file:line)
+
+    Returns:
+        Dict of address -> symbol text
+    """
+    symbols = {}
+    addresses = sorted(addresses)
+
+    for start in range(0, len(addresses), ADDR2LINE_BATCH):
+        batch = addresses[start:start + ADDR2LINE_BATCH]
+        output = subprocess.run(
+            [addr2line, "-f", "-C", "-e", elf] + [f"0x{address:08x}" for address in batch],
+            check=True, capture_output=True, text=True,
+        ).stdout.splitlines()
+
+        # addr2line -f prints two lines per address: function, then file:line
+        for index, address in enumerate(batch):
+            function = output[2 * index] if 2 * index < len(output) else "??"
+            location = output[2 * index + 1] if 2 * index + 1 < len(output) else "??:0"
+            if function == "??":
+                function = f"0x{address:08x}"
+            if with_lines and not location.startswith("??"):
+                function = f"{function};{location.rsplit('/', 1)[-1]}"
+            symbols[address] = function
+
+    return symbols
+
+
+def fold(samples, tasks, symbols, per_core):
+    """
+    Aggregate samples into folded-stack counts
+    """
+    counts = collections.Counter()
+    for core, pc, handle in samples:
+        task = tasks.get(handle, f"task_{handle:08x}") if handle else "[no task]"
+        frames = [f"core{core}"] if per_core else []
+        frames += [task.replace(";", "_").replace(" ", "_"), symbols.get(pc, "[unknown]")]
+        counts[";".join(frames)] += 1
+    return counts
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="serial log containing a `prof dump` output")
+    parser.add_argument("--elf", required=True, help="firmware.elf matching the running image")
+    parser.add_argument("--addr2line", default=DEFAULT_ADDR2LINE, help="addr2line binary for the Xtensa toolchain")
+    parser.add_argument("--lines", action="store_true", help="add file:line as a leaf frame")
+    parser.add_argument("--no-core", action="store_true", help="merge both cores into one graph")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format="%(levelname)s - %(message)s")
+
+    if shutil.which(args.addr2line) is None:
+        logger.error(f"{args.addr2line} not found; add ~/.platformio/packages/toolchain-xtensa-esp32/bin to PATH")
+        return 1
+
+    with open(args.dump, encoding="utf-8", errors="replace") as handle:
+        header, tasks, samples = parse_dump(handle)
+
+    if not samples:
+        logger.error("No profiler samples found in the dump")
+        return 1
+
+    logger.info(f"{header.lstrip('# ')}: {len(samples)} samples, {len(tasks)} tasks")
+    symbols = symbolize(args.elf, {pc for _, pc, _ in samples if pc}, args.addr2line, args.lines)
+
+    for stack, count in sorted(fold(samples, tasks, symbols, not args.no_core).items()):
+        sys.stdout.write(f"{stack} {count}\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
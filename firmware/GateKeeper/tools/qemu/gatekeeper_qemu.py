@@ -0,0 +1,332 @@
+"""
+Run the GateKeeper image under Espressif's QEMU and drive vehicles through it.
+
+Build the emulation image, start a stand-in recognition server, then run:
+
+    pio run -e qemu
+    LPR_STUB_PLATE=51A12345 uvicorn main:app --port 8000      # in src/api
+    python tools/qemu/gatekeeper_qemu.py --vehicles 20 --log qemu.log
+
+The script merges the bootloader, partition table and app into a flash
+image, boots it in qemu-system-xtensa (from Espressif's QEMU fork) and
+bridges the firmware's UART1 tunnel (see include/QemuHarness.h) to the
+server. Each vehicle is a `pin` stimulus on the sensor inputs, held until
+the gate has moved, then released. Latency is stimulus to first servo or
+relay output, both stamped on the device's esp_timer; run with --icount
+for timings that do not depend on host load.
+
+With --profile the sampling profiler runs for the whole session and its
+dump ends up in the log, ready for tools/profile_symbolize.py.
+"""
+
+import argparse
+import logging
+import os
+import re
+import selectors
+import shutil
+import socket
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+logger = logging.getLogger(__name__)
+
+DEFAULT_QEMU = "qemu-system-xtensa"
+DEFAULT_BUILD_DIR = os.path.join(".pio", "build", "qemu")
+FLASH_SIZE = 4 * 1024 * 1024
+FLASH_LAYOUT = (("bootloader.bin", 0x1000), ("partitions.bin", 0x8000), ("firmware.bin", 0x10000))
+
+# Tunnel framing, mirrored from QemuHarness.h
+SYNC = 0xA5
+FRAME_OPEN, FRAME_DATA, FRAME_CLOSE, FRAME_OPENED, FRAME_CLOSED = 1, 2, 3, 4, 5
+MAX_PAYLOAD = 255
+
+READY_LINE = "[QEMU] Harness ready"
+PIN_RE = re.compile(r"\[QEMU\] pin (\d+)=(\d) t_us=(\d+)")
+OUT_RE = re.compile(r"\[QEMU\] out (\w+) pin=(\d+) value=(\d+) t_us=(\d+)")
+
+
+def build_flash_image(build_dir, path):
+    """
+    Lay the PlatformIO build outputs out at their flash offsets
+    """
+    image = bytearray(b"\xff" * FLASH_SIZE)
+    for name, offset in FLASH_LAYOUT:
+        with open(os.path.join(build_dir, name), "rb") as handle:
+            data = handle.read()
+        image[offset:offset + len(data)] = data
+    with open(path, "wb") as handle:
+        handle.write(image)
+
+
+def free_port():
+    with socket.socket() as probe:
+        probe.bind(("127.0.0.1", 0))
+        return probe.getsockname()[1]
+
+
+def connect_retry(port, timeout_s):
+    deadline = time.monotonic() + timeout_s
+    while True:
+        try:
+            return socket.create_connection(("127.0.0.1", port))
+        except OSError:
+            if time.monotonic() > deadline:
+                raise
+            time.sleep(0.1)
+
+
+class TunnelBridge:
+    """
+    Host end of the UART1 tunnel: one server socket per device channel
+    """
+
+    def __init__(self, uart, server, selector):
+        self.uart = uart
+        self.server = server
+        self.selector = selector
+        self.buffer = bytearray()
+        self.sockets = {}
+
+    def on_uart(self, data):
+        self.buffer += data
+        while True:
+            start = self.buffer.find(bytes([SYNC]))
+            if start < 0:
+                self.buffer.clear()
+                return
+            del self.buffer[:start]
+            if len(self.buffer) < 4 or len(self.buffer) < 4 + self.buffer[3]:
+                return
+            frame_type, channel, length = self.buffer[1], self.buffer[2], self.buffer[3]
+            payload = bytes(self.buffer[4:4 + length])
+            del self.buffer[:4 + length]
+            self.on_frame(frame_type, channel, payload)
+
+    def on_frame(self, frame_type, channel, payload):
+        if frame_type == FRAME_OPEN:
+            self.close(channel)
+            # The device asks for its configured address; the bridge always
+            # connects to --server instead
+            try:
+                sock = socket.create_connection(self.server, timeout=2)
+                sock.setblocking(False)
+                sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+            except OSError as error:
+                logger.warning(f"Channel {channel}: cannot reach {self.server[0]}:{self.server[1]}: {error}")
+                self.send(FRAME_OPENED, channel, b"\x00")
+                return
+            self.sockets[channel] = sock
+            self.selector.register(sock, selectors.EVENT_READ, ("server", channel))
+            self.send(FRAME_OPENED, channel, b"\x01")
+        elif frame_type == FRAME_DATA and channel in self.sockets:
+            self.sockets[channel].sendall(payload)
+        elif frame_type == FRAME_CLOSE:
+            self.close(channel)
+
+    def on_server(self, channel):
+        sock = self.sockets[channel]
+        try:
+            data = sock.recv(4096)
+        except OSError:
+            data = b""
+        if not data:
+            self.close(channel)
+            self.send(FRAME_CLOSED, channel, b"")
+            return
+        for start in range(0, len(data), MAX_PAYLOAD):
+            self.send(FRAME_DATA, channel, data[start:start + MAX_PAYLOAD])
+
+    def send(self, frame_type, channel, payload):
+        self.uart.sendall(bytes([SYNC, frame_type, channel, len(payload)]) + payload)
+
+    def close(self, channel):
+        sock = self.sockets.pop(channel, None)
+        if sock is not None:
+            self.selector.unregister(sock)
+            sock.close()
+
+
+class Session:
+    """
+    A running QEMU with its console and tunnel attached
+    """
+
+    def __init__(self, args, flash_path):
+        console_port, tunnel_port = free_port(), free_port()
+        command = [
+            args.qemu, "-machine", "esp32", "-display", "none", "-monitor", "none",
+            "-drive", f"file={flash_path},if=mtd,format=raw",
+            "-serial", f"tcp:127.0.0.1:{console_port},server=on,wait=off",
+            "-serial", f"tcp:127.0.0.1:{tunnel_port},server=on,wait=off",
+        ]
+        if args.icount is not None:
+            command += ["-icount", f"shift={args.icount}"]
+        command += args.qemu_arg
+        logger.info(" ".join(command))
+
+        self.process = subprocess.Popen(command)
+        self.console = connect_retry(console_port, 10)
+        self.tunnel = connect_retry(tunnel_port, 10)
+        self.selector = selectors.DefaultSelector()
+        self.selector.register(self.console, selectors.EVENT_READ, ("console", None))
+        self.selector.register(self.tunnel, selectors.EVENT_READ, ("tunnel", None))
+        self.bridge = TunnelBridge(self.tunnel, args.server, self.selector)
+        self.log = open(args.log, "w", encoding="utf-8") if args.log else None
+        self.pending = ""
+
+    def command(self, text):
+        self.console.sendall(text.encode() + b"\n")
+
+    def wait_for(self, predicate, timeout_s):
+        """
+        Pump both serial ports until a console line satisfies predicate
+
+        Returns:
+            The predicate's result, or None on timeout
+        """
+        deadline = time.monotonic() + timeout_s
+        while time.monotonic() < deadline:
+            for key, _ in self.selector.select(timeout=0.05):
+                role, channel = key.data
+                if role == "server":
+                    self.bridge.on_server(channel)
+                    continue
+                data = key.fileobj.recv(4096)
+                if not data:
+                    raise RuntimeError("QEMU closed its serial port")
+                if role == "tunnel":
+                    self.bridge.on_uart(data)
+                    continue
+                self.pending += data.decode("utf-8", errors="replace")
+                *lines, self.pending = self.pending.split("\n")
+                for line in lines:
+                    line = line.rstrip("\r")
+                    if self.log:
+                        self.log.write(line + "\n")
+                    result = predicate(line)
+                    if result:
+                        return result
+        return None
+
+    def close(self):
+        if self.log:
+            self.log.close()
+        self.process.terminate()
+        try:
+            self.process.wait(timeout=5)
+        except subprocess.TimeoutExpired:
+            self.process.kill()
+
+
+def drive_vehicle(session, pins, hold_s, timeout_s):
+    """
+    Assert the sensors, wait for the gate to move, then release them
+
+    Returns:
+        Stimulus-to-output latency in ms, or None if the gate never moved
+    """
+    asserted_us = None
+    for pin in pins:
+        session.command(f"pin {pin} 0")
+        match = session.wait_for(PIN_RE.search, 5)
+        if match is None:
+            raise RuntimeError(f"No acknowledgement for pin {pin}")
+        asserted_us = asserted_us or int(match.group(3))
+
+    output = session.wait_for(OUT_RE.search, timeout_s)
+    # Let the gate finish its cycle before the vehicle leaves
+    session.wait_for(lambda line: False, hold_s)
+    for pin in pins:
+        session.command(f"pin {pin} 1")
+        session.wait_for(PIN_RE.search, 5)
+
+    if output is None:
+        return None
+    return (int(output.group(4)) - asserted_us) / 1000.0
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--build-dir", default=DEFAULT_BUILD_DIR, help="PlatformIO output of the qemu env")
+    parser.add_argument("--qemu", default=DEFAULT_QEMU, help="qemu-system-xtensa from Espressif's QEMU fork")
+    parser.add_argument("--server", default="127.0.0.1:8000", help="host:port every tunnel connection goes to")
+    parser.add_argument("--vehicles", type=int, default=10, help="vehicles to drive through the gate")
+    parser.add_argument("--pins", default="4,25", help="sensor GPIOs asserted (driven low) per vehicle")
+    parser.add_argument("--hold", type=float, default=3.0, help="seconds a vehicle stays after the gate moves")
+    parser.add_argument("--gap", type=float, default=2.0, help="seconds between vehicles")
+    parser.add_argument("--timeout", type=float, default=15.0, help="seconds to wait for the gate to move")
+    parser.add_argument("--icount", type=int, help="run with -icount shift=N for host-independent timing")
+    parser.add_argument("--qemu-arg", action="append", default=[], help="extra QEMU argument (repeatable)")
+    parser.add_argument("--profile", action="store_true", help="run the sampling profiler and dump it at the end")
+    parser.add_argument("--log", help="write the device console to this file")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format="%(levelname)s - %(message)s")
+
+    host, _, port = args.server.rpartition(":")
+    args.server = (host, int(port))
+    pins = [int(pin) for pin in args.pins.split(",") if pin]
+
+    if shutil.which(args.qemu) is None:
+        logger.error(f"{args.qemu} not found; install Espressif's QEMU fork (idf_tools.py install qemu-xtensa)")
+        return 1
+
+    with tempfile.TemporaryDirectory() as workdir:
+        flash_path = os.path.join(workdir, "flash.bin")
+        try:
+            build_flash_image(args.build_dir, flash_path)
+        except OSError as error:
+            logger.error(f"{error}; build the image with `pio run -e qemu` first")
+            return 1
+
+        session = Session(args, flash_path)
+        try:
+            if session.wait_for(lambda line: READY_LINE in line, 60) is None:
+                logger.error("Firmware did not reach the harness")
+                return 1
+            variant = session.wait_for(lambda line: line if line.startswith("[Variant]") else None, 30)
+            logger.info(variant or "Variant line not seen")
+
+            if args.profile:
+                session.command("prof start")
+
+            latencies = []
+            for vehicle in range(args.vehicles):
+                latency = drive_vehicle(session, pins, args.hold, args.timeout)
+                if latency is None:
+                    logger.warning(f"Vehicle {vehicle + 1}: gate did not move")
+                else:
+                    logger.info(f"Vehicle {vehicle + 1}: {latency:.1f} ms")
+                    latencies.append(latency)
+                session.wait_for(lambda line: False, args.gap)
+
+            if args.profile:
+                session.command("prof stop")
+                session.command("prof dump")
+                session.wait_for(lambda line: line.strip() == "# end", 30)
+
+            session.command("metrics")
+            session.wait_for(lambda line: False, 1)
+        finally:
+            session.close()
+
+    if not latencies:
+        logger.error("The gate never moved")
+        return 1
+    print(f"vehicles {args.vehicles}, gate moved {len(latencies)}")
+    print(f"stimulus to output ms: p50 {statistics.median(latencies):.1f}  "
+          f"p95 {percentile(latencies, 0.95):.1f}  max {max(latencies):.1f}")
+    return 0 if len(latencies) == args.vehicles else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,470 @@
+#pragma once
+
+// ═══════════════════════════════════════════════════════════════════════════
+// LANE REPLAY (HOST ONLY)
+// ═══════════════════════════════════════════════════════════════════════════
+// Runs a lane's raw sensor edges through the firmware's own debounce and
+// fusion code, sampled once per loop pass, and models GateKeeperApp around
+// it:
+//   - presence is not re-read while a vehicle is being handled;
+//   - a recognition asks the server about the vehicle in front of the
+//     sensors, which answers as that vehicle's next recorded or generated
+//     response does. Nobody there is a deny. An answer slower than the
+//     timeout is a failure, retried up to the retry count, then a deny;
+//   - the flow ends SERVO_TRAVEL_MS after the gate command;
+//   - a departure closes the gate after the hold-open window, unless a
+//     vehicle arrives first.
+// Nothing is random, so the same traffic and settings always give the
+// same result, and a change to Debounce.h or PresenceSource.h shows up in
+// the next replay.
+//
+// Runs are scored against the traffic's ground truth:
+//   served       authorized vehicle the gate opened for and stayed open for
+//   false open   the gate was open while an unauthorized vehicle was there,
+//                e.g. a tailgater inside the hold-open window
+//   false deny   authorized vehicle the gate never opened for, or closed on
+//   wait         arrival to the gate opening, for served vehicles
+
+#include <climits>
+#include <memory>
+
+#include "Config.h"
+#include "Debounce.h"
+#include "PresenceSource.h"
+#include "Trace.h"
+
+namespace Sim {
+
+constexpr size_t MAX_LANE_SOURCES = 4;
+constexpr unsigned long NO_ANSWER = ULONG_MAX;
+
+struct Vehicle {
+  unsigned long long arrivalUs;
+  unsigned long long departureUs;
+  bool authorized;
+  std::vector<unsigned long> responseMs;  // Per request, NO_ANSWER if lost; the last one repeats
+};
+
+struct LaneTraffic {
+  std::map<int, std::vector<Edge>> edges;  // By GPIO
+  std::vector<Vehicle> vehicles;           // By arrival
+  unsigned long long endUs = 0;
+  unsigned long emptyResponseMs = 800;  // The server's deny when no plate is in view
+};
+
+struct LaneSettings {
+  Config::DebounceMode debounceMode = Config::DEBOUNCE_MODE;
+  unsigned long debounceWindowMs = Config::DEBOUNCE_DELAY_MS;
+  uint8_t integratorSamples = Config::DEBOUNCE_INTEGRATOR_SAMPLES;
+  unsigned long assertMs = Config::DEBOUNCE_ASSERT_MS;
+  unsigned long deassertMs = Config::DEBOUNCE_DEASSERT_MS;
+  uint8_t majoritySamples = Config::DEBOUNCE_MAJORITY_SAMPLES;
+  unsigned long loopMs = Config::LOOP_DELAY_MS;
+  uint8_t minVotes = Config::FUSION_MIN_VOTES;
+  uint16_t minConfidence = Config::FUSION_MIN_CONFIDENCE;
+  unsigned long alignWindowMs = Config::FUSION_ALIGN_WINDOW_MS;
+  unsigned long timeoutMs = Config::HTTP_TIMEOUT_MS;
+  uint8_t decisionRetries = Config::DECISION_RETRIES;
+  unsigned long holdOpenMs = Config::HOLD_OPEN_MS;
+  unsigned long servoTravelMs = Config::SERVO_TRAVEL_MS;
+};
+
+struct Recognition {
+  unsigned long long triggerUs;
+  unsigned long long gateUs;
+  bool opened;
+  bool failed;  // The last request got no answer in time
+};
+
+struct GateInterval {
+  unsigned long long openUs;
+  unsigned long long closeUs;
+};
+
+struct LaneResult {
+  std::vector<Recognition> recognitions;
+  std::vector<GateInterval> gate;
+};
+
+inline unsigned long percentile(std::vector<unsigned long> values, double p) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  return values[static_cast<size_t>(p * (values.size() - 1))];
+}
+
+struct LaneScore {
+  size_t vehicles = 0;
+  size_t served = 0;
+  size_t falseOpens = 0;
+  size_t falseDenies = 0;
+  size_t recognitions = 0;
+  size_t opens = 0;
+  size_t failures = 0;
+  std::vector<unsigned long> waitsMs;
+  double hours = 0.0;
+
+  double servedPerHour() const {
+    return hours > 0 ? served / hours : 0.0;
+  }
+
+  unsigned long p95WaitMs() const {
+    return percentile(waitsMs, 0.95);
+  }
+
+  double errorRate() const {
+    return vehicles > 0 ? static_cast<double>(falseOpens + falseDenies) / vehicles : 0.0;
+  }
+};
+
+// The firmware's sources by GPIO, with the level that means "vehicle"
+struct SourcePin {
+  int pin;
+  const char* name;
+  int activeLevel;
+  uint8_t confidence;
+};
+
+constexpr SourcePin SOURCE_PINS[] = {
+    {Config::LM393_SENSOR_PIN, "lm393", 0, Config::LM393_CONFIDENCE},
+    {Config::LOOP_DETECTOR_PIN, "loop", 0, Config::LOOP_DETECTOR_CONFIDENCE},
+};
+
+inline const SourcePin* findSourcePin(int pin) {
+  for (const SourcePin& source : SOURCE_PINS) {
+    if (source.pin == pin) {
+      return &source;
+    }
+  }
+  return nullptr;
+}
+
+inline std::unique_ptr<DebounceStrategy> makeDebounce(const LaneSettings& settings, int activeLevel) {
+  switch (settings.debounceMode) {
+    case Config::DebounceMode::Integrator:
+      return std::unique_ptr<DebounceStrategy>(new CounterIntegratorDebounce(settings.integratorSamples));
+    case Config::DebounceMode::Asymmetric: {
+      auto* asymmetric = new AsymmetricDebounce(settings.assertMs, settings.deassertMs);
+      asymmetric->setActiveLevel(activeLevel);
+      return std::unique_ptr<DebounceStrategy>(asymmetric);
+    }
+    case Config::DebounceMode::Majority:
+      return std::unique_ptr<DebounceStrategy>(new MajorityDebounce(settings.majoritySamples));
+    case Config::DebounceMode::RestartWindow:
+    default:
+      return std::unique_ptr<DebounceStrategy>(new RestartWindowDebounce(settings.debounceWindowMs));
+  }
+}
+
+// Raw edges of one pin, sampled and debounced like DebouncedSensor does
+class EdgeSource : public PresenceSource {
+public:
+  EdgeSource(const SourcePin& pin, const std::vector<Edge>& edges, std::unique_ptr<DebounceStrategy> strategy)
+      : PresenceSource(pin.confidence), pin_(pin), edges_(edges), strategy_(std::move(strategy)) {}
+
+  void initialize() override {
+    cursor_ = 0;
+    // The lane is assumed empty when recording starts. The first edge's
+    // level is no guide: the ISR reads the pin after a bounce may have
+    // ended on either side.
+    strategy_->reset(1 - pin_.activeLevel, 0);
+    markChanged(0);
+  }
+
+  bool update(unsigned long nowMs) override {
+    const unsigned long long nowUs = nowMs * 1000ULL;
+    while (cursor_ < edges_.size() && edges_[cursor_].timeUs <= nowUs) {
+      ++cursor_;
+    }
+    const int raw = cursor_ > 0 ? edges_[cursor_ - 1].level : strategy_->stableValue();
+    if (!strategy_->update(raw, nowMs)) {
+      return false;
+    }
+    markChanged(nowMs);
+    return true;
+  }
+
+  bool isPresent() const override {
+    return strategy_->stableValue() == pin_.activeLevel;
+  }
+
+  const char* name() const override {
+    return pin_.name;
+  }
+
+private:
+  const SourcePin& pin_;
+  const std::vector<Edge>& edges_;
+  std::unique_ptr<DebounceStrategy> strategy_;
+  size_t cursor_ = 0;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TRAFFIC FROM A FIELD RECORDING
+// ═══════════════════════════════════════════════════════════════════════════
+// A recording has no hand-labelled truth, so the gate's own view stands in
+// for it: a vehicle is a fused presence interval that led to a request,
+// arriving at the first sensor edge towards presence since the previous
+// one left. It is authorized if the gate opened for it, and the server
+// answers it as it did at the time. False opens and denies are therefore
+// only meaningful relative to the recorded run.
+
+inline LaneTraffic trafficFromRecording(const FieldRecording& recording) {
+  LaneTraffic traffic;
+  traffic.edges = recording.edges;
+  traffic.endUs = recording.endUs;
+
+  std::vector<unsigned long long> arrivalsUs;
+  for (const auto& entry : recording.edges) {
+    const SourcePin* pin = findSourcePin(entry.first);
+    for (const Edge& edge : entry.second) {
+      if (pin != nullptr && edge.level == pin->activeLevel) {
+        arrivalsUs.push_back(edge.timeUs);
+      }
+    }
+  }
+  std::sort(arrivalsUs.begin(), arrivalsUs.end());
+
+  std::vector<unsigned long> deniesMs;
+  size_t next = 0;
+  unsigned long long previousDepartureUs = 0;
+  for (size_t i = 0; i < recording.presence.size(); ++i) {
+    if (recording.presence[i].value == 0) {
+      continue;
+    }
+    const unsigned long long riseUs = recording.presence[i].timeUs;
+    const unsigned long long fallUs = i + 1 < recording.presence.size() ? recording.presence[i + 1].timeUs
+                                                                          : recording.endUs;
+    Vehicle vehicle{riseUs, fallUs, false, {}};
+    while (next < recording.exchanges.size() && recording.exchanges[next].requestUs <= fallUs) {
+      const Exchange& exchange = recording.exchanges[next++];
+      if (exchange.requestUs < riseUs) {
+        continue;
+      }
+      vehicle.responseMs.push_back(exchange.answered
+                                       ? static_cast<unsigned long>((exchange.decisionUs - exchange.requestUs) / 1000)
+                                       : NO_ANSWER);
+      vehicle.authorized = vehicle.authorized || exchange.opened;
+      if (exchange.answered && !exchange.accepted) {
+        deniesMs.push_back(vehicle.responseMs.back());
+      }
+    }
+    if (vehicle.responseMs.empty()) {
+      continue;
+    }
+    const auto arrival = std::lower_bound(arrivalsUs.begin(), arrivalsUs.end(), previousDepartureUs);
+    if (arrival != arrivalsUs.end() && *arrival < riseUs) {
+      vehicle.arrivalUs = *arrival;
+    }
+    previousDepartureUs = fallUs;
+    traffic.vehicles.push_back(vehicle);
+  }
+  if (!deniesMs.empty()) {
+    traffic.emptyResponseMs = percentile(deniesMs, 0.5);
+  }
+  return traffic;
+}
+
+// What the device did, in the form a replay takes
+inline LaneResult recordedResult(const FieldRecording& recording) {
+  LaneResult result;
+  for (const Exchange& exchange : recording.exchanges) {
+    if (exchange.ended) {
+      result.recognitions.push_back({exchange.requestUs, exchange.decisionUs, exchange.opened, !exchange.answered});
+    }
+  }
+  bool open = false;
+  for (const Marker& marker : recording.gate) {
+    if (marker.value != 0 && !open) {
+      result.gate.push_back({marker.timeUs, recording.endUs});
+    } else if (marker.value == 0 && open) {
+      result.gate.back().closeUs = marker.timeUs;
+    }
+    open = marker.value != 0;
+  }
+  return result;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REPLAY AND SCORING
+// ═══════════════════════════════════════════════════════════════════════════
+
+class LaneReplay {
+public:
+  explicit LaneReplay(const LaneTraffic& traffic) : traffic_(traffic) {}
+
+  // Const and self-contained, so one LaneReplay serves many threads
+  LaneResult replay(const LaneSettings& settings) const {
+    std::vector<std::unique_ptr<EdgeSource>> sources;
+    PresenceFusion<MAX_LANE_SOURCES> fusion(settings.minVotes, settings.minConfidence, settings.alignWindowMs);
+    for (const auto& entry : traffic_.edges) {
+      const SourcePin* pin = findSourcePin(entry.first);
+      if (pin != nullptr && sources.size() < MAX_LANE_SOURCES) {
+        sources.emplace_back(new EdgeSource(*pin, entry.second, makeDebounce(settings, pin->activeLevel)));
+        fusion.addSource(*sources.back());
+      }
+    }
+    fusion.initialize();
+
+    Lane lane(settings, traffic_);
+    const unsigned long endMs = static_cast<unsigned long>(traffic_.endUs / 1000);
+    unsigned long t = settings.loopMs;
+    for (; t <= endMs || lane.step != Step::Idle; t += settings.loopMs) {
+      lane.pass(fusion, t);
+    }
+    if (lane.gateOpen) {
+      lane.result.gate.back().closeUs = t * 1000ULL;
+    }
+    return std::move(lane.result);
+  }
+
+  LaneScore score(const LaneResult& result) const {
+    LaneScore score;
+    score.hours = traffic_.endUs / 3.6e9;
+    score.vehicles = traffic_.vehicles.size();
+    score.recognitions = result.recognitions.size();
+    for (const Recognition& recognition : result.recognitions) {
+      score.opens += recognition.opened ? 1 : 0;
+      score.failures += recognition.failed ? 1 : 0;
+    }
+
+    for (const Vehicle& vehicle : traffic_.vehicles) {
+      const GateInterval* first = nullptr;
+      bool closedOn = false;
+      for (const GateInterval& interval : result.gate) {
+        if (interval.openUs >= vehicle.departureUs || interval.closeUs <= vehicle.arrivalUs) {
+          continue;
+        }
+        first = first != nullptr ? first : &interval;
+        closedOn = closedOn || interval.closeUs < vehicle.departureUs;
+      }
+
+      if (!vehicle.authorized) {
+        score.falseOpens += first != nullptr ? 1 : 0;
+      } else if (first == nullptr || closedOn) {
+        ++score.falseDenies;
+      } else {
+        ++score.served;
+        const unsigned long long openUs = std::max(first->openUs, vehicle.arrivalUs);
+        score.waitsMs.push_back(static_cast<unsigned long>((openUs - vehicle.arrivalUs) / 1000));
+      }
+    }
+    return score;
+  }
+
+private:
+  enum class Step { Idle, Deciding, Settling };
+
+  // One replay's state, advanced a loop pass at a time
+  struct Lane {
+    Lane(const LaneSettings& settings, const LaneTraffic& traffic)
+        : settings(settings), traffic(traffic), requestsMade(traffic.vehicles.size(), 0) {}
+
+    const LaneSettings& settings;
+    const LaneTraffic& traffic;
+    std::vector<size_t> requestsMade;  // Per vehicle
+    LaneResult result;
+    Step step = Step::Idle;
+    unsigned long dueMs = 0;
+    int vehicle = -1;
+    uint8_t retries = 0;
+    bool accepted = false;
+    bool failed = false;
+    bool closePending = false;
+    unsigned long departedMs = 0;
+    bool gateOpen = false;
+    Recognition current{};
+
+    void pass(PresenceFusion<MAX_LANE_SOURCES>& fusion, unsigned long t) {
+      const unsigned long long nowUs = t * 1000ULL;
+      if (step == Step::Deciding) {
+        if (t < dueMs) {
+          return;
+        }
+        if (failed && retries < settings.decisionRetries) {
+          ++retries;
+          request(t);
+          return;
+        }
+        current.gateUs = nowUs;
+        current.opened = !failed && accepted;
+        current.failed = failed;
+        result.recognitions.push_back(current);
+        setGate(current.opened, nowUs);
+        step = Step::Settling;
+        dueMs = t + settings.servoTravelMs;
+        return;
+      }
+      if (step == Step::Settling) {
+        if (t >= dueMs) {
+          step = Step::Idle;
+        }
+        return;
+      }
+
+      if (fusion.update(t)) {
+        closePending = !fusion.isPresent();
+        departedMs = t;
+        if (fusion.isPresent()) {
+          current = {nowUs, 0, false, false};
+          vehicle = vehicleAt(nowUs);
+          retries = 0;
+          request(t);
+          step = Step::Deciding;
+          return;
+        }
+      }
+      if (closePending && (t - departedMs) >= settings.holdOpenMs) {
+        closePending = false;
+        setGate(false, nowUs);
+      }
+    }
+
+    void request(unsigned long t) {
+      unsigned long responseMs = traffic.emptyResponseMs;
+      accepted = false;
+      if (vehicle >= 0) {
+        const Vehicle& target = traffic.vehicles[vehicle];
+        const size_t index = requestsMade[vehicle]++;
+        if (!target.responseMs.empty()) {
+          responseMs = target.responseMs[std::min(index, target.responseMs.size() - 1)];
+        }
+        accepted = target.authorized;
+      }
+      failed = responseMs == NO_ANSWER || responseMs >= settings.timeoutMs;
+      dueMs = t + (failed ? settings.timeoutMs : responseMs);
+    }
+
+    void setGate(bool open, unsigned long long nowUs) {
+      if (open && !gateOpen) {
+        result.gate.push_back({nowUs, nowUs});
+      } else if (!open && gateOpen) {
+        result.gate.back().closeUs = nowUs;
+      }
+      gateOpen = open;
+    }
+
+    // The most recent arrival still in front of the sensors
+    int vehicleAt(unsigned long long nowUs) const {
+      const auto after = std::upper_bound(traffic.vehicles.begin(), traffic.vehicles.end(), nowUs,
+                                          [](unsigned long long time, const Vehicle& v) { return time < v.arrivalUs; });
+      for (auto it = after; it != traffic.vehicles.begin();) {
+        --it;
+        if (it->departureUs >= nowUs) {
+          return static_cast<int>(it - traffic.vehicles.begin());
+        }
+        if (nowUs - it->arrivalUs > MAX_DWELL_US) {
+          break;
+        }
+      }
+      return -1;
+    }
+  };
+
+  static constexpr unsigned long long MAX_DWELL_US = 600000000ULL;  // Search bound, 10 minutes
+
+  const LaneTraffic& traffic_;
+};
+
+}  // namespace Sim
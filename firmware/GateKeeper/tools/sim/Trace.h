@@ -0,0 +1,248 @@
+#pragma once
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TRACE LOADING (HOST ONLY)
+// ═══════════════════════════════════════════════════════════════════════════
+// Event traces are CSV lines of `time_ms,channel,value`. Blank lines, lines
+// starting with '#' and a non-numeric header row are ignored. The reserved
+// channel `truth` carries the hand-labelled vehicle presence (1 = vehicle).
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "DecisionTransport.h"
+
+namespace Sim {
+
+struct TraceEvent {
+  unsigned long timeMs;
+  int value;
+};
+
+struct Interval {
+  unsigned long startMs;
+  unsigned long endMs;
+};
+
+struct Trace {
+  std::map<std::string, std::vector<TraceEvent>> channels;
+  unsigned long endMs = 0;
+
+  // Rising/falling pairs of a channel; an open interval ends at the trace end.
+  std::vector<Interval> intervals(const std::string& channel) const {
+    std::vector<Interval> result;
+    const auto it = channels.find(channel);
+    if (it == channels.end()) {
+      return result;
+    }
+
+    bool high = false;
+    unsigned long start = 0;
+    for (const TraceEvent& event : it->second) {
+      if (event.value != 0 && !high) {
+        high = true;
+        start = event.timeMs;
+      } else if (event.value == 0 && high) {
+        high = false;
+        result.push_back({start, event.timeMs});
+      }
+    }
+    if (high) {
+      result.push_back({start, endMs});
+    }
+    return result;
+  }
+};
+
+inline bool loadTrace(const std::string& path, Trace& trace) {
+  std::ifstream in(path);
+  if (!in) {
+    std::fprintf(stderr, "Cannot open trace %s\n", path.c_str());
+    return false;
+  }
+
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#' || !std::isdigit(static_cast<unsigned char>(line[0]))) {
+      continue;
+    }
+
+    const size_t first = line.find(',');
+    const size_t second = line.find(',', first + 1);
+    if (first == std::string::npos || second == std::string::npos) {
+      std::fprintf(stderr, "Skipping malformed line: %s\n", line.c_str());
+      continue;
+    }
+
+    const unsigned long timeMs = std::strtoul(line.c_str(), nullptr, 10);
+    const std::string channel = line.substr(first + 1, second - first - 1);
+    const int value = std::atoi(line.c_str() + second + 1);
+    trace.channels[channel].push_back({timeMs, value});
+    trace.endMs = std::max(trace.endMs, timeMs);
+  }
+
+  for (auto& entry : trace.channels) {
+    std::stable_sort(entry.second.begin(), entry.second.end(),
+                     [](const TraceEvent& a, const TraceEvent& b) { return a.timeMs < b.timeMs; });
+  }
+  return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// LOGIC-ANALYZER CAPTURES
+// ═══════════════════════════════════════════════════════════════════════════
+// Saleae Logic / sigrok CSV exports: a header row, then `time_s,ch0,ch1,...`
+// rows, either one per transition or one per sample. Only level changes of
+// the selected data column are kept.
+
+struct Edge {
+  unsigned long long timeUs;
+  int level;
+};
+
+inline bool loadLogicCapture(const std::string& path, int column, std::vector<Edge>& edges) {
+  std::ifstream in(path);
+  if (!in) {
+    std::fprintf(stderr, "Cannot open capture %s\n", path.c_str());
+    return false;
+  }
+
+  std::string line;
+  double originS = -1.0;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#' || line[0] == ';') {
+      continue;
+    }
+
+    const char* cursor = line.c_str();
+    char* end = nullptr;
+    const double timeS = std::strtod(cursor, &end);
+    if (end == cursor) {
+      continue;  // Header row
+    }
+
+    int level = -1;
+    for (int i = 0; i <= column && *end == ','; ++i) {
+      cursor = end + 1;
+      level = static_cast<int>(std::strtol(cursor, &end, 10));
+    }
+    if (level < 0) {
+      std::fprintf(stderr, "Capture has no data column %d\n", column);
+      return false;
+    }
+
+    level = level != 0 ? 1 : 0;
+    if (originS < 0.0) {
+      originS = timeS;  // Captures often start at a negative trigger offset
+    }
+    if (edges.empty() || edges.back().level != level) {
+      edges.push_back({static_cast<unsigned long long>((timeS - originS) * 1e6 + 0.5), level});
+    }
+  }
+  return !edges.empty();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FIELD TRACES
+// ═══════════════════════════════════════════════════════════════════════════
+// A device's "trace" partition (include/FieldTrace.h) after
+// tools/trace_import.py: `time_us,kind,channel,value` rows from the start of
+// the recording, kind one of edge, presence, request, decision, gate or
+// dropped. Edges keep the GPIO as channel and are not debounced.
+
+// One request as the gate saw it: sent, answered (or failed), and whether
+// the gate then opened (the allowlist or a schedule can still deny a
+// server accept). Only the last request of a flow, after any retries,
+// ends it with a gate command.
+struct Exchange {
+  unsigned long long requestUs;
+  unsigned long long decisionUs;
+  bool answered;
+  bool accepted;
+  bool ended;
+  bool opened;
+};
+
+struct Marker {
+  unsigned long long timeUs;
+  int value;
+};
+
+struct FieldRecording {
+  std::map<int, std::vector<Edge>> edges;  // By GPIO
+  std::vector<Marker> presence;
+  std::vector<Exchange> exchanges;  // Every finished request, failed ones unanswered
+  std::vector<Marker> gate;
+  unsigned long long endUs = 0;
+  unsigned long dropped = 0;
+};
+
+inline bool loadFieldRecording(const std::string& path, FieldRecording& recording) {
+  std::ifstream in(path);
+  if (!in) {
+    std::fprintf(stderr, "Cannot open field trace %s\n", path.c_str());
+    return false;
+  }
+
+  std::string line;
+  bool pending = false;
+  bool awaitingGate = false;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#' || !std::isdigit(static_cast<unsigned char>(line[0]))) {
+      continue;
+    }
+
+    const size_t first = line.find(',');
+    const size_t second = line.find(',', first + 1);
+    const size_t third = line.find(',', second + 1);
+    if (first == std::string::npos || second == std::string::npos || third == std::string::npos) {
+      std::fprintf(stderr, "Skipping malformed line: %s\n", line.c_str());
+      continue;
+    }
+
+    const unsigned long long timeUs = std::strtoull(line.c_str(), nullptr, 10);
+    const std::string kind = line.substr(first + 1, second - first - 1);
+    const int channel = std::atoi(line.c_str() + second + 1);
+    const int value = std::atoi(line.c_str() + third + 1);
+    recording.endUs = std::max(recording.endUs, timeUs);
+
+    if (kind == "edge") {
+      recording.edges[channel].push_back({timeUs, value != 0 ? 1 : 0});
+    } else if (kind == "presence") {
+      recording.presence.push_back({timeUs, value});
+    } else if (kind == "request") {
+      recording.exchanges.push_back({timeUs, 0, false, false, false, false});
+      pending = true;
+      awaitingGate = false;
+    } else if (kind == "decision" && pending) {
+      recording.exchanges.back().decisionUs = timeUs;
+      // FieldTrace records the DecisionState as the value
+      recording.exchanges.back().answered = value != static_cast<int>(DecisionState::Failed);
+      recording.exchanges.back().accepted = value == static_cast<int>(DecisionState::Accepted);
+      pending = false;
+      awaitingGate = true;
+    } else if (kind == "gate") {
+      recording.gate.push_back({timeUs, value});
+      // The first gate command after an answer is the flow's own
+      if (awaitingGate) {
+        recording.exchanges.back().ended = true;
+        recording.exchanges.back().opened = value != 0;
+        awaitingGate = false;
+      }
+    } else if (kind == "dropped") {
+      recording.dropped += static_cast<unsigned long>(value);
+    }
+  }
+  if (pending) {
+    recording.exchanges.pop_back();  // Recording stopped mid-request
+  }
+  return true;
+}
+
+}  // namespace Sim
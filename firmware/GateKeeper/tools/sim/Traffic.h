@@ -0,0 +1,161 @@
+#pragma once
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SYNTHETIC LANE TRAFFIC (HOST ONLY)
+// ═══════════════════════════════════════════════════════════════════════════
+// Generates a LaneTraffic with known ground truth, for sites with no field
+// recording yet or to stress settings beyond what was recorded:
+//   - vehicles arrive as a Poisson stream, one at a time in the lane, and
+//     stay for a lognormal dwell; a share are not authorized;
+//   - a tailgater is an unauthorized vehicle close behind the previous one;
+//   - a dropout is a gap in the middle of a vehicle (e.g. between a truck
+//     and its trailer) seen by both sensors;
+//   - glitches are short pulses on the LM393 alone (sun, rain, a bird);
+//   - the LM393 bounces on every edge, the loop detector is clean but sees
+//     the vehicle's metal a little after the beam and loses it a little
+//     before;
+//   - the server answers in a lognormal time around a median, and a share
+//     of requests are lost.
+// The same profile and seed always give the same traffic.
+
+#include <cmath>
+#include <random>
+
+#include "LaneReplay.h"
+
+namespace Sim {
+
+struct TrafficProfile {
+  double hours = 4.0;
+  double vehiclesPerHour = 60.0;
+  double authorized = 0.9;         // Share of vehicles the server accepts
+  double tailgate = 0.05;          // Share followed by an unauthorized vehicle
+  double dropout = 0.05;           // Share with a gap mid-vehicle
+  double glitchesPerHour = 20.0;   // LM393-only pulses, 5-60 ms
+  double lostRequests = 0.02;      // Share of requests never answered
+  unsigned long responseMs = 800;  // Median server answer
+  double responseSigma = 0.4;      // Lognormal spread of the answer
+  unsigned long dwellMs = 6000;    // Median time in front of the sensors
+  unsigned long loopLagMs = 150;   // Loop detector behind the beam, both ends
+  unsigned long seed = 1;
+};
+
+namespace TrafficDetail {
+
+constexpr size_t RESPONSES_PER_VEHICLE = 8;
+constexpr unsigned long long BOUNCE_US = 15000;
+
+struct Span {
+  unsigned long long fromUs;
+  unsigned long long toUs;
+};
+
+// Active spans to alternating edges, with a short burst at each LM393 edge
+inline std::vector<Edge> toEdges(std::vector<Span> spans, int activeLevel, bool bounce, std::mt19937& rng) {
+  std::sort(spans.begin(), spans.end(), [](const Span& a, const Span& b) { return a.fromUs < b.fromUs; });
+  std::vector<Span> merged;
+  for (const Span& span : spans) {
+    if (span.toUs <= span.fromUs) {
+      continue;
+    }
+    if (!merged.empty() && span.fromUs <= merged.back().toUs + 2 * BOUNCE_US) {
+      merged.back().toUs = std::max(merged.back().toUs, span.toUs);
+    } else {
+      merged.push_back(span);
+    }
+  }
+
+  std::uniform_int_distribution<int> bounces(0, 4);
+  std::uniform_int_distribution<unsigned long long> offset(200, BOUNCE_US / 5);
+  std::vector<Edge> edges;
+  auto emit = [&](unsigned long long timeUs, int level, unsigned long long roomUs) {
+    const int count = bounce ? bounces(rng) : 0;
+    unsigned long long t = timeUs;
+    for (int i = 0; i < count && t + offset.max() * 2 < timeUs + roomUs; ++i) {
+      edges.push_back({t, level});
+      t += offset(rng);
+      edges.push_back({t, 1 - level});
+      t += offset(rng);
+    }
+    edges.push_back({t, level});
+  };
+  for (const Span& span : merged) {
+    const unsigned long long roomUs = std::min((span.toUs - span.fromUs) / 2, BOUNCE_US);
+    emit(span.fromUs, activeLevel, roomUs);
+    emit(span.toUs, 1 - activeLevel, BOUNCE_US);
+  }
+  return edges;
+}
+
+}  // namespace TrafficDetail
+
+inline LaneTraffic generateTraffic(const TrafficProfile& profile) {
+  using TrafficDetail::Span;
+  std::mt19937 rng(static_cast<std::mt19937::result_type>(profile.seed));
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::exponential_distribution<double> gapS(profile.vehiclesPerHour / 3600.0);
+  std::lognormal_distribution<double> dwellS(std::log(profile.dwellMs / 1000.0), 0.5);
+  std::lognormal_distribution<double> responseMs(std::log(static_cast<double>(profile.responseMs)),
+                                                 profile.responseSigma);
+
+  LaneTraffic traffic;
+  traffic.endUs = static_cast<unsigned long long>(profile.hours * 3.6e9);
+  traffic.emptyResponseMs = profile.responseMs;
+  std::vector<Span> beam;
+  std::vector<Span> loop;
+  const unsigned long long lagUs = profile.loopLagMs * 1000ULL;
+
+  auto addVehicle = [&](unsigned long long arrivalUs, bool authorized) {
+    const unsigned long long dwellUs = static_cast<unsigned long long>(std::max(dwellS(rng), 1.0) * 1e6);
+    Vehicle vehicle{arrivalUs, arrivalUs + dwellUs, authorized, {}};
+    for (size_t i = 0; i < TrafficDetail::RESPONSES_PER_VEHICLE; ++i) {
+      vehicle.responseMs.push_back(uniform(rng) < profile.lostRequests ? NO_ANSWER
+                                                                       : static_cast<unsigned long>(responseMs(rng)));
+    }
+    traffic.vehicles.push_back(vehicle);
+
+    Span body{vehicle.arrivalUs, vehicle.departureUs};
+    if (uniform(rng) < profile.dropout) {
+      // 0.2-1.5 s gap starting in the middle third of the dwell
+      const unsigned long long gapStartUs = body.fromUs + dwellUs / 3 + static_cast<unsigned long long>(
+                                                                            uniform(rng) * dwellUs / 3);
+      const unsigned long long gapUs = static_cast<unsigned long long>((0.2 + 1.3 * uniform(rng)) * 1e6);
+      beam.push_back({body.fromUs, gapStartUs});
+      beam.push_back({std::min(gapStartUs + gapUs, body.toUs), body.toUs});
+      loop.push_back({body.fromUs + lagUs, gapStartUs});
+      loop.push_back({std::min(gapStartUs + gapUs, body.toUs), body.toUs - lagUs});
+    } else {
+      beam.push_back(body);
+      loop.push_back({body.fromUs + lagUs, body.toUs - lagUs});
+    }
+    return vehicle.departureUs;
+  };
+
+  unsigned long long t = 0;
+  while (true) {
+    t += static_cast<unsigned long long>(gapS(rng) * 1e6);
+    if (t >= traffic.endUs) {
+      break;
+    }
+    t = addVehicle(t, uniform(rng) < profile.authorized);
+    if (uniform(rng) < profile.tailgate) {
+      t = addVehicle(t + static_cast<unsigned long long>((0.3 + uniform(rng)) * 1e6), false);
+    }
+    t += 1000000;  // The next one pulls up at least a second later
+  }
+
+  std::exponential_distribution<double> glitchGapS(std::max(profile.glitchesPerHour, 1e-9) / 3600.0);
+  for (double s = glitchGapS(rng); profile.glitchesPerHour > 0 && s * 1e6 < traffic.endUs; s += glitchGapS(rng)) {
+    const unsigned long long fromUs = static_cast<unsigned long long>(s * 1e6);
+    beam.push_back({fromUs, fromUs + static_cast<unsigned long long>((5 + 55 * uniform(rng)) * 1000)});
+  }
+
+  for (const SourcePin& pin : SOURCE_PINS) {
+    const bool isBeam = pin.pin == Config::LM393_SENSOR_PIN;
+    traffic.edges[pin.pin] = TrafficDetail::toEdges(isBeam ? beam : loop, pin.activeLevel, isBeam, rng);
+  }
+  traffic.endUs = std::max(traffic.endUs, t);
+  return traffic;
+}
+
+}  // namespace Sim
@@ -0,0 +1,187 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// DEBOUNCE STRATEGY REPLAY
+// ═══════════════════════════════════════════════════════════════════════════
+// Samples a logic-analyzer capture of the sensor pin the way the firmware
+// loop does and runs every debounce strategy over it. For each strategy it
+// reports detection latency (first raw edge of a bounce burst to debounced edge)
+// against spurious output edges (debounced pulses shorter than a vehicle).
+//
+// Build: g++ -std=c++17 -O2 -I../../include debounce_sim.cpp -o debounce_sim
+// Usage: debounce_sim CAPTURE.csv [--column N] [--sample-ms MS] [--min-pulse-ms MS] [--burst-gap-ms MS]
+//                     [--window MS] [--integrator N] [--assert MS] [--deassert MS]
+//                     [--majority N] [--active-level 0|1]
+
+#include <cstring>
+
+#include "Config.h"
+#include "Debounce.h"
+#include "Trace.h"
+
+namespace {
+
+struct Options {
+  int column = 0;
+  unsigned long sampleMs = Config::LOOP_DELAY_MS;
+  unsigned long minPulseMs = 300;
+  unsigned long burstGapMs = 30;
+  unsigned long windowMs = Config::DEBOUNCE_DELAY_MS;
+  uint8_t integratorSamples = Config::DEBOUNCE_INTEGRATOR_SAMPLES;
+  unsigned long assertMs = Config::DEBOUNCE_ASSERT_MS;
+  unsigned long deassertMs = Config::DEBOUNCE_DEASSERT_MS;
+  uint8_t majoritySamples = Config::DEBOUNCE_MAJORITY_SAMPLES;
+  int activeLevel = 0;
+};
+
+struct Result {
+  std::vector<unsigned long> latenciesMs;
+  size_t outputEdges = 0;
+  size_t spuriousEdges = 0;
+};
+
+int levelAt(const std::vector<Sim::Edge>& edges, size_t& cursor, unsigned long long timeUs) {
+  while (cursor + 1 < edges.size() && edges[cursor + 1].timeUs <= timeUs) {
+    ++cursor;
+  }
+  return edges[cursor].level;
+}
+
+// Start of the raw burst that settled at `level` by `untilUs`: walk back over
+// edges separated by less than the bounce gap.
+unsigned long long burstStartUs(const std::vector<Sim::Edge>& edges, int level,
+                                unsigned long long untilUs, unsigned long long gapUs) {
+  size_t j = edges.size();
+  for (size_t i = 0; i < edges.size() && edges[i].timeUs <= untilUs; ++i) {
+    if (edges[i].level == level) {
+      j = i;
+    }
+  }
+  if (j == edges.size()) {
+    return untilUs;
+  }
+
+  while (j >= 2 && (edges[j].timeUs - edges[j - 1].timeUs) < gapUs) {
+    j -= 2;
+  }
+  return edges[j].timeUs;
+}
+
+Result replay(DebounceStrategy& strategy, const std::vector<Sim::Edge>& edges, const Options& options) {
+  Result result;
+  size_t cursor = 0;
+  strategy.reset(edges.front().level, 0);
+
+  const unsigned long long sampleUs = options.sampleMs * 1000ULL;
+  const unsigned long long endUs = edges.back().timeUs + options.deassertMs * 1000ULL + sampleUs;
+  unsigned long long lastOutputUs = 0;
+  bool havePrevious = false;
+  bool previousSpurious = false;
+
+  for (unsigned long long t = sampleUs; t <= endUs; t += sampleUs) {
+    const int raw = levelAt(edges, cursor, t);
+    if (!strategy.update(raw, static_cast<unsigned long>(t / 1000))) {
+      continue;
+    }
+
+    ++result.outputEdges;
+    const int level = strategy.stableValue();
+    const unsigned long long startUs = burstStartUs(edges, level, t, options.burstGapMs * 1000ULL);
+    result.latenciesMs.push_back(static_cast<unsigned long>((t - startUs) / 1000));
+
+    // Both edges of a short pulse are spurious; with back-to-back short
+    // pulses the edge they share is counted once
+    const bool shortPulse = havePrevious && (t - lastOutputUs) < options.minPulseMs * 1000ULL;
+    if (shortPulse) {
+      result.spuriousEdges += previousSpurious ? 1 : 2;
+    }
+    previousSpurious = shortPulse;
+    havePrevious = true;
+    lastOutputUs = t;
+  }
+  return result;
+}
+
+unsigned long percentile(std::vector<unsigned long> values, double p) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  return values[static_cast<size_t>(p * (values.size() - 1))];
+}
+
+void printResult(const char* label, const Result& result, double hours) {
+  unsigned long long sum = 0;
+  for (unsigned long latency : result.latenciesMs) {
+    sum += latency;
+  }
+  std::printf("%-16s edges=%-6zu spurious=%-6zu spurious/h=%-8.1f latency_ms mean=%-5llu p95=%-5lu max=%lu\n",
+              label, result.outputEdges, result.spuriousEdges, hours > 0 ? result.spuriousEdges / hours : 0.0,
+              result.latenciesMs.empty() ? 0ULL : sum / result.latenciesMs.size(),
+              percentile(result.latenciesMs, 0.95), percentile(result.latenciesMs, 1.0));
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  for (int i = 2; i + 1 < argc; i += 2) {
+    const char* flag = argv[i];
+    const unsigned long value = std::strtoul(argv[i + 1], nullptr, 10);
+    if (std::strcmp(flag, "--column") == 0) {
+      options.column = static_cast<int>(value);
+    } else if (std::strcmp(flag, "--sample-ms") == 0) {
+      options.sampleMs = value > 0 ? value : 1;
+    } else if (std::strcmp(flag, "--min-pulse-ms") == 0) {
+      options.minPulseMs = value;
+    } else if (std::strcmp(flag, "--burst-gap-ms") == 0) {
+      options.burstGapMs = value;
+    } else if (std::strcmp(flag, "--window") == 0) {
+      options.windowMs = value;
+    } else if (std::strcmp(flag, "--integrator") == 0) {
+      options.integratorSamples = static_cast<uint8_t>(value);
+    } else if (std::strcmp(flag, "--assert") == 0) {
+      options.assertMs = value;
+    } else if (std::strcmp(flag, "--deassert") == 0) {
+      options.deassertMs = value;
+    } else if (std::strcmp(flag, "--majority") == 0) {
+      options.majoritySamples = static_cast<uint8_t>(value);
+    } else if (std::strcmp(flag, "--active-level") == 0) {
+      options.activeLevel = value != 0 ? 1 : 0;
+    } else {
+      std::fprintf(stderr, "Unknown option %s\n", flag);
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (argc < 2 || !parseOptions(argc, argv, options)) {
+    std::fprintf(stderr,
+                 "Usage: %s CAPTURE.csv [--column N] [--sample-ms MS] [--min-pulse-ms MS] [--burst-gap-ms MS]\n"
+                 "       [--window MS] [--integrator N] [--assert MS] [--deassert MS]\n"
+                 "       [--majority N] [--active-level 0|1]\n",
+                 argv[0]);
+    return 2;
+  }
+
+  std::vector<Sim::Edge> edges;
+  if (!Sim::loadLogicCapture(argv[1], options.column, edges)) {
+    return 1;
+  }
+
+  const double hours = edges.back().timeUs / 3.6e9;
+  std::printf("capture: %zu raw edges over %.1f s, sampled every %lu ms\n", edges.size() - 1,
+              edges.back().timeUs / 1e6, options.sampleMs);
+
+  RestartWindowDebounce restartWindow(options.windowMs);
+  CounterIntegratorDebounce integrator(options.integratorSamples);
+  AsymmetricDebounce asymmetric(options.assertMs, options.deassertMs);
+  asymmetric.setActiveLevel(options.activeLevel);
+  MajorityDebounce majority(options.majoritySamples);
+
+  printResult("restart-window", replay(restartWindow, edges, options), hours);
+  printResult("integrator", replay(integrator, edges, options), hours);
+  printResult("asymmetric", replay(asymmetric, edges, options), hours);
+  printResult("majority", replay(majority, edges, options), hours);
+  return 0;
+}
@@ -0,0 +1,134 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// FIELD TRACE REPLAY
+// ═══════════════════════════════════════════════════════════════════════════
+// Replays a lane recorded with `trace start` (imported by
+// tools/trace_import.py) through the current debounce and fusion code and
+// compares it with what the gate did at the time: recognitions, opens,
+// failed requests, wait from arrival to gate open, vehicles served per
+// hour, and false opens and denies against the recorded vehicles. Options
+// override the Config values the replay starts from, for "what if" runs;
+// see LaneReplay.h for the model and sweep_sim for searching over them.
+//
+// Build: g++ -std=c++17 -O2 -I../../include lane_sim.cpp -o lane_sim
+// Usage: lane_sim TRACE.csv [--debounce restart|integrator|asymmetric|majority] [--window MS]
+//                 [--integrator N] [--assert MS] [--deassert MS] [--majority N] [--loop-ms MS]
+//                 [--k N] [--min-confidence N] [--align MS] [--timeout MS] [--retries N]
+//                 [--hold-open MS]
+
+#include <cstring>
+
+#include "LaneReplay.h"
+
+namespace {
+
+bool parseDebounceMode(const char* name, Config::DebounceMode& mode) {
+  if (std::strcmp(name, "restart") == 0) {
+    mode = Config::DebounceMode::RestartWindow;
+  } else if (std::strcmp(name, "integrator") == 0) {
+    mode = Config::DebounceMode::Integrator;
+  } else if (std::strcmp(name, "asymmetric") == 0) {
+    mode = Config::DebounceMode::Asymmetric;
+  } else if (std::strcmp(name, "majority") == 0) {
+    mode = Config::DebounceMode::Majority;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool parseOptions(int argc, char** argv, Sim::LaneSettings& settings) {
+  for (int i = 2; i + 1 < argc; i += 2) {
+    const char* flag = argv[i];
+    const char* text = argv[i + 1];
+    const unsigned long value = std::strtoul(text, nullptr, 10);
+    if (std::strcmp(flag, "--debounce") == 0) {
+      if (!parseDebounceMode(text, settings.debounceMode)) {
+        std::fprintf(stderr, "Unknown debounce mode %s\n", text);
+        return false;
+      }
+    } else if (std::strcmp(flag, "--window") == 0) {
+      settings.debounceWindowMs = value;
+    } else if (std::strcmp(flag, "--integrator") == 0) {
+      settings.integratorSamples = static_cast<uint8_t>(value);
+    } else if (std::strcmp(flag, "--assert") == 0) {
+      settings.assertMs = value;
+    } else if (std::strcmp(flag, "--deassert") == 0) {
+      settings.deassertMs = value;
+    } else if (std::strcmp(flag, "--majority") == 0) {
+      settings.majoritySamples = static_cast<uint8_t>(value);
+    } else if (std::strcmp(flag, "--loop-ms") == 0) {
+      settings.loopMs = value > 0 ? value : 1;
+    } else if (std::strcmp(flag, "--k") == 0) {
+      settings.minVotes = static_cast<uint8_t>(value);
+    } else if (std::strcmp(flag, "--min-confidence") == 0) {
+      settings.minConfidence = static_cast<uint16_t>(value);
+    } else if (std::strcmp(flag, "--align") == 0) {
+      settings.alignWindowMs = value;
+    } else if (std::strcmp(flag, "--timeout") == 0) {
+      settings.timeoutMs = value;
+    } else if (std::strcmp(flag, "--retries") == 0) {
+      settings.decisionRetries = static_cast<uint8_t>(value);
+    } else if (std::strcmp(flag, "--hold-open") == 0) {
+      settings.holdOpenMs = value;
+    } else {
+      std::fprintf(stderr, "Unknown option %s\n", flag);
+      return false;
+    }
+  }
+  return true;
+}
+
+void printScore(const char* label, const Sim::LaneScore& score) {
+  std::printf("%-9s recognitions=%-5zu opens=%-5zu failed=%-4zu wait_ms p50=%-6lu p95=%-6lu max=%-6lu "
+              "served/h=%-6.1f false_open=%-3zu false_deny=%zu\n",
+              label, score.recognitions, score.opens, score.failures, Sim::percentile(score.waitsMs, 0.5),
+              score.p95WaitMs(), Sim::percentile(score.waitsMs, 1.0), score.servedPerHour(), score.falseOpens,
+              score.falseDenies);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Sim::LaneSettings settings;
+  if (argc < 2 || !parseOptions(argc, argv, settings)) {
+    std::fprintf(stderr,
+                 "Usage: %s TRACE.csv [--debounce restart|integrator|asymmetric|majority] [--window MS]\n"
+                 "       [--integrator N] [--assert MS] [--deassert MS] [--majority N] [--loop-ms MS]\n"
+                 "       [--k N] [--min-confidence N] [--align MS] [--timeout MS] [--retries N]\n"
+                 "       [--hold-open MS]\n",
+                 argv[0]);
+    return 2;
+  }
+
+  Sim::FieldRecording recording;
+  if (!Sim::loadFieldRecording(argv[1], recording)) {
+    return 1;
+  }
+
+  size_t edges = 0;
+  for (const auto& entry : recording.edges) {
+    if (Sim::findSourcePin(entry.first) == nullptr) {
+      std::fprintf(stderr, "Warning: GPIO %d is not a presence source, ignored\n", entry.first);
+    }
+    edges += entry.second.size();
+  }
+  if (edges == 0) {
+    std::fprintf(stderr, "Trace has no sensor edges\n");
+    return 1;
+  }
+  if (recording.dropped > 0) {
+    std::fprintf(stderr, "Warning: %lu records were dropped on the device; the replay may diverge\n",
+                 recording.dropped);
+  }
+  if (recording.exchanges.empty()) {
+    std::fprintf(stderr, "Warning: no recorded exchanges, every recognition is denied\n");
+  }
+
+  const Sim::LaneTraffic traffic = Sim::trafficFromRecording(recording);
+  std::printf("trace: %.1f min, %zu raw edges, %zu exchanges, %zu vehicles\n", recording.endUs / 6e7, edges,
+              recording.exchanges.size(), traffic.vehicles.size());
+  const Sim::LaneReplay lane(traffic);
+  printScore("recorded", lane.score(Sim::recordedResult(recording)));
+  printScore("replay", lane.score(lane.replay(settings)));
+  return 0;
+}
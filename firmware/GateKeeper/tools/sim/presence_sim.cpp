@@ -0,0 +1,226 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// PRESENCE FUSION REPLAY
+// ═══════════════════════════════════════════════════════════════════════════
+// Replays a recorded presence trace through PresenceFusion and reports how
+// many recognitions each configuration would have triggered, and how many of
+// those were false. Every non-`truth` channel becomes one presence source.
+//
+// Build: g++ -std=c++17 -O2 -I../../include presence_sim.cpp -o presence_sim
+// Usage: presence_sim TRACE.csv [--k N] [--min-confidence N] [--window MS]
+//                     [--tolerance MS] [--source NAME=CONFIDENCE]...
+
+#include <cstring>
+#include <memory>
+
+#include "Config.h"
+#include "PresenceSource.h"
+#include "Trace.h"
+
+namespace {
+
+constexpr size_t MAX_SOURCES = 8;
+
+class TraceSource : public PresenceSource {
+public:
+  TraceSource(const std::string& name, const std::vector<Sim::TraceEvent>& events, uint8_t confidence)
+      : PresenceSource(confidence), name_(name), events_(events) {}
+
+  void initialize() override {
+    cursor_ = 0;
+    present_ = false;
+    markChanged(0);
+  }
+
+  bool update(unsigned long nowMs) override {
+    bool changed = false;
+    while (cursor_ < events_.size() && events_[cursor_].timeMs <= nowMs) {
+      const bool present = events_[cursor_].value != 0;
+      if (present != present_) {
+        present_ = present;
+        markChanged(events_[cursor_].timeMs);
+        changed = true;
+      }
+      ++cursor_;
+    }
+    return changed;
+  }
+
+  bool isPresent() const override {
+    return present_;
+  }
+
+  const char* name() const override {
+    return name_.c_str();
+  }
+
+private:
+  std::string name_;
+  const std::vector<Sim::TraceEvent>& events_;
+  size_t cursor_ = 0;
+  bool present_ = false;
+};
+
+struct FusionSettings {
+  uint8_t minVotes = Config::FUSION_MIN_VOTES;
+  uint16_t minConfidence = Config::FUSION_MIN_CONFIDENCE;
+  unsigned long alignWindowMs = Config::FUSION_ALIGN_WINDOW_MS;
+};
+
+struct Report {
+  size_t vehicles = 0;
+  size_t detected = 0;
+  size_t falseTriggers = 0;
+  size_t duplicateTriggers = 0;
+  size_t recognitions = 0;
+  unsigned long latencySumMs = 0;
+};
+
+uint8_t defaultConfidence(const std::string& name) {
+  if (name == "lm393") return Config::LM393_CONFIDENCE;
+  if (name == "ultrasonic") return Config::ULTRASONIC_CONFIDENCE;
+  if (name == "loop") return Config::LOOP_DETECTOR_CONFIDENCE;
+  if (name == "camera") return Config::CAMERA_MOTION_CONFIDENCE;
+  return 50;
+}
+
+Report replay(const Sim::Trace& trace, const std::vector<std::string>& names,
+              const std::map<std::string, uint8_t>& confidences, const FusionSettings& settings,
+              unsigned long toleranceMs) {
+  std::vector<std::unique_ptr<TraceSource>> sources;
+  PresenceFusion<MAX_SOURCES> fusion(settings.minVotes, settings.minConfidence, settings.alignWindowMs);
+  for (const std::string& name : names) {
+    sources.emplace_back(new TraceSource(name, trace.channels.at(name), confidences.at(name)));
+    fusion.addSource(*sources.back());
+  }
+  fusion.initialize();
+
+  std::vector<unsigned long> times;
+  for (const std::string& name : names) {
+    for (const Sim::TraceEvent& event : trace.channels.at(name)) {
+      times.push_back(event.timeMs);
+    }
+  }
+  std::sort(times.begin(), times.end());
+  times.erase(std::unique(times.begin(), times.end()), times.end());
+
+  std::vector<unsigned long> triggers;
+  for (unsigned long t : times) {
+    if (fusion.update(t) && fusion.isPresent()) {
+      triggers.push_back(t);
+    }
+  }
+
+  const std::vector<Sim::Interval> vehicles = trace.intervals("truth");
+  std::vector<bool> seen(vehicles.size(), false);
+  Report report;
+  report.vehicles = vehicles.size();
+  report.recognitions = triggers.size();
+
+  for (unsigned long t : triggers) {
+    size_t match = vehicles.size();
+    for (size_t i = 0; i < vehicles.size(); ++i) {
+      const unsigned long start = vehicles[i].startMs > toleranceMs ? vehicles[i].startMs - toleranceMs : 0;
+      if (t >= start && t <= vehicles[i].endMs + toleranceMs) {
+        match = i;
+        break;
+      }
+    }
+
+    if (match == vehicles.size()) {
+      ++report.falseTriggers;
+    } else if (seen[match]) {
+      ++report.duplicateTriggers;
+    } else {
+      seen[match] = true;
+      ++report.detected;
+      report.latencySumMs += t > vehicles[match].startMs ? t - vehicles[match].startMs : 0;
+    }
+  }
+  return report;
+}
+
+void printReport(const char* label, const Report& report) {
+  const size_t wasted = report.falseTriggers + report.duplicateTriggers;
+  std::printf("%-28s vehicles=%zu detected=%zu missed=%zu false=%zu duplicate=%zu "
+              "recognitions=%zu wasted=%.1f%% mean_latency_ms=%lu\n",
+              label, report.vehicles, report.detected, report.vehicles - report.detected,
+              report.falseTriggers, report.duplicateTriggers, report.recognitions,
+              report.recognitions ? 100.0 * wasted / report.recognitions : 0.0,
+              report.detected ? report.latencySumMs / report.detected : 0UL);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::fprintf(stderr,
+                 "Usage: %s TRACE.csv [--k N] [--min-confidence N] [--window MS]\n"
+                 "       [--tolerance MS] [--source NAME=CONFIDENCE]...\n",
+                 argv[0]);
+    return 2;
+  }
+
+  Sim::Trace trace;
+  if (!Sim::loadTrace(argv[1], trace)) {
+    return 1;
+  }
+
+  FusionSettings settings;
+  unsigned long toleranceMs = 1000;
+  std::map<std::string, uint8_t> confidences;
+
+  for (int i = 2; i + 1 < argc; i += 2) {
+    const char* flag = argv[i];
+    const char* value = argv[i + 1];
+    if (std::strcmp(flag, "--k") == 0) {
+      settings.minVotes = static_cast<uint8_t>(std::atoi(value));
+    } else if (std::strcmp(flag, "--min-confidence") == 0) {
+      settings.minConfidence = static_cast<uint16_t>(std::atoi(value));
+    } else if (std::strcmp(flag, "--window") == 0) {
+      settings.alignWindowMs = std::strtoul(value, nullptr, 10);
+    } else if (std::strcmp(flag, "--tolerance") == 0) {
+      toleranceMs = std::strtoul(value, nullptr, 10);
+    } else if (std::strcmp(flag, "--source") == 0) {
+      const char* eq = std::strchr(value, '=');
+      if (eq == nullptr) {
+        std::fprintf(stderr, "Expected NAME=CONFIDENCE, got %s\n", value);
+        return 2;
+      }
+      confidences[std::string(value, eq)] = static_cast<uint8_t>(std::atoi(eq + 1));
+    } else {
+      std::fprintf(stderr, "Unknown option %s\n", flag);
+      return 2;
+    }
+  }
+
+  std::vector<std::string> names;
+  for (const auto& entry : trace.channels) {
+    if (entry.first == "truth") {
+      continue;
+    }
+    names.push_back(entry.first);
+    confidences.emplace(entry.first, defaultConfidence(entry.first));
+  }
+
+  if (names.empty() || names.size() > MAX_SOURCES) {
+    std::fprintf(stderr, "Trace must contain 1-%zu source channels\n", MAX_SOURCES);
+    return 1;
+  }
+  if (trace.channels.count("truth") == 0) {
+    std::fprintf(stderr, "Warning: no truth channel, every trigger counts as false\n");
+  }
+
+  FusionSettings single;
+  single.minVotes = 1;
+  single.minConfidence = 0;
+  for (const std::string& name : names) {
+    const std::string label = name + " alone";
+    printReport(label.c_str(), replay(trace, {name}, confidences, single, toleranceMs));
+  }
+
+  char label[64];
+  std::snprintf(label, sizeof(label), "fused k=%u conf>=%u win=%lums", settings.minVotes,
+                settings.minConfidence, settings.alignWindowMs);
+  printReport(label, replay(trace, names, confidences, settings, toleranceMs));
+  return 0;
+}
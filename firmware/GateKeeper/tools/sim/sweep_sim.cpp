@@ -0,0 +1,341 @@
+// ═══════════════════════════════════════════════════════════════════════════
+// SITE TUNING SWEEP
+// ═══════════════════════════════════════════════════════════════════════════
+// Replays one lane's traffic, recorded with `trace start` or generated
+// (Traffic.h), under every combination of debounce window, decision
+// timeout, retry count and hold-open time, on all cores. Each point is
+// scored as in lane_sim: vehicles served per hour, p95 wait from arrival to
+// gate open, and the share of vehicles with a false open or false deny.
+//
+// Prints the Pareto front over those three, and recommends the point with
+// the lowest p95 wait among those within --error-slack of the lowest error
+// rate. --profile writes it as `profile` console lines (SiteProfile.h);
+// paste the file into the serial console to load it on the gate.
+//
+// Build: g++ -std=c++17 -O2 -pthread -I../../include sweep_sim.cpp -o sweep_sim
+// Usage: sweep_sim TRACE.csv|synthetic [--debounce LIST] [--timeout LIST] [--retries LIST]
+//                  [--hold-open LIST] [--error-slack F] [--threads N] [--csv FILE] [--profile FILE]
+//                  [--seed N] [--hours H] [--rate N] [--authorized F] [--tailgate F] [--dropout F]
+//                  [--glitches N] [--lost F] [--response-ms MS]
+// LIST is comma separated, e.g. --debounce 20,50,100. The remaining
+// options shape synthetic traffic.
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#include "Traffic.h"
+
+namespace {
+
+struct Options {
+  const char* source = nullptr;
+  std::vector<unsigned long> debounceMs = {10, 20, 30, 50, 80, 120};
+  std::vector<unsigned long> timeoutMs = {1000, 1500, 2000, 3000, 5000, Config::HTTP_TIMEOUT_MS};
+  std::vector<unsigned long> retries = {0, 1, 2};
+  std::vector<unsigned long> holdOpenMs = {0, 500, 1000, 2000, 3000};
+  double errorSlack = 0.005;
+  unsigned threads = 0;
+  const char* csvPath = nullptr;
+  const char* profilePath = nullptr;
+  Sim::TrafficProfile traffic;
+};
+
+struct Point {
+  Sim::LaneSettings settings;
+  double servedPerHour = 0.0;
+  unsigned long p95WaitMs = 0;
+  double errorRate = 0.0;
+  size_t falseOpens = 0;
+  size_t falseDenies = 0;
+};
+
+bool parseList(const char* text, std::vector<unsigned long>& values) {
+  values.clear();
+  while (*text != '\0') {
+    char* end = nullptr;
+    values.push_back(std::strtoul(text, &end, 10));
+    if (end == text || (*end != ',' && *end != '\0')) {
+      return false;
+    }
+    text = *end == ',' ? end + 1 : end;
+  }
+  return !values.empty();
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  if (argc < 2) {
+    return false;
+  }
+  options.source = argv[1];
+  for (int i = 2; i + 1 < argc; i += 2) {
+    const char* flag = argv[i];
+    const char* text = argv[i + 1];
+    const double value = std::strtod(text, nullptr);
+    bool valid = true;
+    if (std::strcmp(flag, "--debounce") == 0) {
+      valid = parseList(text, options.debounceMs);
+    } else if (std::strcmp(flag, "--timeout") == 0) {
+      valid = parseList(text, options.timeoutMs);
+    } else if (std::strcmp(flag, "--retries") == 0) {
+      valid = parseList(text, options.retries);
+    } else if (std::strcmp(flag, "--hold-open") == 0) {
+      valid = parseList(text, options.holdOpenMs);
+    } else if (std::strcmp(flag, "--error-slack") == 0) {
+      options.errorSlack = value;
+    } else if (std::strcmp(flag, "--threads") == 0) {
+      options.threads = static_cast<unsigned>(value);
+    } else if (std::strcmp(flag, "--csv") == 0) {
+      options.csvPath = text;
+    } else if (std::strcmp(flag, "--profile") == 0) {
+      options.profilePath = text;
+    } else if (std::strcmp(flag, "--seed") == 0) {
+      options.traffic.seed = static_cast<unsigned long>(value);
+    } else if (std::strcmp(flag, "--hours") == 0) {
+      options.traffic.hours = value;
+    } else if (std::strcmp(flag, "--rate") == 0) {
+      options.traffic.vehiclesPerHour = value;
+    } else if (std::strcmp(flag, "--authorized") == 0) {
+      options.traffic.authorized = value;
+    } else if (std::strcmp(flag, "--tailgate") == 0) {
+      options.traffic.tailgate = value;
+    } else if (std::strcmp(flag, "--dropout") == 0) {
+      options.traffic.dropout = value;
+    } else if (std::strcmp(flag, "--glitches") == 0) {
+      options.traffic.glitchesPerHour = value;
+    } else if (std::strcmp(flag, "--lost") == 0) {
+      options.traffic.lostRequests = value;
+    } else if (std::strcmp(flag, "--response-ms") == 0) {
+      options.traffic.responseMs = static_cast<unsigned long>(value);
+    } else {
+      std::fprintf(stderr, "Unknown option %s\n", flag);
+      return false;
+    }
+    if (!valid) {
+      std::fprintf(stderr, "Bad list for %s: %s\n", flag, text);
+      return false;
+    }
+  }
+  for (unsigned long retries : options.retries) {
+    if (retries > 5) {
+      std::fprintf(stderr, "The firmware takes at most 5 retries\n");
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<Point> makeGrid(const Options& options) {
+  std::vector<Point> grid;
+  for (unsigned long debounceMs : options.debounceMs) {
+    for (unsigned long timeoutMs : options.timeoutMs) {
+      for (unsigned long retries : options.retries) {
+        for (unsigned long holdOpenMs : options.holdOpenMs) {
+          Point point;
+          point.settings.debounceMode = Config::DebounceMode::RestartWindow;
+          point.settings.debounceWindowMs = debounceMs;
+          point.settings.timeoutMs = timeoutMs > 0 ? timeoutMs : 1;
+          point.settings.decisionRetries = static_cast<uint8_t>(retries);
+          point.settings.holdOpenMs = holdOpenMs;
+          grid.push_back(point);
+        }
+      }
+    }
+  }
+  return grid;
+}
+
+// Workers take the next unscored point until none are left; results land
+// in the point's own slot, so the output does not depend on scheduling
+void sweep(const Sim::LaneReplay& lane, std::vector<Point>& grid, unsigned threads) {
+  std::atomic<size_t> next{0};
+  auto worker = [&]() {
+    for (size_t i = next.fetch_add(1); i < grid.size(); i = next.fetch_add(1)) {
+      const Sim::LaneScore score = lane.score(lane.replay(grid[i].settings));
+      grid[i].servedPerHour = score.servedPerHour();
+      grid[i].p95WaitMs = score.p95WaitMs();
+      grid[i].errorRate = score.errorRate();
+      grid[i].falseOpens = score.falseOpens;
+      grid[i].falseDenies = score.falseDenies;
+    }
+  };
+  std::vector<std::thread> pool;
+  for (unsigned i = 0; i < threads; ++i) {
+    pool.emplace_back(worker);
+  }
+  for (std::thread& thread : pool) {
+    thread.join();
+  }
+}
+
+bool dominates(const Point& a, const Point& b) {
+  const bool noWorse = a.servedPerHour >= b.servedPerHour && a.p95WaitMs <= b.p95WaitMs &&
+                       a.errorRate <= b.errorRate;
+  const bool better = a.servedPerHour > b.servedPerHour || a.p95WaitMs < b.p95WaitMs ||
+                      a.errorRate < b.errorRate;
+  return noWorse && better;
+}
+
+bool sameScore(const Point& a, const Point& b) {
+  return a.servedPerHour == b.servedPerHour && a.p95WaitMs == b.p95WaitMs && a.errorRate == b.errorRate;
+}
+
+// Of points that score the same, only the first in grid order (the
+// shortest windows and fewest retries) is kept
+std::vector<const Point*> paretoFront(const std::vector<Point>& grid) {
+  std::vector<const Point*> front;
+  for (const Point& candidate : grid) {
+    bool dominated = false;
+    for (const Point& other : grid) {
+      if (dominates(other, candidate) || (&other < &candidate && sameScore(other, candidate))) {
+        dominated = true;
+        break;
+      }
+    }
+    if (!dominated) {
+      front.push_back(&candidate);
+    }
+  }
+  std::stable_sort(front.begin(), front.end(), [](const Point* a, const Point* b) {
+    return a->errorRate != b->errorRate ? a->errorRate < b->errorRate : a->p95WaitMs < b->p95WaitMs;
+  });
+  return front;
+}
+
+const Point* recommend(const std::vector<const Point*>& front, double errorSlack) {
+  double lowestError = 1.0;
+  for (const Point* point : front) {
+    lowestError = std::min(lowestError, point->errorRate);
+  }
+  const Point* best = nullptr;
+  for (const Point* point : front) {
+    if (point->errorRate > lowestError + errorSlack) {
+      continue;
+    }
+    if (best == nullptr || point->p95WaitMs < best->p95WaitMs ||
+        (point->p95WaitMs == best->p95WaitMs && point->servedPerHour > best->servedPerHour)) {
+      best = point;
+    }
+  }
+  return best;
+}
+
+void printPoint(FILE* out, const char* label, const Point& point) {
+  std::fprintf(out, "%-4s debounce_ms=%-4lu timeout_ms=%-6lu retries=%u hold_open_ms=%-5lu  served/h=%-6.1f "
+                    "p95_wait_ms=%-6lu error=%.2f%% (false_open=%zu false_deny=%zu)\n",
+               label, point.settings.debounceWindowMs, point.settings.timeoutMs,
+               static_cast<unsigned>(point.settings.decisionRetries), point.settings.holdOpenMs,
+               point.servedPerHour, point.p95WaitMs, point.errorRate * 100.0, point.falseOpens,
+               point.falseDenies);
+}
+
+void printProfileLine(FILE* out, const Point& point) {
+  std::fprintf(out, "profile debounce_ms=%lu timeout_ms=%lu retries=%u hold_open_ms=%lu\n",
+               point.settings.debounceWindowMs, point.settings.timeoutMs,
+               static_cast<unsigned>(point.settings.decisionRetries), point.settings.holdOpenMs);
+}
+
+bool writeCsv(const char* path, const std::vector<Point>& grid) {
+  FILE* out = std::fopen(path, "w");
+  if (out == nullptr) {
+    std::fprintf(stderr, "Cannot write %s\n", path);
+    return false;
+  }
+  std::fprintf(out, "debounce_ms,timeout_ms,retries,hold_open_ms,served_per_hour,p95_wait_ms,error_rate,"
+                    "false_opens,false_denies\n");
+  for (const Point& point : grid) {
+    std::fprintf(out, "%lu,%lu,%u,%lu,%.2f,%lu,%.5f,%zu,%zu\n", point.settings.debounceWindowMs,
+                 point.settings.timeoutMs, static_cast<unsigned>(point.settings.decisionRetries),
+                 point.settings.holdOpenMs, point.servedPerHour, point.p95WaitMs, point.errorRate,
+                 point.falseOpens, point.falseDenies);
+  }
+  std::fclose(out);
+  return true;
+}
+
+bool writeProfile(const char* path, const char* source, const Point& point) {
+  FILE* out = std::fopen(path, "w");
+  if (out == nullptr) {
+    std::fprintf(stderr, "Cannot write %s\n", path);
+    return false;
+  }
+  std::fprintf(out, "# GateKeeper site profile from sweep_sim on %s\n", source);
+  std::fprintf(out, "# served/h=%.1f p95_wait_ms=%lu error=%.2f%%\n", point.servedPerHour, point.p95WaitMs,
+               point.errorRate * 100.0);
+  std::fprintf(out, "# debounce_ms applies after a reboot\n");
+  printProfileLine(out, point);
+  std::fclose(out);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    std::fprintf(stderr,
+                 "Usage: %s TRACE.csv|synthetic [--debounce LIST] [--timeout LIST] [--retries LIST]\n"
+                 "       [--hold-open LIST] [--error-slack F] [--threads N] [--csv FILE] [--profile FILE]\n"
+                 "       [--seed N] [--hours H] [--rate N] [--authorized F] [--tailgate F] [--dropout F]\n"
+                 "       [--glitches N] [--lost F] [--response-ms MS]\n",
+                 argv[0]);
+    return 2;
+  }
+
+  Sim::LaneTraffic traffic;
+  if (std::strcmp(options.source, "synthetic") == 0) {
+    traffic = Sim::generateTraffic(options.traffic);
+  } else {
+    Sim::FieldRecording recording;
+    if (!Sim::loadFieldRecording(options.source, recording)) {
+      return 1;
+    }
+    traffic = Sim::trafficFromRecording(recording);
+  }
+  if (traffic.vehicles.empty()) {
+    std::fprintf(stderr, "Traffic has no vehicles\n");
+    return 1;
+  }
+  if (Config::DEBOUNCE_MODE != Config::DebounceMode::RestartWindow) {
+    std::fprintf(stderr, "Warning: DEBOUNCE_MODE is not RestartWindow, the firmware ignores debounce_ms\n");
+  }
+
+  std::vector<Point> grid = makeGrid(options);
+  const unsigned threads = options.threads > 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+  std::printf("traffic: %s, %.1f h, %zu vehicles; %zu settings on %u threads\n", options.source,
+              traffic.endUs / 3.6e9, traffic.vehicles.size(), grid.size(), threads);
+
+  const Sim::LaneReplay lane(traffic);
+  sweep(lane, grid, threads);
+  if (options.csvPath != nullptr && !writeCsv(options.csvPath, grid)) {
+    return 1;
+  }
+
+  Point current;  // Config defaults, no profile
+  const Sim::LaneScore score = lane.score(lane.replay(current.settings));
+  current.servedPerHour = score.servedPerHour();
+  current.p95WaitMs = score.p95WaitMs();
+  current.errorRate = score.errorRate();
+  current.falseOpens = score.falseOpens;
+  current.falseDenies = score.falseDenies;
+
+  const std::vector<const Point*> front = paretoFront(grid);
+  std::printf("\nPareto front (%zu of %zu):\n", front.size(), grid.size());
+  for (const Point* point : front) {
+    printPoint(stdout, "", *point);
+  }
+  std::printf("\n");
+  printPoint(stdout, "cfg", current);
+  const Point* best = recommend(front, options.errorSlack);
+  printPoint(stdout, "best", *best);
+  std::printf("\n");
+  printProfileLine(stdout, *best);
+
+  if (options.profilePath != nullptr) {
+    if (!writeProfile(options.profilePath, options.source, *best)) {
+      return 1;
+    }
+    std::printf("Wrote %s\n", options.profilePath);
+  }
+  return 0;
+}
@@ -0,0 +1,126 @@
+"""
+Convert a GateKeeper field trace into the simulator's CSV format.
+
+Record on the gate with `trace start` ... `trace stop`, read the partition
+back and import it:
+
+    python -m esptool --chip esp32 read_flash 0x2F0000 0x40000 trace.bin
+    python tools/trace_import.py trace.bin -o lane.csv
+    tools/sim/lane_sim lane.csv --window 30
+
+The record layout is documented in include/FieldTrace.h, and the
+partition offset and size come from partitions.csv. micros() wraps every
+71 minutes, so times are unwrapped on the way and written relative to the
+start of the recording. Edge rows keep the GPIO in the channel column.
+"""
+
+import argparse
+import logging
+import struct
+import sys
+from pathlib import Path
+
+logger = logging.getLogger(__name__)
+
+FORMAT_VERSION = 1
+RECORD = struct.Struct("<IBBH")
+ERASED_KIND = 0xFF
+KINDS = {1: "start", 2: "edge", 3: "presence", 4: "request", 5: "decision", 6: "gate", 7: "dropped"}
+WRAP = 1 << 32
+
+DEFAULT_PARTITIONS = Path(__file__).resolve().parent.parent / "partitions.csv"
+
+
+def find_partition(partitions_path, name):
+    """
+    Look up (offset, size) of a partition in a PlatformIO partitions.csv
+    """
+    with open(partitions_path, encoding="utf-8") as handle:
+        for line in handle:
+            fields = [field.strip() for field in line.split("#", 1)[0].split(",")]
+            if len(fields) >= 5 and fields[0] == name:
+                return int(fields[3], 0), int(fields[4], 0)
+    return None
+
+
+def parse_records(image):
+    """
+    Decode records up to the first erased one
+
+    Returns:
+        List of (time_us, kind name, channel, value), unwrapped, sorted and
+        relative to the start record
+    """
+    if len(image) < RECORD.size:
+        raise ValueError("Image holds no records")
+    first = RECORD.unpack_from(image, 0)
+    if KINDS.get(first[1]) != "start":
+        raise ValueError("Image does not begin with a start record; was `trace start` run?")
+    if first[3] != FORMAT_VERSION:
+        raise ValueError(f"Trace format {first[3]}, this importer reads {FORMAT_VERSION}")
+
+    records = []
+    epoch = 0
+    previous = first[0]
+    for offset in range(0, len(image) - RECORD.size + 1, RECORD.size):
+        time_us, kind, channel, value = RECORD.unpack_from(image, offset)
+        if kind == ERASED_KIND:
+            break
+        if kind not in KINDS:
+            logger.warning(f"Unknown record kind {kind} at offset 0x{offset:x}, skipped")
+            continue
+        # ISR records can land slightly out of order, so only a large
+        # backwards step is a wrap
+        if time_us < previous and previous - time_us > WRAP // 2:
+            epoch += WRAP
+        elif time_us > previous and time_us - previous > WRAP // 2:
+            epoch -= WRAP
+        previous = time_us
+        records.append((epoch + time_us - first[0], KINDS[kind], channel, value))
+
+    records.sort(key=lambda record: record[0])
+    return records
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("image", help="trace partition read back with esptool read_flash")
+    parser.add_argument("-o", "--output", default="lane.csv", help="simulator trace to write")
+    parser.add_argument("--partitions", default=str(DEFAULT_PARTITIONS), help="partition table to check against")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format="%(levelname)s - %(message)s")
+
+    image = Path(args.image).read_bytes()
+    partition = find_partition(args.partitions, "trace")
+    if partition is not None and len(image) != partition[1]:
+        logger.warning(f"Image is {len(image)} bytes, the trace partition {partition[1]}; "
+                       f"read it with read_flash 0x{partition[0]:X} 0x{partition[1]:X}")
+
+    try:
+        records = parse_records(image)
+    except ValueError as error:
+        logger.error(error)
+        return 1
+
+    with open(args.output, "w", encoding="utf-8") as handle:
+        handle.write(f"# gatekeeper-field-trace v{FORMAT_VERSION} from {Path(args.image).name}\n")
+        handle.write("time_us,kind,channel,value\n")
+        for time_us, kind, channel, value in records:
+            if kind != "start":
+                handle.write(f"{time_us},{kind},{channel},{value}\n")
+
+    counts = {}
+    for _, kind, _, value in records:
+        counts[kind] = counts.get(kind, 0) + (value if kind == "dropped" else 1)
+    duration_s = records[-1][0] / 1e6
+    logger.info(f"{len(records)} records over {duration_s:.1f} s: "
+                + ", ".join(f"{kind} {count}" for kind, count in sorted(counts.items()) if kind != "start"))
+    if counts.get("dropped"):
+        logger.warning(f"{counts['dropped']} records were dropped on the device (queue full)")
+    logger.info(f"Wrote {args.output}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
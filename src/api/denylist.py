@@ -0,0 +1,296 @@
+"""
+Server side of the firmware denylist (stolen or banned vehicles).
+
+The gates hold the list as binary fuse filters split into shards
+(firmware/GateKeeper/include/DenylistImage.h and FuseFilter.h). This module
+builds those shards from a plain list of plates, serves them for sync, and
+confirms the gates' alerts against the exact list, since a filter hit is
+only probable.
+
+A shard's generation is the CRC of its sorted plates, so after the list
+file changes only the shards whose plates changed are rebuilt and
+downloaded again.
+"""
+
+import logging
+import math
+import os
+import struct
+import threading
+import zlib
+
+logger = logging.getLogger(__name__)
+
+SHARD_BYTES = 4096
+SHARD_MAGIC = 0x53444B47  # "GKDS"
+MANIFEST_MAGIC = 0x4D444B47  # "GKDM"
+SHARD_SALT = 0x5348415244
+SHARD_HEADER = struct.Struct("<IIIIQII")
+MANIFEST_HEADER = struct.Struct("<IIII")
+MAX_FINGERPRINTS = SHARD_BYTES - SHARD_HEADER.size
+MAX_SEGMENT_LENGTH = 1 << 18
+MAX_PLATE_CHARS = 12
+MASK64 = (1 << 64) - 1
+
+
+def pack_plate(text):
+    """
+    Pack a plate into a PlateId (firmware/GateKeeper/include/PlateId.h)
+
+    Returns:
+        The 64-bit ID, or None if the plate has no characters or more than 12
+    """
+    digits = []
+    for ch in text.upper():
+        if "0" <= ch <= "9":
+            digits.append(1 + ord(ch) - ord("0"))
+        elif "A" <= ch <= "Z":
+            digits.append(11 + ord(ch) - ord("A"))
+    if not digits or len(digits) > MAX_PLATE_CHARS:
+        return None
+
+    plate_id = 0
+    for digit in digits + [0] * (MAX_PLATE_CHARS - len(digits)):
+        plate_id = plate_id * 37 + digit
+    return plate_id
+
+
+def mix(h):
+    """
+    murmur3 fmix64, FuseFilter::mix()
+    """
+    h ^= h >> 33
+    h = (h * 0xFF51AFD7ED558CCD) & MASK64
+    h ^= h >> 33
+    h = (h * 0xC4CEB9FE1A85EC53) & MASK64
+    h ^= h >> 33
+    return h
+
+
+def splitmix(state):
+    """
+    Returns:
+        (next state, output), FuseFilter::splitmix()
+    """
+    state = (state + 0x9E3779B97F4A7C15) & MASK64
+    z = state
+    z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & MASK64
+    z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & MASK64
+    return state, z ^ (z >> 31)
+
+
+def shard_of(plate_id, shard_count):
+    return (mix(plate_id ^ SHARD_SALT) * shard_count) >> 64
+
+
+def fuse_size(n):
+    """
+    Returns:
+        (segment length, segment count) for n keys, FuseFilter::sizeFor()
+    """
+    log_n = math.log(n) if n > 1 else 0.0
+    segment_length = min(1 << int(math.floor(log_n / math.log(3.33) + 2.25)), MAX_SEGMENT_LENGTH)
+    size_factor = max(1.125, 0.875 + 0.25 * math.log(1e6) / log_n) if n > 1 else 0.0
+    capacity = int(round(n * size_factor))
+    segments = (capacity + segment_length - 1) // segment_length - 2
+    return segment_length, max(segments, 1)
+
+
+def fuse_slots(h, segment_length, segment_count):
+    mask = segment_length - 1
+    h0 = (h * segment_count * segment_length) >> 64
+    h1 = (h0 + segment_length) ^ ((h >> 18) & mask)
+    h2 = (h0 + 2 * segment_length) ^ (h & mask)
+    return h0, h1, h2
+
+
+def fuse_fingerprint(h):
+    return (h ^ (h >> 32)) & 0xFF
+
+
+def build_fuse(keys, seed_state, attempts=64):
+    """
+    Build a binary fuse filter over distinct keys, FuseFilter::build()
+
+    Returns:
+        (seed, segment length, segment count, fingerprints bytearray)
+    """
+    segment_length, segment_count = fuse_size(len(keys))
+    length = (segment_count + 2) * segment_length
+    for _ in range(attempts):
+        seed_state, seed = splitmix(seed_state)
+        counts = [0] * length
+        hashes = [0] * length
+        key_slots = {}
+        for key in keys:
+            h = mix((key + seed) & MASK64)
+            slots = fuse_slots(h, segment_length, segment_count)
+            key_slots[h] = slots
+            for slot in slots:
+                counts[slot] += 1
+                hashes[slot] ^= h
+
+        queue = [slot for slot in range(length) if counts[slot] == 1]
+        peeled = []
+        while queue:
+            slot = queue.pop()
+            if counts[slot] != 1:
+                continue
+            h = hashes[slot]
+            peeled.append((h, slot))
+            for other in key_slots[h]:
+                counts[other] -= 1
+                hashes[other] ^= h
+                if counts[other] == 1:
+                    queue.append(other)
+        if len(peeled) != len(keys):
+            continue
+
+        fingerprints = bytearray(length)
+        for h, slot in reversed(peeled):
+            a, b, c = key_slots[h]
+            fingerprints[slot] = fuse_fingerprint(h) ^ fingerprints[a] ^ fingerprints[b] ^ fingerprints[c]
+        return seed, segment_length, segment_count, fingerprints
+    raise ValueError("no seed peeled the filter")
+
+
+def fuse_contains(seed, segment_length, segment_count, fingerprints, key):
+    h = mix((key + seed) & MASK64)
+    a, b, c = fuse_slots(h, segment_length, segment_count)
+    return fuse_fingerprint(h) ^ fingerprints[a] ^ fingerprints[b] ^ fingerprints[c] == 0
+
+
+def build_shard(plate_ids):
+    """
+    Serialize one shard (header and fingerprints)
+
+    Returns:
+        (generation, shard bytes); (0, b"") for an empty shard
+    """
+    if not plate_ids:
+        return 0, b""
+    keys = sorted(plate_ids)
+    generation = zlib.crc32(struct.pack(f"<{len(keys)}Q", *keys)) or 1
+    seed, segment_length, segment_count, fingerprints = build_fuse(keys, generation)
+    if len(fingerprints) > MAX_FINGERPRINTS:
+        raise ValueError(f"{len(keys)} plates do not fit in one {SHARD_BYTES}-byte shard")
+    missing = sum(1 for key in keys if not fuse_contains(seed, segment_length, segment_count, fingerprints, key))
+    if missing:
+        raise ValueError(f"self-check failed for {missing} plates")
+    header = SHARD_HEADER.pack(
+        SHARD_MAGIC, generation, len(keys), zlib.crc32(fingerprints), seed, segment_length, segment_count
+    )
+    return generation, header + bytes(fingerprints)
+
+
+class Denylist:
+    """
+    Exact denylist plus the filter shards served to the gates
+
+    Args:
+        path: Text file with one plate per line ('#' starts a comment)
+        shard_count: Must match the firmware's Config::DENYLIST_SHARDS
+    """
+
+    def __init__(self, path, shard_count):
+        self.path = path
+        self.shard_count = shard_count
+        self.lock = threading.Lock()
+        self.mtime = None
+        self.plates = set()
+        self.shards = [(0, b"")] * shard_count
+        self.listeners = []
+
+    def refresh(self):
+        """Reload the list if the file changed; rebuild only changed shards"""
+        try:
+            mtime = os.stat(self.path).st_mtime
+        except FileNotFoundError:
+            mtime = None
+        with self.lock:
+            if mtime == self.mtime:
+                return
+            self.mtime = mtime
+
+        plates = set()
+        if mtime is not None:
+            with open(self.path, encoding="utf-8") as handle:
+                for line in handle:
+                    plate_id = pack_plate(line.split("#", 1)[0].strip())
+                    if plate_id is not None:
+                        plates.add(plate_id)
+
+        buckets = [[] for _ in range(self.shard_count)]
+        for plate_id in plates:
+            buckets[shard_of(plate_id, self.shard_count)].append(plate_id)
+
+        shards = list(self.shards)
+        rebuilt = 0
+        try:
+            for index, bucket in enumerate(buckets):
+                generation = zlib.crc32(struct.pack(f"<{len(bucket)}Q", *sorted(bucket))) or 1 if bucket else 0
+                if generation != shards[index][0]:
+                    shards[index] = build_shard(bucket)
+                    rebuilt += 1
+        except ValueError as e:
+            logger.error(f"Denylist not updated: {e}")
+            return
+
+        with self.lock:
+            self.plates = plates
+            self.shards = shards
+        logger.info(f"Denylist: {len(plates)} plates, {rebuilt} of {self.shard_count} shards rebuilt")
+
+    def manifest(self, schedule_generation=0):
+        """
+        Args:
+            schedule_generation: Access schedule generation the gates compare
+                against theirs (0: no schedule), see src/api/schedule.py
+        """
+        with self.lock:
+            generations = [generation for generation, _ in self.shards]
+            count = len(self.plates)
+        return MANIFEST_HEADER.pack(MANIFEST_MAGIC, self.shard_count, count, schedule_generation) + struct.pack(
+            f"<{self.shard_count}I", *generations
+        )
+
+    def shard(self, index):
+        with self.lock:
+            return self.shards[index][1]
+
+    def stats(self):
+        """
+        Returns:
+            Dict with plate count, filter bytes and bits per plate
+        """
+        with self.lock:
+            plates = len(self.plates)
+            filter_bytes = sum(len(data) for _, data in self.shards)
+        return {
+            "plates": plates,
+            "filter_bytes": filter_bytes,
+            "bits_per_plate": filter_bytes * 8 / plates if plates else 0.0,
+            "false_positive_rate": 1 / 256,
+        }
+
+    def confirm(self, gate, plate):
+        """
+        Check a gate's alert against the exact list and notify listeners
+
+        Returns:
+            True if the plate is listed
+        """
+        plate_id = pack_plate(plate)
+        with self.lock:
+            listed = plate_id is not None and plate_id in self.plates
+        if not listed:
+            logger.info(f"Denylist alert from {gate} for {plate} was a filter false positive")
+            return False
+
+        logger.warning(f"DENYLISTED VEHICLE at {gate}: {plate}")
+        for listener in self.listeners:
+            try:
+                listener(gate, plate)
+            except Exception as e:
+                logger.error(f"Denylist alert listener failed: {e}")
+        return True
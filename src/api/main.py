@@ -1,10 +1,15 @@
-import os, logging, cv2
+import os, logging, time, asyncio, threading, cv2
 from io import BytesIO
 from fastapi import FastAPI, File, UploadFile, HTTPException
-from fastapi.responses import JSONResponse
+from fastapi.responses import JSONResponse, Response
 import uvicorn
+from config import settings
 from src.core.detector import LicensePlateDetector
 from src.core.ocr_reader import OCRReader
+from src.api.denylist import Denylist
+from src.api.mqtt_bridge import DecisionBridge
+from src.api.schedule import Schedule
+from src.api.udp_server import DecisionServerProtocol
 
 logging.basicConfig(
     level=logging.INFO, format="%(asctime)s - %(name)s - %(levelname)s - %(message)s"
@@ -23,6 +28,16 @@ CAMERA_ID = 2
 FRAME_WIDTH = 1920
 FRAME_HEIGHT = 1080
 
+# Fixed plate returned without using the camera (for transport benchmarks)
+STUB_PLATE = settings.LPR_STUB_PLATE
+
+# Stolen or banned vehicles, served to the gates as filter shards
+DENYLIST_REFRESH_S = 30
+denylist = Denylist(settings.DENYLIST_PATH, settings.DENYLIST_SHARDS)
+
+# Time windows per allowlist profile, synced to the gates with the denylist
+schedule = Schedule(settings.SCHEDULE_PATH)
+
 
 def capture_image_from_camera():
     """Capture a single frame from the camera"""
@@ -59,54 +74,177 @@ def capture_image_from_camera():
         return None
 
 
-@app.get("/lpr")
-async def recognize_license_plate_from_camera():
+# One camera: recognitions for HTTP, UDP and MQTT run one at a time
+recognize_lock = threading.Lock()
+
+
+def recognize_from_camera():
     """
-    Capture image from camera, detect license plate, and perform OCR.
-    Returns: {"plate": "plate_text", "status": True} if detected, else {"status": False}
+    Capture a frame, detect the plate and run OCR. Blocks for seconds; safe
+    to call from several threads.
+    Returns: ({"plate": "plate_text", "status": True} or {"status": False},
+              {"capture": ms, "detect": ms, "ocr": ms})
     """
+    with recognize_lock:
+        return _recognize_from_camera()
+
+
+def _recognize_from_camera():
+    timings = {"capture": 0, "detect": 0, "ocr": 0}
+
+    # Stand-in mode for transport benchmarks: no camera, no model
+    if STUB_PLATE:
+        return {"plate": STUB_PLATE, "status": True}, timings
+
     try:
         # Step 1: Capture image from camera
         logger.info("Triggering license plate recognition from camera")
+        started = time.perf_counter()
         frame = capture_image_from_camera()
+        timings["capture"] = _elapsed_ms(started)
 
         if frame is None:
             logger.warning("Failed to capture image from camera")
-            return {"status": False}
+            return {"status": False}, timings
 
         # Step 2: Convert frame to bytes for detector
         ret, buffer = cv2.imencode(".jpg", frame)
         if not ret:
             logger.error("Failed to encode captured image")
-            return {"status": False}
+            return {"status": False}, timings
 
         image_bytes = buffer.tobytes()
 
         # Step 3: Detect license plate
         logger.info("Detecting license plate...")
+        started = time.perf_counter()
         cropped_plate = detector.detect_and_crop(image_bytes)
+        timings["detect"] = _elapsed_ms(started)
 
         if cropped_plate is None:
             logger.warning("No license plate detected in captured image")
-            return {"status": False}
+            return {"status": False}, timings
 
         # Step 4: Perform OCR
         logger.info("Performing OCR on detected plate...")
+        started = time.perf_counter()
         plate_text = ocr.read_text(cropped_plate)
+        timings["ocr"] = _elapsed_ms(started)
 
         if not plate_text:
             logger.warning("Could not read text from license plate")
-            return {"status": False}
+            return {"status": False}, timings
 
         # Step 5: Clean and format plate text
         plate_text = "".join(ch for ch in plate_text if ch.isalnum()).upper()
         logger.info(f"Successfully recognized license plate: {plate_text}")
 
-        return {"plate": plate_text, "status": True}
+        return {"plate": plate_text, "status": True}, timings
 
     except Exception as e:
         logger.error(f"Error processing request: {str(e)}")
-        return {"status": False}
+        return {"status": False}, timings
+
+
+def _elapsed_ms(started):
+    return int((time.perf_counter() - started) * 1000)
+
+
+@app.get("/lpr")
+async def recognize_license_plate_from_camera():
+    """
+    Capture image from camera, detect license plate, and perform OCR.
+    Returns: {"plate": "plate_text", "status": True} if detected, else {"status": False}
+    """
+    # Off the event loop, which also serves the UDP protocol
+    result, _ = await asyncio.to_thread(recognize_from_camera)
+    return result
+
+
+@app.on_event("startup")
+async def start_udp_decision_server():
+    """Serve the firmware's UDP decision protocol when UDP_DECISION_KEY is set"""
+    key = settings.UDP_DECISION_KEY
+    if not key:
+        return
+
+    port = settings.UDP_DECISION_PORT
+    loop = asyncio.get_running_loop()
+    await loop.create_datagram_endpoint(
+        lambda: DecisionServerProtocol(key.encode(), recognize_from_camera),
+        local_addr=("0.0.0.0", port),
+    )
+    logger.info(f"UDP decision protocol listening on port {port}")
+
+
+@app.on_event("startup")
+async def start_mqtt_bridge():
+    """Answer MQTT triggers when MQTT_BROKER is set"""
+    host = settings.MQTT_BROKER
+    if not host:
+        return
+
+    DecisionBridge(
+        host,
+        settings.MQTT_PORT,
+        recognize_from_camera,
+        settings.MQTT_USERNAME,
+        settings.MQTT_PASSWORD,
+        denylist,
+    ).start()
+
+
+@app.on_event("startup")
+async def start_denylist_refresh():
+    """Rebuild the denylist shards and the schedule whenever their files change"""
+
+    async def refresh_forever():
+        while True:
+            try:
+                await asyncio.to_thread(denylist.refresh)
+                await asyncio.to_thread(schedule.refresh)
+            except Exception as e:
+                logger.error(f"Denylist refresh failed: {str(e)}")
+            await asyncio.sleep(DENYLIST_REFRESH_S)
+
+    asyncio.create_task(refresh_forever())
+
+
+@app.get("/denylist/manifest")
+def denylist_manifest():
+    """Generation of every shard and of the schedule; the gates download what differs"""
+    return Response(content=denylist.manifest(schedule.generation()), media_type="application/octet-stream")
+
+
+@app.get("/denylist/shard/{index}")
+def denylist_shard(index: int):
+    """One shard as the firmware stores it; empty for a shard with no plates"""
+    if not 0 <= index < denylist.shard_count:
+        raise HTTPException(status_code=404, detail="No such shard")
+    return Response(content=denylist.shard(index), media_type="application/octet-stream")
+
+
+@app.get("/schedule")
+def access_schedule():
+    """Compiled access schedule (src/api/schedule.py); 404 when there is none"""
+    data = schedule.image()
+    if not data:
+        raise HTTPException(status_code=404, detail="No schedule")
+    return Response(content=data, media_type="application/octet-stream")
+
+
+@app.get("/denylist/alert")
+def denylist_alert(gate: str, plate: str):
+    """
+    Probable denylist hit reported by a gate; confirmed against the exact list.
+    Returns: {"listed": True} for a listed plate, {"listed": False} for a filter false positive
+    """
+    return {"listed": denylist.confirm(gate, plate)}
+
+
+@app.get("/denylist/stats")
+def denylist_stats():
+    return denylist.stats()
 
 
 @app.post("/lpr/upload")
@@ -139,4 +277,14 @@ async def recognize_license_plate_from_upload(file: UploadFile = File(...)):
 
 
 if __name__ == "__main__":
-    uvicorn.run("main:app", host="0.0.0.0", port=8000, reload=True)
+    # Set API_SSL_CERTFILE and API_SSL_KEYFILE to serve HTTPS. The firmware
+    # keeps its connection open, so idle keep-alive is longer than uvicorn's 5 s.
+    uvicorn.run(
+        "main:app",
+        host="0.0.0.0",
+        port=8000,
+        reload=True,
+        ssl_certfile=settings.API_SSL_CERTFILE,
+        ssl_keyfile=settings.API_SSL_KEYFILE,
+        timeout_keep_alive=settings.API_KEEPALIVE_S,
+    )
@@ -0,0 +1,123 @@
+"""
+MQTT side of the decision transport.
+
+Subscribes to gatekeeper/+/trigger and answers every trigger on
+gatekeeper/<gate>/decision with {"id", "plate", "status"}. The topic layout
+is documented in firmware/GateKeeper/include/MqttDecisionTransport.h.
+Triggers are QoS 1, so a redelivered trigger can arrive; it gets the cached
+decision instead of a second recognition.
+
+Gates also publish probable denylist hits on gatekeeper/<gate>/alert (the
+plate as text). Each is checked against the exact list, and a confirmed hit
+is republished on gatekeeper/<gate>/alert/confirmed for operators.
+"""
+
+import collections
+import json
+import logging
+import threading
+
+import paho.mqtt.client as mqtt
+
+logger = logging.getLogger(__name__)
+
+TRIGGER_TOPIC = "gatekeeper/+/trigger"
+ALERT_TOPIC = "gatekeeper/+/alert"
+CACHE_SIZE = 64
+
+
+class DecisionBridge:
+    """
+    Connects to the broker and serves decisions
+
+    Args:
+        host: Broker host
+        port: Broker port
+        recognize: Blocking callable returning (result dict, timings dict);
+            it runs on a thread per trigger, so it must serialize access to
+            the camera itself
+        username: Optional broker username
+        password: Optional broker password
+        denylist: Optional src.api.denylist.Denylist that confirms alerts
+    """
+
+    def __init__(self, host, port, recognize, username=None, password=None, denylist=None):
+        self.host = host
+        self.port = port
+        self.recognize = recognize
+        self.denylist = denylist
+        self.answers = collections.OrderedDict()
+        self.lock = threading.Lock()
+
+        self.client = mqtt.Client(
+            mqtt.CallbackAPIVersion.VERSION2, client_id="gatekeeper-api", clean_session=False
+        )
+        if username:
+            self.client.username_pw_set(username, password)
+        self.client.on_connect = self._on_connect
+        self.client.on_message = self._on_message
+        if denylist is not None:
+            denylist.listeners.append(self._publish_alert)
+
+    def start(self):
+        """Connect and run the network loop in a background thread"""
+        self.client.connect_async(self.host, self.port, keepalive=30)
+        self.client.loop_start()
+        logger.info(f"MQTT bridge connecting to {self.host}:{self.port}")
+
+    def stop(self):
+        self.client.loop_stop()
+        self.client.disconnect()
+
+    def _on_connect(self, client, userdata, flags, reason_code, properties):
+        if reason_code.is_failure:
+            logger.error(f"MQTT connection refused: {reason_code}")
+            return
+        client.subscribe(TRIGGER_TOPIC, qos=1)
+        if self.denylist is not None:
+            client.subscribe(ALERT_TOPIC, qos=1)
+        logger.info("MQTT bridge subscribed to triggers")
+
+    def _on_message(self, client, userdata, message):
+        gate = message.topic.split("/")[1]
+        if message.topic.endswith("/alert"):
+            # Publishes the confirmation through the listener
+            self.denylist.confirm(gate, message.payload.decode("ascii", "replace"))
+            return
+        try:
+            request_id = int(json.loads(message.payload)["id"])
+        except (ValueError, KeyError, TypeError):
+            logger.warning(f"Ignoring malformed trigger from {gate}: {message.payload!r}")
+            return
+
+        key = (gate, request_id)
+        with self.lock:
+            if key in self.answers:
+                cached = self.answers[key]
+                # A duplicate during recognition is answered when it finishes
+                if cached is not None:
+                    self._publish(gate, cached)
+                return
+            self.answers[key] = None
+
+        # Recognition blocks for seconds; keep the network loop responsive
+        threading.Thread(target=self._answer, args=(key,), daemon=True).start()
+
+    def _answer(self, key):
+        gate, request_id = key
+        result, _timings = self.recognize()
+        decision = {"id": request_id, **result}
+        with self.lock:
+            self.answers[key] = decision
+            while len(self.answers) > CACHE_SIZE:
+                self.answers.popitem(last=False)
+        logger.info(f"MQTT decision for {gate}: {decision}")
+        self._publish(gate, decision)
+
+    def _publish(self, gate, decision):
+        self.client.publish(f"gatekeeper/{gate}/decision", json.dumps(decision), qos=1)
+
+    def _publish_alert(self, gate, plate):
+        self.client.publish(
+            f"gatekeeper/{gate}/alert/confirmed", json.dumps({"gate": gate, "plate": plate}), qos=1
+        )
@@ -0,0 +1,219 @@
+"""
+Access schedules compiled for the gate firmware.
+
+Plates in the allowlist image carry a profile number
+(firmware/GateKeeper/tools/allowlist_image.py). This module compiles the
+profiles' weekly time windows and the dated overrides into the binary
+schedule the gates sync and evaluate offline
+(firmware/GateKeeper/include/ScheduleImage.h). Editing hours or holidays
+only changes this schedule, never the allowlist image.
+
+The source is a JSON file:
+
+    {
+      "profiles": [
+        {"id": 1, "name": "staff",
+         "windows": [{"days": ["mon", "tue", "wed", "thu", "fri"], "from": "07:00", "to": "19:00"}]},
+        {"id": 2, "name": "contractors",
+         "windows": [{"days": ["tue", "thu"], "from": "08:00", "to": "17:00"}]}
+      ],
+      "overrides": [
+        {"date": "2026-12-25", "as": "sun"},
+        {"date": "2026-12-24", "profiles": [2], "as": "closed"}
+      ]
+    }
+
+Times are the gate's local time in 15-minute steps; "to" may be "24:00",
+and a window whose end is before its start runs past midnight. An override
+without "profiles" applies to all of them; "as" is a weekday, "closed" or
+"open". When two overrides name the same profile on one date, the first
+one listed wins.
+
+Run as a script, it writes the compiled schedule to a file, e.g. for
+firmware/GateKeeper/tools/bench/schedule_bench.cpp.
+"""
+
+import argparse
+import datetime
+import json
+import logging
+import os
+import struct
+import sys
+import threading
+import zlib
+
+logger = logging.getLogger(__name__)
+
+MAGIC = 0x43534B47  # "GKSC"
+HEADER = struct.Struct("<IIHHHH")
+OVERRIDE = struct.Struct("<HBBHH")
+SLOT_MINUTES = 15
+SLOTS_PER_DAY = 24 * 60 // SLOT_MINUTES
+BITMAP_BYTES = 7 * SLOTS_PER_DAY // 8
+MAX_PROFILES = 16
+MAX_OVERRIDES = 64
+WEEKDAYS = ["sun", "mon", "tue", "wed", "thu", "fri", "sat"]  # Firmware order
+CLOSED = 7
+OPEN = 8
+EPOCH = datetime.date(1970, 1, 1)
+
+
+def parse_time(text):
+    """
+    Returns:
+        Slot of the day for "HH:MM" (96 for "24:00")
+    """
+    hours, minutes = (int(part) for part in text.split(":"))
+    if minutes % SLOT_MINUTES or not 0 <= hours * 60 + minutes <= 24 * 60:
+        raise ValueError(f"time {text!r} is not on a {SLOT_MINUTES}-minute step")
+    return (hours * 60 + minutes) // SLOT_MINUTES
+
+
+def compile_profile(profile):
+    """
+    Returns:
+        The profile's weekly bitmap, bit (weekday * 96 + slot)
+    """
+    bitmap = bytearray(BITMAP_BYTES)
+    for window in profile.get("windows", []):
+        start = parse_time(window["from"])
+        end = parse_time(window["to"])
+        length = end - start if end > start else end + SLOTS_PER_DAY - start
+        for day in window["days"]:
+            first = WEEKDAYS.index(day.lower()[:3]) * SLOTS_PER_DAY + start
+            for bit in range(first, first + length):
+                bit %= 7 * SLOTS_PER_DAY
+                bitmap[bit // 8] |= 1 << (bit % 8)
+    return bytes(bitmap)
+
+
+def compile_override(override, profile_count):
+    """
+    Returns:
+        (day number, packed override)
+    """
+    day = (datetime.date.fromisoformat(override["date"]) - EPOCH).days
+    action = override["as"].lower()
+    if action == "closed":
+        code = CLOSED
+    elif action == "open":
+        code = OPEN
+    else:
+        code = WEEKDAYS.index(action[:3])
+
+    mask = 0
+    for profile_id in override.get("profiles", range(1, profile_count + 1)):
+        if not 1 <= profile_id <= MAX_PROFILES:
+            raise ValueError(f"override for {override['date']} names profile {profile_id}")
+        mask |= 1 << (profile_id - 1)
+    return day, OVERRIDE.pack(day, code, 0, mask, 0)
+
+
+def compile_schedule(source, today):
+    """
+    Compile a parsed schedule. Overrides dated before yesterday are dropped;
+    yesterday is kept for gates whose local date is behind the server's.
+
+    Returns:
+        Schedule bytes as the firmware stores them
+    """
+    profiles = {int(profile["id"]): profile for profile in source.get("profiles", [])}
+    if any(not 1 <= profile_id <= MAX_PROFILES for profile_id in profiles):
+        raise ValueError(f"profile ids must be 1-{MAX_PROFILES}")
+    profile_count = max(profiles, default=0)
+    # A gap in the numbering is a profile with no windows
+    bitmaps = b"".join(
+        compile_profile(profiles[profile_id]) if profile_id in profiles else bytes(BITMAP_BYTES)
+        for profile_id in range(1, profile_count + 1)
+    )
+
+    first_day = (today - EPOCH).days - 1
+    # Stable sort keeps the file's order among overrides of one date
+    overrides = sorted(
+        (compile_override(override, profile_count) for override in source.get("overrides", [])),
+        key=lambda entry: entry[0],
+    )
+    overrides = [packed for day, packed in overrides if day >= first_day]
+    if len(overrides) > MAX_OVERRIDES:
+        logger.warning(f"Schedule has {len(overrides)} upcoming overrides, sending the first {MAX_OVERRIDES}")
+        overrides = overrides[:MAX_OVERRIDES]
+
+    body = bitmaps + b"".join(overrides)
+    return HEADER.pack(MAGIC, zlib.crc32(body), profile_count, len(overrides), SLOT_MINUTES, 0) + body
+
+
+class Schedule:
+    """
+    Compiled schedule, rebuilt when the source file or the date changes
+
+    Args:
+        path: JSON schedule (see the module docstring)
+    """
+
+    def __init__(self, path):
+        self.path = path
+        self.lock = threading.Lock()
+        self.key = None
+        self.data = b""
+
+    def refresh(self):
+        try:
+            mtime = os.stat(self.path).st_mtime
+        except FileNotFoundError:
+            mtime = None
+        today = datetime.date.today()
+        if (mtime, today) == self.key:
+            return
+        self.key = (mtime, today)
+
+        data = b""
+        if mtime is not None:
+            try:
+                with open(self.path, encoding="utf-8") as handle:
+                    data = compile_schedule(json.load(handle), today)
+            except (ValueError, KeyError, TypeError) as e:
+                logger.error(f"Schedule not updated: {e}")
+                return
+
+        with self.lock:
+            self.data = data
+        logger.info(f"Schedule: {len(data)} bytes, generation {self.generation()}")
+
+    def generation(self):
+        """
+        Returns:
+            CRC carried in the schedule header, 0 when there is none
+        """
+        with self.lock:
+            return HEADER.unpack_from(self.data)[1] if self.data else 0
+
+    def image(self):
+        with self.lock:
+            return self.data
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile a JSON access schedule for the gates")
+    parser.add_argument("source", help="JSON schedule")
+    parser.add_argument("-o", "--output", default="schedule.bin", help="schedule file to write")
+    parser.add_argument("--today", type=datetime.date.fromisoformat, default=datetime.date.today(),
+                        help="date to compile for, YYYY-MM-DD (default: today)")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format="%(levelname)s - %(message)s")
+    try:
+        with open(args.source, encoding="utf-8") as handle:
+            data = compile_schedule(json.load(handle), args.today)
+    except (ValueError, KeyError, TypeError) as e:
+        logger.error(f"Cannot compile schedule: {e}")
+        return 1
+
+    with open(args.output, "wb") as handle:
+        handle.write(data)
+    logger.info(f"{len(data)} bytes, generation {HEADER.unpack_from(data)[1]}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,132 @@
+"""
+Server side of the firmware's UDP decision protocol.
+
+The packet layout is documented in firmware/GateKeeper/include/UdpDecisionClient.h.
+A trigger starts one recognition per request ID. Retransmitted triggers
+never start a second one: while recognition runs they get a Pending answer,
+and afterwards the cached decision is sent again.
+"""
+
+import asyncio
+import collections
+import hashlib
+import hmac
+import logging
+import struct
+
+logger = logging.getLogger(__name__)
+
+VERSION = 1
+TYPE_TRIGGER = 1
+TYPE_DECISION = 2
+MAC_SIZE = 16
+PLATE_SIZE = 16
+
+VERDICT_DENY = 0
+VERDICT_ACCEPT = 1
+VERDICT_PENDING = 2
+VERDICT_ERROR = 3
+
+TRIGGER = struct.Struct("<2sBBIB3xI")
+DECISION = struct.Struct("<2sBBIBB16sHHH")
+TRIGGER_SIZE = TRIGGER.size + MAC_SIZE
+DECISION_SIZE = DECISION.size + MAC_SIZE
+
+# Answers kept for retransmitted triggers
+CACHE_SIZE = 64
+
+
+def sign(key, body):
+    """
+    Truncated HMAC-SHA256 of a packet body
+    """
+    return hmac.new(key, body, hashlib.sha256).digest()[:MAC_SIZE]
+
+
+def encode_decision(key, request_id, verdict, plate="", timings=None):
+    """
+    Build a signed decision packet
+
+    Args:
+        key: Shared secret
+        request_id: ID from the trigger being answered
+        verdict: One of the VERDICT_* values
+        plate: Recognized plate text, truncated to PLATE_SIZE bytes
+        timings: Dict with capture/detect/ocr milliseconds
+
+    Returns:
+        Packet bytes
+    """
+    timings = timings or {}
+    plate_bytes = plate.encode("ascii", errors="replace")[:PLATE_SIZE]
+    body = DECISION.pack(
+        b"GK", VERSION, TYPE_DECISION, request_id, verdict, len(plate_bytes), plate_bytes,
+        *(min(int(timings.get(stage, 0)), 0xFFFF) for stage in ("capture", "detect", "ocr")),
+    )
+    return body + sign(key, body)
+
+
+class DecisionServerProtocol(asyncio.DatagramProtocol):
+    """
+    asyncio endpoint answering triggers with decisions
+
+    Args:
+        key: Shared secret (bytes)
+        recognize: Blocking callable returning (result dict, timings dict);
+            it runs in the default executor, so it must serialize access to
+            the camera itself
+    """
+
+    def __init__(self, key, recognize):
+        self.key = key
+        self.recognize = recognize
+        self.transport = None
+        self.in_progress = set()
+        self.answers = collections.OrderedDict()
+
+    def connection_made(self, transport):
+        self.transport = transport
+
+    def datagram_received(self, data, addr):
+        if len(data) != TRIGGER_SIZE:
+            return
+        body, mac = data[:-MAC_SIZE], data[-MAC_SIZE:]
+        if not hmac.compare_digest(mac, sign(self.key, body)):
+            logger.warning(f"Dropping trigger with bad MAC from {addr[0]}")
+            return
+
+        magic, version, packet_type, request_id, attempt, _client_ms = TRIGGER.unpack(body)
+        if magic != b"GK" or version != VERSION or packet_type != TYPE_TRIGGER:
+            return
+
+        # Request IDs are only unique per gate, so key the cache by sender too
+        request = (addr[0], request_id)
+        if request in self.answers:
+            self.answers.move_to_end(request)
+            self.transport.sendto(self.answers[request], addr)
+            return
+        if request in self.in_progress:
+            self.transport.sendto(encode_decision(self.key, request_id, VERDICT_PENDING), addr)
+            return
+
+        logger.info(f"UDP trigger {request_id:08x} from {addr[0]} (attempt {attempt})")
+        self.in_progress.add(request)
+        self.transport.sendto(encode_decision(self.key, request_id, VERDICT_PENDING), addr)
+        asyncio.ensure_future(self._answer(request, addr))
+
+    async def _answer(self, request, addr):
+        request_id = request[1]
+        try:
+            result, timings = await asyncio.get_running_loop().run_in_executor(None, self.recognize)
+            verdict = VERDICT_ACCEPT if result.get("status") else VERDICT_DENY
+            packet = encode_decision(self.key, request_id, verdict, result.get("plate", ""), timings)
+        except Exception as e:
+            logger.error(f"UDP recognition failed: {str(e)}")
+            packet = encode_decision(self.key, request_id, VERDICT_ERROR)
+        finally:
+            self.in_progress.discard(request)
+
+        self.answers[request] = packet
+        while len(self.answers) > CACHE_SIZE:
+            self.answers.popitem(last=False)
+        self.transport.sendto(packet, addr)